@@ -22,6 +22,37 @@ function(add_tests test_flag exec_target subdir)
   endif()
 endfunction()
 
+# ============================================================================
+# Function: setup_generic_implementation - compiles <BASE_DIR>/generic/src/*.cpp
+# once for backend NAME (seq, omp, tbb or stl) with PPC_GENERIC_BACKEND set to
+# the matching ppc::task::TypeOfTask value (e.g. kOMP). The sources explicitly
+# instantiate their kernel templates for ppc::parallel::kGenericBackend.
+# ============================================================================
+set(PPC_GENERIC_BACKENDS "seq;omp;tbb;stl")
+
+function(setup_generic_implementation)
+  cmake_parse_arguments(SETUP "" "NAME;PROJ_NAME;BASE_DIR" "TESTS" ${ARGN})
+
+  set(GENERIC_DIR "${SETUP_BASE_DIR}/generic")
+  if(NOT EXISTS "${GENERIC_DIR}" OR NOT SETUP_NAME IN_LIST
+                                    PPC_GENERIC_BACKENDS)
+    return()
+  endif()
+  message(STATUS "  -- generic (${SETUP_NAME})")
+
+  file(GLOB_RECURSE GENERIC_SOURCES "${GENERIC_DIR}/src/*.cpp")
+  set(LIB_NAME "${SETUP_PROJ_NAME}_generic_${SETUP_NAME}")
+  add_library(${LIB_NAME} STATIC ${GENERIC_SOURCES})
+  string(TOUPPER "${SETUP_NAME}" BACKEND_UPPER)
+  target_compile_definitions(${LIB_NAME}
+                             PRIVATE PPC_GENERIC_BACKEND=k${BACKEND_UPPER})
+  target_link_libraries(${LIB_NAME} PUBLIC core_module_lib)
+
+  foreach(test_exec ${SETUP_TESTS})
+    target_link_libraries(${test_exec} PUBLIC ${LIB_NAME})
+  endforeach()
+endfunction()
+
 # ============================================================================
 # Function: setup_implementation - NAME:       implementation sub‐directory name
 # (e.g. “mpi”) - PROJ_NAME:  project base name - BASE_DIR:   root source
@@ -32,6 +63,17 @@ function(setup_implementation)
   cmake_parse_arguments(SETUP "" # no plain options
                         "NAME;PROJ_NAME;BASE_DIR" "TESTS" ${ARGN})
 
+  # instantiate single-source generic kernels for this backend
+  setup_generic_implementation(
+    NAME
+    ${SETUP_NAME}
+    PROJ_NAME
+    ${SETUP_PROJ_NAME}
+    BASE_DIR
+    ${SETUP_BASE_DIR}
+    TESTS
+    "${SETUP_TESTS}")
+
   # skip if impl dir doesn't exist
   set(IMP_DIR "${SETUP_BASE_DIR}/${SETUP_NAME}")
   if(NOT EXISTS "${IMP_DIR}")
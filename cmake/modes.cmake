@@ -25,3 +25,15 @@ if(USE_PERF_TESTS)
   message(STATUS "Enable performance tests")
   add_compile_definitions(USE_PERF_TESTS)
 endif(USE_PERF_TESTS)
+
+option(USE_BENCHMARKS "Enable microbenchmarks" OFF)
+if(USE_BENCHMARKS)
+  message(STATUS "Enable microbenchmarks")
+endif(USE_BENCHMARKS)
+
+option(USE_DATA_CACHE "Convert task data images into raw files at build time" ON)
+if(USE_DATA_CACHE)
+  message(STATUS "Enable task data cache")
+  set(PPC_DATA_CACHE_DIR "${CMAKE_BINARY_DIR}/data")
+  add_compile_definitions(PPC_PATH_TO_DATA_CACHE="${PPC_DATA_CACHE_DIR}")
+endif(USE_DATA_CACHE)
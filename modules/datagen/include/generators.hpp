@@ -0,0 +1,344 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "datagen/include/philox.hpp"
+#include "linalg/include/dense_matrix.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+
+namespace ppc::datagen {
+
+/// @brief Element types the generators produce: the integer and floating-point types except bool.
+template <typename T>
+concept GeneratedElement = (std::integral<T> || std::floating_point<T>) && !std::same_as<T, bool>;
+
+/// @brief Value distribution, or order of the values, of a generated array.
+enum class Distribution : uint8_t {
+  /// Uniform in [low, high]
+  kUniform,
+  /// Normal with ArrayOptions::mean and ArrayOptions::stddev; integers are rounded and clamped to [low, high]
+  kNormal,
+  /// low + k - 1 for a rank k in [1, ArrayOptions::values] with P(k) ~ k^-exponent: few values are very frequent
+  kZipf,
+  /// Uniform over the ArrayOptions::values values low, low + 1, ...: many duplicates
+  kFewDistinct,
+  /// Non-decreasing from low to high
+  kSorted,
+  /// Non-increasing from high to low
+  kReversed,
+  /// kSorted with 1% of the elements replaced by uniform values
+  kNearlySorted,
+  /// Rises from low to high over the first half and falls back over the second
+  kOrganPipe,
+  /// About sqrt(n) ascending runs, each spanning [low, high]
+  kSawtooth,
+};
+
+namespace detail {
+
+template <GeneratedElement T>
+consteval T DefaultLow() {
+  if constexpr (std::floating_point<T>) {
+    return T{0};
+  } else {
+    return std::numeric_limits<T>::min();
+  }
+}
+
+template <GeneratedElement T>
+consteval T DefaultHigh() {
+  if constexpr (std::floating_point<T>) {
+    return T{1};
+  } else {
+    return std::numeric_limits<T>::max();
+  }
+}
+
+}  // namespace detail
+
+template <GeneratedElement T>
+/// @brief Distribution and parameters of an array made by FillArray() or MakeArray().
+struct ArrayOptions {
+  Distribution distribution = Distribution::kUniform;
+  /// Smallest value; by default 0 for floating-point and the smallest value of the type for integer elements
+  T low = detail::DefaultLow<T>();
+  /// Largest value; by default 1 for floating-point and the largest value of the type for integer elements
+  T high = detail::DefaultHigh<T>();
+  /// Parameters of kNormal
+  double mean = 0.0;
+  double stddev = 1.0;
+  /// Exponent of kZipf, larger is more skewed
+  double exponent = 1.0;
+  /// Number of distinct values of kZipf and kFewDistinct
+  int64_t values = 1024;
+  uint64_t seed = 0;
+  /// Independent streams of the same seed, e.g. for the two operands of a task
+  uint32_t stream = 0;
+};
+
+namespace detail {
+
+/// Computes element i of an array of `total` elements from (seed, stream, i) alone.
+template <GeneratedElement T>
+class ArrayGenerator {
+ public:
+  ArrayGenerator(const ArrayOptions<T> &options, int64_t total)
+      : options_(options), stream_{.seed = options.seed, .id = options.stream}, total_(total) {
+    if (total < 0 || options.high < options.low || options.values < 1 || !(options.stddev >= 0.0) ||
+        !(options.exponent > 0.0)) {
+      throw std::invalid_argument("ppc::datagen: invalid array options");
+    }
+    if constexpr (std::integral<T>) {
+      width_ = ToBits(options.high) - ToBits(options.low);
+    }
+    const auto values = static_cast<double>(options.values);
+    zipf_scale_ =
+        options.exponent == 1.0 ? std::log(values + 1.0) : std::pow(values + 1.0, 1.0 - options.exponent) - 1.0;
+    run_ = std::max<int64_t>(1, std::llround(std::sqrt(static_cast<double>(total))));
+    runs_ = total == 0 ? 0 : (total + run_ - 1) / run_;
+  }
+
+  T operator()(int64_t index) const {
+    const Philox4x32::Block bits = stream_.Bits(static_cast<uint64_t>(index));
+    const uint64_t word = Word64(bits, 0);
+    switch (options_.distribution) {
+      case Distribution::kUniform:
+        return Uniform(word);
+      case Distribution::kNormal:
+        return Normal(word, Word64(bits, 1));
+      case Distribution::kZipf:
+        return Zipf(ToUnit(word));
+      case Distribution::kFewDistinct:
+        return Offset(word % static_cast<uint64_t>(options_.values));
+      case Distribution::kSorted:
+        return Sorted(index, total_, word);
+      case Distribution::kReversed:
+        return Sorted(total_ - 1 - index, total_, word);
+      case Distribution::kNearlySorted:
+        return ToUnit(Word64(bits, 1)) < kNearlySortedNoise ? Uniform(word) : Sorted(index, total_, word);
+      case Distribution::kOrganPipe:
+        return Sorted(index < total_ - index ? 2 * index : (2 * (total_ - 1 - index)) + 1, total_, word);
+      case Distribution::kSawtooth:
+        return Sorted(((index % run_) * runs_) + (index / run_), run_ * runs_, word);
+    }
+    throw std::invalid_argument("ppc::datagen: unknown distribution");
+  }
+
+ private:
+  static constexpr double kNearlySortedNoise = 0.01;
+
+  /// Two's complement bits of an integer value, so that differences wrap like unsigned arithmetic.
+  static uint64_t ToBits(T value) {
+    if constexpr (std::signed_integral<T>) {
+      return static_cast<uint64_t>(static_cast<int64_t>(value));
+    } else {
+      return static_cast<uint64_t>(value);
+    }
+  }
+
+  /// low + offset.
+  T Offset(uint64_t offset) const {
+    if constexpr (std::integral<T>) {
+      return static_cast<T>(ToBits(options_.low) + offset);
+    } else {
+      return static_cast<T>(static_cast<double>(options_.low) + static_cast<double>(offset));
+    }
+  }
+
+  /// Offset of a non-negative double, saturated at high.
+  uint64_t ToOffset(double offset) const {
+    return offset >= static_cast<double>(width_) ? width_ : static_cast<uint64_t>(offset);
+  }
+
+  T Uniform(uint64_t bits) const {
+    if constexpr (std::integral<T>) {
+      // The modulo bias is below (high - low + 1) / 2^64, far below what a test could observe
+      return width_ == std::numeric_limits<uint64_t>::max() ? Offset(bits) : Offset(bits % (width_ + 1));
+    } else {
+      const auto low = static_cast<double>(options_.low);
+      return static_cast<T>(low + ((static_cast<double>(options_.high) - low) * ToUnit(bits)));
+    }
+  }
+
+  T Normal(uint64_t first, uint64_t second) const {
+    // Box-Muller; 1 - u is in (0, 1], so the logarithm is finite
+    const double radius = std::sqrt(-2.0 * std::log(1.0 - ToUnit(first)));
+    const double value = options_.mean + (options_.stddev * radius * std::cos(2.0 * std::numbers::pi * ToUnit(second)));
+    if constexpr (std::integral<T>) {
+      const double rounded = std::floor(value + 0.5);
+      if (!(rounded > static_cast<double>(options_.low))) {
+        return options_.low;
+      }
+      return Offset(ToOffset(rounded - static_cast<double>(options_.low)));
+    } else {
+      return static_cast<T>(value);
+    }
+  }
+
+  T Zipf(double unit) const {
+    // Inverse CDF of the density x^-s on [1, values + 1); its integer part is approximately Zipf distributed
+    const double s = options_.exponent;
+    const double x = s == 1.0 ? std::exp(unit * zipf_scale_) : std::pow((unit * zipf_scale_) + 1.0, 1.0 / (1.0 - s));
+    const auto rank = std::clamp<int64_t>(static_cast<int64_t>(x), 1, options_.values);
+    return Offset(static_cast<uint64_t>(rank - 1));
+  }
+
+  /// floor(a * b / n) for a <= n and b < n, without overflowing 64 bits.
+  static uint64_t MulDiv(uint64_t a, uint64_t b, uint64_t n) {
+    if (n <= (uint64_t{1} << 32U)) {
+      return a * b / n;
+    }
+    // Long multiplication by the bits of a, keeping quotient * n + remainder equal to the product so far
+    uint64_t quotient = 0;
+    uint64_t remainder = 0;
+    for (int bit = 63; bit >= 0; bit--) {
+      quotient <<= 1U;
+      remainder <<= 1U;
+      if (remainder >= n) {
+        remainder -= n;
+        quotient++;
+      }
+      if (((a >> static_cast<unsigned>(bit)) & 1U) != 0) {
+        remainder += b;
+        if (remainder >= n) {
+          remainder -= n;
+          quotient++;
+        }
+      }
+    }
+    return quotient;
+  }
+
+  /// floor(rank * (high - low + 1) / ranks) for 0 <= rank <= ranks, modulo 2^64.
+  uint64_t SortedStep(int64_t rank, int64_t ranks) const {
+    const auto r = static_cast<uint64_t>(rank);
+    const auto n = static_cast<uint64_t>(ranks);
+    // high - low + 1 = quotient * ranks + remainder, without forming high - low + 1, which may be 2^64
+    uint64_t quotient = width_ / n;
+    uint64_t remainder = (width_ % n) + 1;
+    if (remainder == n) {
+      quotient++;
+      remainder = 0;
+    }
+    return (r * quotient) + MulDiv(r, remainder, n);
+  }
+
+  /// Value of rank `rank` of `ranks` in a non-decreasing sequence from low to high; ranks that share a step of
+  /// the range get random values within the step.
+  T Sorted(int64_t rank, int64_t ranks, uint64_t bits) const {
+    if constexpr (std::integral<T>) {
+      // Exact integer steps: with at least as many values as ranks every rank gets a distinct value
+      if (ranks == 1) {
+        return Uniform(bits);
+      }
+      const uint64_t first = SortedStep(rank, ranks);
+      // Exact even if the last step ends at 2^64, as first > 0 for ranks > 1
+      const uint64_t gap = SortedStep(rank + 1, ranks) - first;
+      if (gap < 2) {
+        return Offset(first);
+      }
+      return Offset(first + (bits % gap));
+    } else {
+      const auto low = static_cast<double>(options_.low);
+      const double position = (static_cast<double>(rank) + ToUnit(bits)) / static_cast<double>(ranks);
+      return static_cast<T>(low + ((static_cast<double>(options_.high) - low) * position));
+    }
+  }
+
+  ArrayOptions<T> options_;
+  Stream stream_;
+  int64_t total_ = 0;
+  /// high - low
+  uint64_t width_ = 0;
+  double zipf_scale_ = 0.0;
+  /// Length and number of the kSawtooth runs
+  int64_t run_ = 1;
+  int64_t runs_ = 0;
+};
+
+}  // namespace detail
+
+template <ppc::task::TypeOfTask kBackend, GeneratedElement T>
+/// @brief Fills @p out with elements [@p first, @p first + out.size()) of the array of @p total elements that
+///        @p options describe.
+/// @details Every element is computed from (seed, stream, global index) with Philox4x32, so the values do not
+///          depend on the policy, its grain or the thread count, and an MPI rank can generate just its part: with
+///          the BlockRange() of a rank as @p first and the size of the whole array as @p total, the ranks together
+///          produce exactly the array MakeArray() returns. The elements are generated in parallel under @p policy.
+/// @param total Size of the whole array, by default @p first + out.size(); the sorted orders depend on it.
+/// @throws std::invalid_argument if the options are invalid (high < low, values < 1, a negative stddev or a
+///         non-positive exponent) or the part is not within the array.
+void FillArray(const ppc::parallel::ExecutionPolicy<kBackend> &policy, std::span<T> out,
+               const ArrayOptions<T> &options, int64_t first = 0, int64_t total = -1) {
+  const auto size = static_cast<int64_t>(out.size());
+  if (total < 0) {
+    total = first + size;
+  }
+  if (first < 0 || first + size > total) {
+    throw std::invalid_argument("FillArray: the part is not within the array");
+  }
+  const detail::ArrayGenerator<T> generator(options, total);
+  ppc::parallel::ParallelForRange(policy, 0, size, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      out[static_cast<std::size_t>(i)] = generator(first + i);
+    }
+  });
+}
+
+template <GeneratedElement T, ppc::task::TypeOfTask kBackend>
+/// @brief Returns the array of @p size elements that @p options describe, generated in parallel under @p policy.
+std::vector<T> MakeArray(const ppc::parallel::ExecutionPolicy<kBackend> &policy, int64_t size,
+                         const ArrayOptions<T> &options = {}) {
+  if (size < 0) {
+    throw std::invalid_argument("MakeArray: size must not be negative");
+  }
+  std::vector<T> values(static_cast<std::size_t>(size));
+  FillArray(policy, std::span<T>(values), options);
+  return values;
+}
+
+template <ppc::task::TypeOfTask kBackend, GeneratedElement T>
+/// @brief Fills the rows of @p out with rows [@p first_row, @p first_row + out.rows) of a matrix of @p total_rows
+///        rows whose row-major elements are the array @p options describe.
+/// @details As FillArray(): the values depend only on the options and the position in the whole matrix, so ranks
+///          can generate their row blocks independently. Element (r, c) is element r * cols + c of the array.
+/// @param total_rows Number of rows of the whole matrix, by default @p first_row + out.rows.
+void FillMatrix(const ppc::parallel::ExecutionPolicy<kBackend> &policy, ppc::linalg::MatrixView<T> out,
+                const ArrayOptions<T> &options, int64_t first_row = 0, int64_t total_rows = -1) {
+  if (total_rows < 0) {
+    total_rows = first_row + out.rows;
+  }
+  if (first_row < 0 || first_row + out.rows > total_rows) {
+    throw std::invalid_argument("FillMatrix: the rows are not within the matrix");
+  }
+  const detail::ArrayGenerator<T> generator(options, total_rows * out.cols);
+  ppc::parallel::ParallelForRange(policy, 0, out.rows, [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end; row++) {
+      const int64_t offset = (first_row + row) * out.cols;
+      for (int64_t col = 0; col < out.cols; col++) {
+        out(row, col) = generator(offset + col);
+      }
+    }
+  });
+}
+
+template <GeneratedElement T, ppc::task::TypeOfTask kBackend>
+/// @brief Returns the @p rows x @p cols matrix that @p options describe, generated in parallel under @p policy.
+ppc::linalg::DenseMatrix<T> MakeMatrix(const ppc::parallel::ExecutionPolicy<kBackend> &policy, int64_t rows,
+                                       int64_t cols, const ArrayOptions<T> &options = {}) {
+  ppc::linalg::DenseMatrix<T> matrix(rows, cols);
+  FillMatrix(policy, matrix.View(), options);
+  return matrix;
+}
+
+}  // namespace ppc::datagen
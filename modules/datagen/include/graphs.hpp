@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "datagen/include/philox.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+
+namespace ppc::datagen {
+
+/// @brief Directed edge of a generated graph.
+struct Edge {
+  int64_t src = 0;
+  int64_t dst = 0;
+
+  bool operator==(const Edge &) const = default;
+};
+
+/// @brief Structure of a generated graph.
+enum class GraphKind : uint8_t {
+  /// Both endpoints uniform over the vertices (Erdos-Renyi G(n, m) with replacement)
+  kUniform,
+  /// Recursive matrix (R-MAT, Chakrabarti et al.) as in Graph500: a skewed, power-law-like degree distribution
+  kRmat,
+};
+
+/// @brief Graph made by FillEdges() or MakeEdges().
+struct GraphOptions {
+  GraphKind kind = GraphKind::kRmat;
+  int64_t vertices = 0;
+  int64_t edges = 0;
+  /// Probabilities of the upper left, upper right and lower left quadrant of kRmat; the lower right one gets the
+  /// rest. The Graph500 defaults put most edges between low vertex ids.
+  double a = 0.57;
+  double b = 0.19;
+  double c = 0.19;
+  uint64_t seed = 0;
+  uint32_t stream = 0;
+};
+
+namespace detail {
+
+/// Computes edge i of a graph from (seed, stream, i) alone.
+class EdgeGenerator {
+ public:
+  explicit EdgeGenerator(const GraphOptions &options)
+      : options_(options), stream_{.seed = options.seed, .id = options.stream} {
+    if (options.vertices < 0 || options.edges < 0 || (options.edges > 0 && options.vertices == 0) ||
+        options.a < 0.0 || options.b < 0.0 || options.c < 0.0 || options.a + options.b + options.c > 1.0) {
+      throw std::invalid_argument("ppc::datagen: invalid graph options");
+    }
+    levels_ = options.vertices > 1 ? std::bit_width(static_cast<uint64_t>(options.vertices - 1)) : 0;
+    // Maps the 2^levels R-MAT vertex ids onto the vertices, keeping their order and thus the skew
+    scale_ = static_cast<double>(options.vertices) / static_cast<double>(uint64_t{1} << static_cast<unsigned>(levels_));
+  }
+
+  [[nodiscard]] Edge operator()(int64_t index) const {
+    switch (options_.kind) {
+      case GraphKind::kUniform: {
+        const Philox4x32::Block bits = stream_.Bits(static_cast<uint64_t>(index));
+        const auto vertices = static_cast<uint64_t>(options_.vertices);
+        return {.src = static_cast<int64_t>(Word64(bits, 0) % vertices),
+                .dst = static_cast<int64_t>(Word64(bits, 1) % vertices)};
+      }
+      case GraphKind::kRmat:
+        return Rmat(index);
+    }
+    throw std::invalid_argument("ppc::datagen: unknown graph kind");
+  }
+
+ private:
+  /// Each level picks a quadrant with a 32-bit random number; a Philox block covers four levels.
+  [[nodiscard]] Edge Rmat(int64_t index) const {
+    uint64_t src = 0;
+    uint64_t dst = 0;
+    Philox4x32::Block bits{};
+    for (int level = 0; level < levels_; level++) {
+      if (level % 4 == 0) {
+        bits = stream_.Bits(static_cast<uint64_t>(index), static_cast<uint32_t>(level / 4));
+      }
+      const double p = static_cast<double>(bits[level % 4]) * 0x1.0p-32;
+      const bool down = p >= options_.a + options_.b;
+      const bool right = down ? p >= options_.a + options_.b + options_.c : p >= options_.a;
+      src = (src << 1U) | static_cast<uint64_t>(down);
+      dst = (dst << 1U) | static_cast<uint64_t>(right);
+    }
+    return {.src = ToVertex(src), .dst = ToVertex(dst)};
+  }
+
+  [[nodiscard]] int64_t ToVertex(uint64_t id) const {
+    return std::min(static_cast<int64_t>(static_cast<double>(id) * scale_), options_.vertices - 1);
+  }
+
+  GraphOptions options_;
+  Stream stream_;
+  int levels_ = 0;
+  double scale_ = 1.0;
+};
+
+}  // namespace detail
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Fills @p out with edges [@p first, @p first + out.size()) of the graph @p options describe.
+/// @details Like FillArray(), every edge depends only on the options and its index, so the ranks of a distributed
+///          task can each generate their BlockRange() of the edges. Self loops and duplicate edges are kept.
+/// @throws std::invalid_argument if the options are invalid or the part is not within the edges.
+void FillEdges(const ppc::parallel::ExecutionPolicy<kBackend> &policy, std::span<Edge> out,
+               const GraphOptions &options, int64_t first = 0) {
+  const auto size = static_cast<int64_t>(out.size());
+  if (first < 0 || first + size > options.edges) {
+    throw std::invalid_argument("FillEdges: the part is not within the edges");
+  }
+  const detail::EdgeGenerator generator(options);
+  ppc::parallel::ParallelForRange(policy, 0, size, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      out[static_cast<std::size_t>(i)] = generator(first + i);
+    }
+  });
+}
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Returns the edge list of the graph @p options describe, generated in parallel under @p policy.
+std::vector<Edge> MakeEdges(const ppc::parallel::ExecutionPolicy<kBackend> &policy, const GraphOptions &options) {
+  if (options.edges < 0) {
+    throw std::invalid_argument("MakeEdges: the number of edges must not be negative");
+  }
+  std::vector<Edge> edges(static_cast<std::size_t>(options.edges));
+  FillEdges(policy, std::span<Edge>(edges), options);
+  return edges;
+}
+
+}  // namespace ppc::datagen
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace ppc::datagen {
+
+/// @brief Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel random numbers: as easy as
+///        1, 2, 3", SC'11).
+/// @details Unlike a sequential engine such as std::mt19937, the output is a pure function of a 128-bit counter and a
+///          64-bit key: the i-th random block is computed directly from i, without generating the i - 1 before it.
+///          Any thread or rank can therefore produce any part of a random sequence, and the sequence does not
+///          depend on how the work is split.
+class Philox4x32 {
+ public:
+  using Counter = std::array<uint32_t, 4>;
+  using Block = std::array<uint32_t, 4>;
+
+  explicit constexpr Philox4x32(uint64_t key)
+      : key_{static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32U)} {}
+
+  /// @brief Returns the 128 random bits of @p counter.
+  [[nodiscard]] constexpr Block operator()(Counter counter) const {
+    std::array<uint32_t, 2> key = key_;
+    for (int round = 0; round < kRounds; round++) {
+      if (round > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      const uint64_t product0 = static_cast<uint64_t>(kMultiplier0) * counter[0];
+      const uint64_t product1 = static_cast<uint64_t>(kMultiplier1) * counter[2];
+      counter = {static_cast<uint32_t>(product1 >> 32U) ^ counter[1] ^ key[0], static_cast<uint32_t>(product1),
+                 static_cast<uint32_t>(product0 >> 32U) ^ counter[3] ^ key[1], static_cast<uint32_t>(product0)};
+    }
+    return counter;
+  }
+
+ private:
+  static constexpr int kRounds = 10;
+  static constexpr uint32_t kMultiplier0 = 0xD2511F53U;
+  static constexpr uint32_t kMultiplier1 = 0xCD9E8D57U;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9U;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85U;
+
+  std::array<uint32_t, 2> key_;
+};
+
+/// @brief Random stream: the same seed and stream id give the same numbers on every thread, rank and run.
+/// @details Element @p index of a stream is Philox4x32(seed) applied to the counter {index, sub, id}, where @p sub
+///          selects one of several blocks per element for generators that need more than 128 bits.
+struct Stream {
+  uint64_t seed = 0;
+  uint32_t id = 0;
+
+  [[nodiscard]] constexpr Philox4x32::Block Bits(uint64_t index, uint32_t sub = 0) const {
+    return Philox4x32(seed)({static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32U), sub, id});
+  }
+};
+
+/// @brief Returns the 64-bit word @p word (0 or 1) of @p block.
+constexpr uint64_t Word64(const Philox4x32::Block &block, int word) {
+  return (static_cast<uint64_t>(block[(2 * word) + 1]) << 32U) | block[2 * word];
+}
+
+/// @brief Maps 64 random bits to a double uniform in [0, 1) with 53 random bits.
+constexpr double ToUnit(uint64_t bits) {
+  return static_cast<double>(bits >> 11U) * 0x1.0p-53;
+}
+
+}  // namespace ppc::datagen
@@ -0,0 +1,291 @@
+#include "datagen/include/generators.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "datagen/include/graphs.hpp"
+#include "datagen/include/philox.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/partition.hpp"
+
+namespace {
+
+using ppc::datagen::ArrayOptions;
+using ppc::datagen::Distribution;
+
+const std::vector<Distribution> kDistributions = {
+    Distribution::kUniform,      Distribution::kNormal,    Distribution::kZipf,
+    Distribution::kFewDistinct,  Distribution::kSorted,    Distribution::kReversed,
+    Distribution::kNearlySorted, Distribution::kOrganPipe, Distribution::kSawtooth};
+
+template <typename Policy>
+class DatagenPolicyTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<ppc::parallel::SeqPolicy, ppc::parallel::OmpPolicy, ppc::parallel::TbbPolicy,
+                                  ppc::parallel::StlPolicy>;
+TYPED_TEST_SUITE(DatagenPolicyTest, Policies);
+
+const std::vector<int64_t> kGrains = {0, 1, 7, 1000};
+
+/// Concatenation of the parts that `parts` ranks generate independently.
+template <typename T, typename Policy>
+std::vector<T> GenerateInParts(const Policy &policy, int64_t size, int parts, const ArrayOptions<T> &options) {
+  std::vector<T> values(static_cast<std::size_t>(size));
+  for (int part = 0; part < parts; part++) {
+    const auto range = ppc::util::BlockRange(size, parts, part);
+    ppc::datagen::FillArray(policy, std::span<T>(values).subspan(range.begin, range.Size()), options, range.begin,
+                            size);
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(DatagenTest, PhiloxMatchesKnownAnswers) {
+  // Known-answer vectors of the Random123 reference implementation
+  using Block = ppc::datagen::Philox4x32::Block;
+  EXPECT_EQ(ppc::datagen::Philox4x32(0)({0, 0, 0, 0}), Block({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(ppc::datagen::Philox4x32(0xffffffffffffffffULL)({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}),
+            Block({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(ppc::datagen::Philox4x32(0x299f31d0a4093822ULL)({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+            Block({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TYPED_TEST(DatagenPolicyTest, ArraysDoNotDependOnPolicyOrGrain) {
+  for (const Distribution distribution : kDistributions) {
+    const ArrayOptions<int32_t> ints{.distribution = distribution, .low = -1000, .high = 1000, .seed = 7};
+    const ArrayOptions<double> reals{.distribution = distribution, .low = -1.0, .high = 1.0, .seed = 7};
+    const auto expected_ints = ppc::datagen::MakeArray(ppc::parallel::kSeq, 4099, ints);
+    const auto expected_reals = ppc::datagen::MakeArray(ppc::parallel::kSeq, 4099, reals);
+    for (const int64_t grain : kGrains) {
+      EXPECT_EQ(ppc::datagen::MakeArray(TypeParam{.grain = grain}, 4099, ints), expected_ints);
+      EXPECT_EQ(ppc::datagen::MakeArray(TypeParam{.grain = grain}, 4099, reals), expected_reals);
+    }
+  }
+}
+
+TYPED_TEST(DatagenPolicyTest, PartsConcatenateToTheWholeArray) {
+  for (const Distribution distribution : kDistributions) {
+    const ArrayOptions<int64_t> options{.distribution = distribution, .seed = 3};
+    const auto expected = ppc::datagen::MakeArray(ppc::parallel::kSeq, 1001, options);
+    for (const int parts : {1, 2, 3, 8}) {
+      EXPECT_EQ(GenerateInParts(TypeParam{}, 1001, parts, options), expected);
+    }
+  }
+}
+
+TYPED_TEST(DatagenPolicyTest, MatrixRowBlocksMatchTheWholeMatrix) {
+  const ArrayOptions<float> options{.distribution = Distribution::kNormal, .seed = 5};
+  const auto whole = ppc::datagen::MakeMatrix(TypeParam{}, 37, 19, options);
+  const auto values = ppc::datagen::MakeArray(ppc::parallel::kSeq, 37 * 19, options);
+  EXPECT_EQ(whole.ToRowMajor(), values);
+
+  ppc::linalg::DenseMatrix<float> block(10, 19);
+  ppc::datagen::FillMatrix(TypeParam{}, block.View(), options, 20, 37);
+  for (int64_t row = 0; row < 10; row++) {
+    for (int64_t col = 0; col < 19; col++) {
+      EXPECT_EQ(block.View()(row, col), whole.View()(row + 20, col));
+    }
+  }
+}
+
+TYPED_TEST(DatagenPolicyTest, EdgesDoNotDependOnPolicyOrParts) {
+  for (const auto kind : {ppc::datagen::GraphKind::kUniform, ppc::datagen::GraphKind::kRmat}) {
+    const ppc::datagen::GraphOptions options{.kind = kind, .vertices = 1000, .edges = 5000, .seed = 11};
+    const auto expected = ppc::datagen::MakeEdges(ppc::parallel::kSeq, options);
+    EXPECT_EQ(ppc::datagen::MakeEdges(TypeParam{.grain = 3}, options), expected);
+    std::vector<ppc::datagen::Edge> edges(expected.size());
+    for (int part = 0; part < 3; part++) {
+      const auto range = ppc::util::BlockRange(options.edges, 3, part);
+      ppc::datagen::FillEdges(TypeParam{}, std::span(edges).subspan(range.begin, range.Size()), options,
+                              range.begin);
+    }
+    EXPECT_EQ(edges, expected);
+  }
+}
+
+TEST(DatagenTest, SeedAndStreamSelectIndependentValues) {
+  const auto base = ppc::datagen::MakeArray<uint32_t>(ppc::parallel::kSeq, 1000, {.seed = 1});
+  const auto other_seed = ppc::datagen::MakeArray<uint32_t>(ppc::parallel::kSeq, 1000, {.seed = 2});
+  const auto other_stream = ppc::datagen::MakeArray<uint32_t>(ppc::parallel::kSeq, 1000, {.seed = 1, .stream = 1});
+  EXPECT_EQ(ppc::datagen::MakeArray<uint32_t>(ppc::parallel::kSeq, 1000, {.seed = 1}), base);
+  EXPECT_NE(other_seed, base);
+  EXPECT_NE(other_stream, base);
+  EXPECT_NE(other_seed, other_stream);
+}
+
+TEST(DatagenTest, UniformAndNormalValuesHaveTheirDistribution) {
+  const auto dice = ppc::datagen::MakeArray<int8_t>(ppc::parallel::kOmp, 60000, {.low = 1, .high = 6});
+  std::map<int8_t, int> counts;
+  for (const int8_t value : dice) {
+    counts[value]++;
+  }
+  ASSERT_EQ(counts.size(), 6U);
+  EXPECT_EQ(counts.begin()->first, 1);
+  EXPECT_EQ(counts.rbegin()->first, 6);
+  for (const auto &[value, count] : counts) {
+    EXPECT_NEAR(count, 10000, 500) << "value " << static_cast<int>(value);
+  }
+
+  const auto normal = ppc::datagen::MakeArray<double>(
+      ppc::parallel::kOmp, 100000, {.distribution = Distribution::kNormal, .mean = 5.0, .stddev = 2.0});
+  double sum = 0.0;
+  double squares = 0.0;
+  for (const double value : normal) {
+    sum += value;
+    squares += value * value;
+  }
+  const double mean = sum / static_cast<double>(normal.size());
+  EXPECT_NEAR(mean, 5.0, 0.05);
+  EXPECT_NEAR(std::sqrt((squares / static_cast<double>(normal.size())) - (mean * mean)), 2.0, 0.05);
+
+  const auto clamped = ppc::datagen::MakeArray<int16_t>(
+      ppc::parallel::kOmp, 10000, {.distribution = Distribution::kNormal, .low = -2, .high = 2, .stddev = 10.0});
+  EXPECT_EQ(std::ranges::min(clamped), -2);
+  EXPECT_EQ(std::ranges::max(clamped), 2);
+}
+
+TEST(DatagenTest, SkewedValuesRepeatFrequentValues) {
+  const auto zipf = ppc::datagen::MakeArray<int32_t>(
+      ppc::parallel::kOmp, 100000, {.distribution = Distribution::kZipf, .low = 0, .values = 1000});
+  std::vector<int> counts(1000, 0);
+  for (const int32_t value : zipf) {
+    ASSERT_GE(value, 0);
+    ASSERT_LT(value, 1000);
+    counts[static_cast<std::size_t>(value)]++;
+  }
+  // With exponent 1 the most frequent value is about twice as frequent as the second and ten times the tenth
+  EXPECT_GT(counts[0], counts[1]);
+  EXPECT_GT(counts[1], counts[9]);
+  EXPECT_GT(counts[0], 5 * counts[9]);
+
+  const auto few = ppc::datagen::MakeArray<uint64_t>(
+      ppc::parallel::kOmp, 10000, {.distribution = Distribution::kFewDistinct, .low = 100, .values = 4});
+  EXPECT_EQ(std::set<uint64_t>(few.begin(), few.end()), std::set<uint64_t>({100, 101, 102, 103}));
+}
+
+TEST(DatagenTest, OrderedArraysHaveTheirOrder) {
+  for (const int64_t size : {1, 2, 5, 1000, 4099}) {
+    const ArrayOptions<int32_t> sorted{.distribution = Distribution::kSorted, .low = -50, .high = 50};
+    const auto ascending = ppc::datagen::MakeArray(ppc::parallel::kOmp, size, sorted);
+    EXPECT_TRUE(std::ranges::is_sorted(ascending));
+    EXPECT_GE(ascending.front(), -50);
+    EXPECT_LE(ascending.back(), 50);
+
+    auto descending = ppc::datagen::MakeArray(ppc::parallel::kOmp, size,
+                                              ArrayOptions<int32_t>{.distribution = Distribution::kReversed});
+    EXPECT_TRUE(std::ranges::is_sorted(descending, std::ranges::greater{}));
+
+    const auto reals = ppc::datagen::MakeArray(ppc::parallel::kOmp, size,
+                                               ArrayOptions<double>{.distribution = Distribution::kSorted});
+    EXPECT_TRUE(std::ranges::is_sorted(reals));
+
+    const auto pipe = ppc::datagen::MakeArray(ppc::parallel::kOmp, size,
+                                              ArrayOptions<int64_t>{.distribution = Distribution::kOrganPipe});
+    const auto peak = std::ranges::max_element(pipe);
+    EXPECT_TRUE(std::is_sorted(pipe.begin(), peak));
+    EXPECT_TRUE(std::is_sorted(peak, pipe.end(), std::ranges::greater{}));
+  }
+
+  const auto saw = ppc::datagen::MakeArray(ppc::parallel::kOmp, 10000,
+                                           ArrayOptions<uint32_t>{.distribution = Distribution::kSawtooth});
+  int64_t descents = 0;
+  for (std::size_t i = 1; i < saw.size(); i++) {
+    descents += static_cast<int64_t>(saw[i] < saw[i - 1]);
+  }
+  EXPECT_EQ(descents, 99);
+
+  const auto nearly = ppc::datagen::MakeArray(ppc::parallel::kOmp, 100000,
+                                              ArrayOptions<float>{.distribution = Distribution::kNearlySorted});
+  descents = 0;
+  for (std::size_t i = 1; i < nearly.size(); i++) {
+    descents += static_cast<int64_t>(nearly[i] < nearly[i - 1]);
+  }
+  EXPECT_GT(descents, 0);
+  EXPECT_LT(descents, 2000);
+}
+
+TEST(DatagenTest, SortedIntegersStepExactly) {
+  // As many values as elements: each element gets its own value
+  constexpr int64_t kSize = 1'000'003;
+  const auto low = static_cast<int32_t>(-(kSize / 2));
+  const auto high = static_cast<int32_t>(low + kSize - 1);
+  const auto ascending =
+      ppc::datagen::MakeArray(ppc::parallel::kOmp, kSize,
+                              ArrayOptions<int32_t>{.distribution = Distribution::kSorted, .low = low, .high = high});
+  const auto descending =
+      ppc::datagen::MakeArray(ppc::parallel::kOmp, kSize,
+                              ArrayOptions<int32_t>{.distribution = Distribution::kReversed, .low = low, .high = high});
+  for (int64_t i = 0; i < kSize; i++) {
+    ASSERT_EQ(ascending[static_cast<std::size_t>(i)], low + i);
+    ASSERT_EQ(descending[static_cast<std::size_t>(i)], high - i);
+  }
+
+  // The whole 64-bit range (the default): still strictly increasing
+  const auto wide = ppc::datagen::MakeArray(ppc::parallel::kOmp, kSize,
+                                            ArrayOptions<int64_t>{.distribution = Distribution::kSorted});
+  EXPECT_TRUE(std::ranges::adjacent_find(wide, std::ranges::greater_equal{}) == wide.end());
+  EXPECT_LT(wide.front(), std::numeric_limits<int64_t>::min() / 2);
+  EXPECT_GT(wide.back(), std::numeric_limits<int64_t>::max() / 2);
+  const auto unsigned_wide = ppc::datagen::MakeArray(ppc::parallel::kOmp, kSize,
+                                                     ArrayOptions<uint64_t>{.distribution = Distribution::kSorted});
+  EXPECT_TRUE(std::ranges::adjacent_find(unsigned_wide, std::ranges::greater_equal{}) == unsigned_wide.end());
+
+  // More than 2^32 elements, evaluated at a few indices: each step of three values holds one element
+  constexpr int64_t kHuge = int64_t{3} << 40U;
+  const ppc::datagen::detail::ArrayGenerator<int64_t> steps(
+      {.distribution = Distribution::kSorted, .low = 0, .high = (3 * kHuge) - 1}, kHuge);
+  // and with fewer values than elements, element i gets value floor(i * 256 / n)
+  const ppc::datagen::detail::ArrayGenerator<uint8_t> shared({.distribution = Distribution::kSorted},
+                                                             int64_t{1} << 40U);
+  for (const int64_t index : {int64_t{0}, int64_t{1}, (int64_t{1} << 32U) + 5, kHuge / 3, kHuge - 2, kHuge - 1}) {
+    EXPECT_EQ(steps(index) / 3, index);
+    const int64_t shared_index = index % (int64_t{1} << 40U);
+    EXPECT_EQ(shared(shared_index), static_cast<uint8_t>(shared_index >> 32U));
+  }
+}
+
+TEST(DatagenTest, RmatGraphsHaveSkewedDegrees) {
+  const ppc::datagen::GraphOptions options{.vertices = 1 << 12, .edges = 1 << 16, .seed = 1};
+  const auto edges = ppc::datagen::MakeEdges(ppc::parallel::kOmp, options);
+  std::vector<int> degrees(static_cast<std::size_t>(options.vertices), 0);
+  for (const auto &edge : edges) {
+    ASSERT_GE(edge.src, 0);
+    ASSERT_LT(edge.src, options.vertices);
+    ASSERT_GE(edge.dst, 0);
+    ASSERT_LT(edge.dst, options.vertices);
+    degrees[static_cast<std::size_t>(edge.src)]++;
+  }
+  // The average out-degree is 16; R-MAT concentrates edges on a few hubs
+  EXPECT_GT(std::ranges::max(degrees), 16 * 20);
+
+  const auto odd = ppc::datagen::MakeEdges(ppc::parallel::kOmp, {.vertices = 5, .edges = 1000});
+  EXPECT_TRUE(std::ranges::all_of(odd, [](const auto &edge) { return edge.src < 5 && edge.dst < 5; }));
+  EXPECT_EQ(ppc::datagen::MakeEdges(ppc::parallel::kOmp, {.vertices = 1, .edges = 3}),
+            std::vector<ppc::datagen::Edge>(3));
+}
+
+TEST(DatagenTest, InvalidOptionsThrow) {
+  EXPECT_THROW((void)ppc::datagen::MakeArray<int32_t>(ppc::parallel::kSeq, 10, {.low = 5, .high = 4}),
+               std::invalid_argument);
+  EXPECT_THROW((void)ppc::datagen::MakeArray<double>(ppc::parallel::kSeq, 10, {.stddev = -1.0}),
+               std::invalid_argument);
+  EXPECT_THROW((void)ppc::datagen::MakeArray<int32_t>(ppc::parallel::kSeq, 10, {.values = 0}), std::invalid_argument);
+  EXPECT_THROW((void)ppc::datagen::MakeArray<int32_t>(ppc::parallel::kSeq, -1), std::invalid_argument);
+  std::vector<int32_t> part(5);
+  EXPECT_THROW(ppc::datagen::FillArray(ppc::parallel::kSeq, std::span(part), {}, 8, 10), std::invalid_argument);
+  EXPECT_THROW((void)ppc::datagen::MakeEdges(ppc::parallel::kSeq, {.vertices = 0, .edges = 1}),
+               std::invalid_argument);
+  EXPECT_THROW((void)ppc::datagen::MakeEdges(ppc::parallel::kSeq, {.vertices = 4, .edges = 1, .a = 0.9, .b = 0.2}),
+               std::invalid_argument);
+}
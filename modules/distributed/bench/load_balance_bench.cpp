@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "distributed/include/work_distributor.hpp"
+#include "performance/include/microbench.hpp"
+#include "runners/include/runners.hpp"
+#include "util/include/partition.hpp"
+
+// Static versus dynamic distribution of a synthetic skewed loop over all processes of the job.
+// Index i costs 1 + kMaxWork * (i / n)^2 units, so the last ranks of a block split get most of the work:
+//   block          - contiguous BlockRange() per rank
+//   cyclic         - index i on rank i % size
+//   shared_counter - WorkDistributor with the RMA fetch-and-add counter
+//   master_worker  - WorkDistributor with rank 0 serving chunks
+// Reported per strategy: wall time of the whole loop (slowest rank) for min_chunk 1 and 16.
+
+namespace {
+
+using ppc::distributed::DistributionMode;
+using ppc::performance::BenchCompilerBarrier;
+using ppc::performance::MeasureAverage;
+
+constexpr uint64_t kRepetitions = 5;
+constexpr int64_t kItems = 4096;
+constexpr int64_t kMaxWork = 100000;
+constexpr std::string_view kSuite = "load_balance";
+
+int64_t Cost(int64_t i) {
+  return 1 + (kMaxWork * i * i / (kItems * kItems));
+}
+
+/// Spins through the work units of [begin, end) and returns their number.
+int64_t Work(int64_t begin, int64_t end) {
+  int64_t units = 0;
+  for (int64_t i = begin; i < end; i++) {
+    const int64_t cost = Cost(i);
+    for (int64_t k = 0; k < cost; k++) {
+      BenchCompilerBarrier();
+    }
+    units += cost;
+  }
+  return units;
+}
+
+/// Runs one distributed loop, checks that all work was done exactly once and returns the time of one loop.
+template <typename Loop>
+double Measure(const Loop &loop) {
+  int64_t expected = 0;
+  for (int64_t i = 0; i < kItems; i++) {
+    expected += Cost(i);
+  }
+  int64_t done = 0;
+  const double sec = MeasureAverage(kRepetitions, [&] {
+    int64_t local = loop();
+    MPI_Allreduce(MPI_IN_PLACE, &local, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+    done = local;
+  });
+  EXPECT_EQ(done, expected);
+  return sec;
+}
+
+void Report(std::string_view strategy, int64_t min_chunk, double seconds) {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  if (rank == 0) {
+    ppc::performance::PrintBenchResult(kSuite, strategy, "min_chunk_" + std::to_string(min_chunk), size, seconds);
+  }
+}
+
+}  // namespace
+
+TEST(LoadBalanceBench, StaticSplits) {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  Report("block", 1, Measure([&] {
+           const auto range = ppc::util::BlockRange(kItems, size, rank);
+           return Work(range.begin, range.end);
+         }));
+  Report("cyclic", 1, Measure([&] {
+           int64_t units = 0;
+           for (int64_t i = rank; i < kItems; i += size) {
+             units += Work(i, i + 1);
+           }
+           return units;
+         }));
+}
+
+TEST(LoadBalanceBench, Dynamic) {
+  for (int64_t min_chunk : {int64_t{1}, int64_t{16}}) {
+    for (auto [mode, name] : {std::pair{DistributionMode::kSharedCounter, "shared_counter"},
+                              std::pair{DistributionMode::kMasterWorker, "master_worker"}}) {
+      Report(name, min_chunk, Measure([&] {
+               int64_t units = 0;
+               ppc::distributed::DynamicFor(
+                   MPI_COMM_WORLD, 0, kItems, [&](int64_t b, int64_t e) { units += Work(b, e); },
+                   {.mode = mode, .min_chunk = min_chunk});
+               return units;
+             }));
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  return ppc::runners::Init(argc, argv);
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "distributed/include/mpi_datatype.hpp"
+#include "util/include/partition.hpp"
+
+namespace ppc::distributed {
+
+/// @brief How the blocks of a distributed matrix are laid out over the ranks.
+enum class MatrixLayout : uint8_t {
+  /// Consecutive rows per rank (process grid size x 1)
+  kRows,
+  /// Consecutive columns per rank (process grid 1 x size)
+  kColumns,
+  /// Two-dimensional blocks on the process grid chosen by MPI_Dims_create
+  kBlocks
+};
+
+/// @brief Side of a local block, for halo neighbours.
+enum class Side : uint8_t { kTop, kBottom, kLeft, kRight };
+
+/// @brief Global shape of a matrix and the block of every rank.
+/// @details Ranks form a grid_rows x grid_cols process grid in row-major order; rank r owns the rows of
+///          RowRange(r) and the columns of ColRange(r). Ranges may be empty when there are more ranks than rows or
+///          columns.
+class MatrixDistribution {
+ public:
+  /// @brief Splits a @p rows x @p cols matrix into ppc::util::BlockRange() blocks for @p size ranks.
+  MatrixDistribution(int64_t rows, int64_t cols, MatrixLayout layout, int size);
+  /// @brief Uses the given ranges of the grid rows and the grid columns; each list must tile [0, n) in order.
+  MatrixDistribution(MatrixLayout layout, std::vector<ppc::util::IndexRange> row_ranges,
+                     std::vector<ppc::util::IndexRange> col_ranges);
+
+  [[nodiscard]] MatrixLayout GetLayout() const {
+    return layout_;
+  }
+  [[nodiscard]] int64_t GetRows() const {
+    return rows_;
+  }
+  [[nodiscard]] int64_t GetCols() const {
+    return cols_;
+  }
+  [[nodiscard]] int GetGridRows() const {
+    return static_cast<int>(row_ranges_.size());
+  }
+  [[nodiscard]] int GetGridCols() const {
+    return static_cast<int>(col_ranges_.size());
+  }
+  /// @brief Returns the number of ranks the matrix is distributed over.
+  [[nodiscard]] int GetSize() const {
+    return GetGridRows() * GetGridCols();
+  }
+
+  [[nodiscard]] ppc::util::IndexRange RowRange(int rank) const {
+    return row_ranges_.at(static_cast<std::size_t>(rank / GetGridCols()));
+  }
+  [[nodiscard]] ppc::util::IndexRange ColRange(int rank) const {
+    return col_ranges_.at(static_cast<std::size_t>(rank % GetGridCols()));
+  }
+  /// @brief Returns the rank owning global element (@p row, @p col).
+  [[nodiscard]] int Owner(int64_t row, int64_t col) const;
+  /// @brief Returns the rank owning the block next to the block of @p rank on @p side, skipping empty blocks;
+  ///        MPI_PROC_NULL at the edge of the matrix or if the block of @p rank is empty.
+  [[nodiscard]] int Neighbor(int rank, Side side) const;
+
+ private:
+  MatrixLayout layout_;
+  int64_t rows_ = 0;
+  int64_t cols_ = 0;
+  std::vector<ppc::util::IndexRange> row_ranges_;
+  std::vector<ppc::util::IndexRange> col_ranges_;
+};
+
+namespace detail {
+
+/// @brief Element-type independent part of DistributedMatrix: the local block with its halo and the MPI
+///        datatypes describing it.
+/// @details The local block is stored row-major with halo_rows ghost rows above and below and halo_cols ghost
+///          columns left and right. Every transfer is expressed with MPI_Type_create_subarray() types, so no
+///          rank packs data or computes counts and displacements. The types of the halo and of the owned part are
+///          built once at construction, the types of the root's global blocks at the first Scatter() / Gather().
+class DistributedBlock {
+ public:
+  DistributedBlock(MPI_Comm comm, MatrixDistribution distribution, int halo, MPI_Datatype type);
+
+  DistributedBlock(const DistributedBlock &) = delete;
+  DistributedBlock &operator=(const DistributedBlock &) = delete;
+
+  ~DistributedBlock();
+
+  [[nodiscard]] MPI_Comm GetComm() const {
+    return comm_;
+  }
+  [[nodiscard]] int GetRank() const {
+    return rank_;
+  }
+  [[nodiscard]] const MatrixDistribution &GetDistribution() const {
+    return distribution_;
+  }
+  [[nodiscard]] int GetHalo() const {
+    return halo_;
+  }
+  [[nodiscard]] int64_t GetHaloRows() const {
+    return halo_rows_;
+  }
+  [[nodiscard]] int64_t GetHaloCols() const {
+    return halo_cols_;
+  }
+  [[nodiscard]] int64_t GetLocalRows() const {
+    return local_rows_;
+  }
+  [[nodiscard]] int64_t GetLocalCols() const {
+    return local_cols_;
+  }
+  /// @brief Returns the distance between two local rows in elements, halo columns included.
+  [[nodiscard]] int64_t GetStride() const {
+    return local_cols_ + (2 * halo_cols_);
+  }
+  /// @brief Returns the number of stored elements, halo included.
+  [[nodiscard]] std::size_t GetStoredElements() const {
+    return static_cast<std::size_t>((local_rows_ + (2 * halo_rows_)) * GetStride());
+  }
+  /// @brief Returns the storage offset of local element (@p row, @p col); ghosts have negative or past-the-end
+  ///        local coordinates.
+  [[nodiscard]] std::size_t Offset(int64_t row, int64_t col) const {
+    return static_cast<std::size_t>(((row + halo_rows_) * GetStride()) + col + halo_cols_);
+  }
+
+  void Scatter(const void *global, void *local, int root);
+  void Gather(void *global, const void *local, int root);
+  void ExchangeHalo(void *local);
+  /// @brief Copies the owned elements of @p local into the blocks of @p target (collective).
+  void RedistributeTo(const void *local, const DistributedBlock &target, void *target_local) const;
+
+ private:
+  [[nodiscard]] bool Empty() const {
+    return local_rows_ == 0 || local_cols_ == 0;
+  }
+  /// @brief Builds a committed subarray type of the local storage of @p block; the caller frees it.
+  [[nodiscard]] MPI_Datatype LocalSubarray(const DistributedBlock &block, ppc::util::IndexRange rows,
+                                           ppc::util::IndexRange cols) const;
+  [[nodiscard]] MPI_Datatype GlobalBlockType(int rank);
+
+  MPI_Comm comm_ = MPI_COMM_NULL;
+  int rank_ = 0;
+  MatrixDistribution distribution_;
+  int halo_;
+  int64_t halo_rows_ = 0;
+  int64_t halo_cols_ = 0;
+  int64_t local_rows_ = 0;
+  int64_t local_cols_ = 0;
+  MPI_Datatype type_;
+  MPI_Datatype owned_type_ = MPI_DATATYPE_NULL;
+  // Indexed by Side: the owned cells sent to that neighbour and the ghost cells received from it
+  std::array<MPI_Datatype, 4> halo_send_types_{MPI_DATATYPE_NULL, MPI_DATATYPE_NULL, MPI_DATATYPE_NULL,
+                                               MPI_DATATYPE_NULL};
+  std::array<MPI_Datatype, 4> halo_recv_types_{MPI_DATATYPE_NULL, MPI_DATATYPE_NULL, MPI_DATATYPE_NULL,
+                                               MPI_DATATYPE_NULL};
+  std::array<int, 4> neighbors_{MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL};
+  std::vector<MPI_Datatype> global_block_types_;
+};
+
+}  // namespace detail
+
+template <MpiScalar T>
+/// @brief Matrix distributed over the ranks of a communicator in row, column or 2D blocks.
+/// @details Every rank stores its block and, with @p halo > 0, ghost cells around it: halo rows for kRows,
+///          halo columns for kColumns and both (corners included) for kBlocks. Elements are addressed with local
+///          coordinates relative to the first owned element, so ghosts have negative or past-the-end coordinates.
+///          Construction, Scatter(), Gather(), ExchangeHalo(), Redistribute() and destruction are collective.
+class DistributedMatrix {
+ public:
+  DistributedMatrix(MPI_Comm comm, int64_t rows, int64_t cols, MatrixLayout layout, int halo = 0)
+      : DistributedMatrix(comm, MatrixDistribution(rows, cols, layout, CommSize(comm)), halo) {}
+
+  DistributedMatrix(MPI_Comm comm, MatrixDistribution distribution, int halo = 0)
+      : block_(std::make_unique<detail::DistributedBlock>(comm, std::move(distribution), halo, MpiDatatype<T>())),
+        data_(block_->GetStoredElements()) {}
+
+  [[nodiscard]] const MatrixDistribution &GetDistribution() const {
+    return block_->GetDistribution();
+  }
+  [[nodiscard]] int64_t GetRows() const {
+    return GetDistribution().GetRows();
+  }
+  [[nodiscard]] int64_t GetCols() const {
+    return GetDistribution().GetCols();
+  }
+  /// @brief Returns the global rows owned by the calling rank.
+  [[nodiscard]] ppc::util::IndexRange GetRowRange() const {
+    return GetDistribution().RowRange(block_->GetRank());
+  }
+  /// @brief Returns the global columns owned by the calling rank.
+  [[nodiscard]] ppc::util::IndexRange GetColRange() const {
+    return GetDistribution().ColRange(block_->GetRank());
+  }
+  [[nodiscard]] int64_t GetLocalRows() const {
+    return block_->GetLocalRows();
+  }
+  [[nodiscard]] int64_t GetLocalCols() const {
+    return block_->GetLocalCols();
+  }
+  /// @brief Returns the distance between two local rows in elements, halo columns included.
+  [[nodiscard]] int64_t GetStride() const {
+    return block_->GetStride();
+  }
+  [[nodiscard]] int Owner(int64_t row, int64_t col) const {
+    return GetDistribution().Owner(row, col);
+  }
+  /// @brief Returns the rank whose block borders the local block on @p side, or MPI_PROC_NULL.
+  [[nodiscard]] int Neighbor(Side side) const {
+    return GetDistribution().Neighbor(block_->GetRank(), side);
+  }
+
+  /// @brief Returns local element (@p row, @p col); the owned elements are [0, GetLocalRows()) x
+  ///        [0, GetLocalCols()).
+  T &operator()(int64_t row, int64_t col) {
+    return data_[block_->Offset(row, col)];
+  }
+  const T &operator()(int64_t row, int64_t col) const {
+    return data_[block_->Offset(row, col)];
+  }
+  /// @brief Returns the local storage, halo included.
+  [[nodiscard]] std::span<T> Storage() {
+    return data_;
+  }
+  [[nodiscard]] std::span<const T> Storage() const {
+    return data_;
+  }
+
+  /// @brief Distributes the row-major @p global matrix held by @p root; @p global is ignored on other ranks.
+  void Scatter(std::span<const T> global, int root = 0) {
+    if (block_->GetRank() == root && std::cmp_not_equal(global.size(), GetRows() * GetCols())) {
+      throw std::invalid_argument("DistributedMatrix::Scatter: global matrix has the wrong size");
+    }
+    block_->Scatter(global.data(), data_.data(), root);
+  }
+
+  /// @brief Collects the whole matrix row-major on @p root; other ranks get an empty vector.
+  [[nodiscard]] std::vector<T> Gather(int root = 0) const {
+    std::vector<T> global(block_->GetRank() == root ? static_cast<std::size_t>(GetRows() * GetCols()) : 0);
+    block_->Gather(global.data(), data_.data(), root);
+    return global;
+  }
+
+  /// @brief Fills the ghost cells with the owned cells of the neighbouring blocks.
+  void ExchangeHalo() {
+    block_->ExchangeHalo(data_.data());
+  }
+
+  /// @brief Returns a copy of the matrix distributed with @p distribution, e.g. to switch from rows to blocks.
+  [[nodiscard]] DistributedMatrix Redistribute(MatrixDistribution distribution, int halo = 0) const {
+    DistributedMatrix target(block_->GetComm(), std::move(distribution), halo);
+    block_->RedistributeTo(data_.data(), *target.block_, target.data_.data());
+    return target;
+  }
+  [[nodiscard]] DistributedMatrix Redistribute(MatrixLayout layout, int halo = 0) const {
+    return Redistribute(MatrixDistribution(GetRows(), GetCols(), layout, GetDistribution().GetSize()), halo);
+  }
+
+ private:
+  static int CommSize(MPI_Comm comm) {
+    int size = 1;
+    MPI_Comm_size(comm, &size);
+    return size;
+  }
+
+  std::unique_ptr<detail::DistributedBlock> block_;
+  std::vector<T> data_;
+};
+
+}  // namespace ppc::distributed
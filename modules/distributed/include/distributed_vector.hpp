@@ -0,0 +1,96 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "distributed/include/distributed_matrix.hpp"
+#include "distributed/include/mpi_datatype.hpp"
+#include "util/include/partition.hpp"
+
+namespace ppc::distributed {
+
+template <MpiScalar T>
+/// @brief Vector distributed over the ranks of a communicator in contiguous ranges, with optional ghost elements.
+/// @details Stored as a 1 x n DistributedMatrix with a column layout, so it shares the datatype-based scatter,
+///          gather, halo exchange and redistribution. Local index 0 is the first owned element; with @p halo > 0
+///          the ghosts are at [-halo, 0) and [GetLocalSize(), GetLocalSize() + halo). All operations except the
+///          accessors are collective.
+class DistributedVector {
+ public:
+  /// @brief Distributes @p size elements with ppc::util::BlockRange().
+  DistributedVector(MPI_Comm comm, int64_t size, int halo = 0)
+      : matrix_(comm, 1, size, MatrixLayout::kColumns, halo) {}
+
+  /// @brief Gives rank r the elements of @p ranges[r], e.g. from ppc::util::WeightedRanges().
+  DistributedVector(MPI_Comm comm, std::vector<ppc::util::IndexRange> ranges, int halo = 0)
+      : matrix_(comm, MakeDistribution(std::move(ranges)), halo) {}
+
+  [[nodiscard]] int64_t GetGlobalSize() const {
+    return matrix_.GetCols();
+  }
+  /// @brief Returns the global indices owned by the calling rank.
+  [[nodiscard]] ppc::util::IndexRange GetLocalRange() const {
+    return matrix_.GetColRange();
+  }
+  [[nodiscard]] int64_t GetLocalSize() const {
+    return matrix_.GetLocalCols();
+  }
+  [[nodiscard]] int Owner(int64_t index) const {
+    return matrix_.Owner(0, index);
+  }
+  /// @brief Returns the rank owning the elements before (@p before) or after the local ones, or MPI_PROC_NULL.
+  [[nodiscard]] int Neighbor(bool before) const {
+    return matrix_.Neighbor(before ? Side::kLeft : Side::kRight);
+  }
+
+  T &operator[](int64_t local_index) {
+    return matrix_(0, local_index);
+  }
+  const T &operator[](int64_t local_index) const {
+    return matrix_(0, local_index);
+  }
+  /// @brief Returns the owned elements.
+  [[nodiscard]] std::span<T> Local() {
+    return matrix_.Storage().subspan(Halo(), static_cast<std::size_t>(GetLocalSize()));
+  }
+  [[nodiscard]] std::span<const T> Local() const {
+    return matrix_.Storage().subspan(Halo(), static_cast<std::size_t>(GetLocalSize()));
+  }
+
+  /// @brief Distributes @p global held by @p root; @p global is ignored on other ranks.
+  void Scatter(std::span<const T> global, int root = 0) {
+    matrix_.Scatter(global, root);
+  }
+  /// @brief Collects the whole vector on @p root; other ranks get an empty vector.
+  [[nodiscard]] std::vector<T> Gather(int root = 0) const {
+    return matrix_.Gather(root);
+  }
+  /// @brief Fills the ghost elements with the owned elements of the neighbouring ranks.
+  void ExchangeHalo() {
+    matrix_.ExchangeHalo();
+  }
+  /// @brief Returns a copy distributed by @p ranges (one per rank), e.g. to rebalance after the costs changed.
+  [[nodiscard]] DistributedVector Redistribute(std::vector<ppc::util::IndexRange> ranges, int halo = 0) const {
+    return DistributedVector(matrix_.Redistribute(MakeDistribution(std::move(ranges)), halo));
+  }
+
+ private:
+  explicit DistributedVector(DistributedMatrix<T> matrix) : matrix_(std::move(matrix)) {}
+
+  static MatrixDistribution MakeDistribution(std::vector<ppc::util::IndexRange> ranges) {
+    return {MatrixLayout::kColumns, {ppc::util::IndexRange{.begin = 0, .end = 1}}, std::move(ranges)};
+  }
+
+  [[nodiscard]] std::size_t Halo() const {
+    return static_cast<std::size_t>((matrix_.GetStride() - GetLocalSize()) / 2);
+  }
+
+  DistributedMatrix<T> matrix_;
+};
+
+}  // namespace ppc::distributed
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <concepts>
+#include <type_traits>
+
+namespace ppc::distributed {
+
+/// @brief Element types with a predefined MPI datatype.
+template <typename T>
+concept MpiScalar = std::is_arithmetic_v<T>;
+
+template <MpiScalar T>
+/// @brief Returns the predefined MPI datatype of @p T.
+/// @details Integers are mapped by size and signedness, so int, long and long long all work regardless of which
+///          of them the fixed-width aliases refer to.
+MPI_Datatype MpiDatatype() {
+  if constexpr (std::same_as<T, bool>) {
+    return MPI_CXX_BOOL;
+  } else if constexpr (std::same_as<T, float>) {
+    return MPI_FLOAT;
+  } else if constexpr (std::same_as<T, double>) {
+    return MPI_DOUBLE;
+  } else if constexpr (std::same_as<T, long double>) {
+    return MPI_LONG_DOUBLE;
+  } else if constexpr (sizeof(T) == 1) {
+    return std::is_signed_v<T> ? MPI_INT8_T : MPI_UINT8_T;
+  } else if constexpr (sizeof(T) == 2) {
+    return std::is_signed_v<T> ? MPI_INT16_T : MPI_UINT16_T;
+  } else if constexpr (sizeof(T) == 4) {
+    return std::is_signed_v<T> ? MPI_INT32_T : MPI_UINT32_T;
+  } else {
+    static_assert(sizeof(T) == 8, "Unsupported integer size");
+    return std::is_signed_v<T> ? MPI_INT64_T : MPI_UINT64_T;
+  }
+}
+
+}  // namespace ppc::distributed
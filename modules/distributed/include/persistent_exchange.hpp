@@ -0,0 +1,96 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ppc::distributed {
+
+/// @brief Fixed set of point-to-point messages (e.g. a halo exchange) registered once as persistent requests and
+///        restarted every iteration.
+/// @details AddSend() and AddRecv() bind buffers, peers and tags with MPI_Send_init / MPI_Recv_init, so the
+///          argument checking and matching setup of MPI_Isend / MPI_Irecv is paid once instead of every iteration.
+///          Start() then fires all messages with a single MPI_Startall and Wait() completes them. The buffers are
+///          captured by address: they must stay in place for the lifetime of the exchange, and their contents are
+///          read / written by every Start() ... Wait() round. Peers may be MPI_PROC_NULL, e.g. beyond the edge of
+///          a non-periodic domain.
+///
+///          The exchange runs on a private duplicate of the communicator, so its tags cannot match messages of the
+///          task itself. Construction and destruction are collective.
+class PersistentExchange {
+ public:
+  explicit PersistentExchange(MPI_Comm comm);
+
+  PersistentExchange(const PersistentExchange &) = delete;
+  PersistentExchange &operator=(const PersistentExchange &) = delete;
+
+  ~PersistentExchange();
+
+  /// @brief Registers the send of @p count elements of @p type at @p buffer to @p dest.
+  void AddSend(const void *buffer, int count, MPI_Datatype type, int dest, int tag);
+  /// @brief Registers the receive of @p count elements of @p type into @p buffer from @p source.
+  void AddRecv(void *buffer, int count, MPI_Datatype type, int source, int tag);
+
+  /// @brief Starts all registered messages; throws std::logic_error if the previous round is still active.
+  void Start();
+  /// @brief Blocks until all messages of the current round completed; does nothing if no round is active.
+  void Wait();
+  /// @brief Checks without blocking whether all messages of the current round completed.
+  /// @return True when no round is active any more.
+  bool Test();
+
+  [[nodiscard]] bool IsActive() const {
+    return active_;
+  }
+  /// @brief Returns the number of registered messages.
+  [[nodiscard]] std::size_t Size() const {
+    return requests_.size();
+  }
+
+ private:
+  void CheckInactive() const;
+
+  MPI_Comm comm_ = MPI_COMM_NULL;
+  std::vector<MPI_Request> requests_;
+  bool active_ = false;
+};
+
+template <typename Interior, typename Boundary>
+/// @brief One overlapped iteration: starts @p exchange, computes @p interior() while the messages are in flight,
+///        waits and computes @p boundary(), which may read the received data.
+/// @details @p interior must neither read the receive buffers nor write the send buffers of the exchange.
+void OverlappedStep(PersistentExchange &exchange, const Interior &interior, const Boundary &boundary) {
+  exchange.Start();
+  interior();
+  exchange.Wait();
+  boundary();
+}
+
+/// @brief Pair of persistent exchanges for double-buffered iterations, where iteration t reads buffer t % 2 and
+///        writes buffer (t + 1) % 2.
+/// @details Persistent requests are bound to fixed addresses, so swapping the buffers needs one exchange per
+///          buffer: register the messages of buffer b on Buffer(b), then call Step(t, ...) every iteration.
+///          Construction and destruction are collective.
+class DoubleBufferedExchange {
+ public:
+  explicit DoubleBufferedExchange(MPI_Comm comm) : exchanges_{PersistentExchange(comm), PersistentExchange(comm)} {}
+
+  /// @brief Returns the exchange of buffer @p parity (0 or 1).
+  PersistentExchange &Buffer(int parity) {
+    return exchanges_.at(static_cast<std::size_t>(parity));
+  }
+
+  template <typename Interior, typename Boundary>
+  /// @brief Runs OverlappedStep() on the exchange of the buffer read in iteration @p iteration.
+  void Step(int64_t iteration, const Interior &interior, const Boundary &boundary) {
+    OverlappedStep(exchanges_.at(static_cast<std::size_t>(iteration % 2)), interior, boundary);
+  }
+
+ private:
+  std::array<PersistentExchange, 2> exchanges_;
+};
+
+}  // namespace ppc::distributed
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "distributed/include/mpi_datatype.hpp"
+#include "parallel/include/algorithms.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "parallel/include/sort.hpp"
+#include "task/include/task.hpp"
+
+namespace ppc::distributed {
+
+/// @brief Default number of samples every rank contributes to the splitter selection of SampleSort().
+inline constexpr int kSampleSortOversampling = 64;
+
+template <ppc::task::TypeOfTask kBackend, MpiScalar T>
+/// @brief Sorts keys distributed over the ranks of @p comm; collective.
+/// @details Every rank sorts its keys locally with @p policy (RadixSort() for integers, Sort() otherwise) and
+///          picks @p oversampling evenly spaced samples. The samples of all ranks are gathered and sorted, and
+///          every (samples / size)-th one becomes a splitter. Each rank then cuts its sorted keys at the
+///          splitters, sends piece r to rank r with one MPI_Alltoallv and merges the received sorted pieces with
+///          MergeRuns(). Because the samples are evenly spaced in sorted data (regular sampling), no rank receives
+///          more than about twice its share of distinct keys; more samples bring the pieces closer to equal at the
+///          price of a larger MPI_Allgatherv. All keys equal to a splitter go to the same rank, so heavily repeated
+///          keys can still unbalance the result.
+/// @param keys Keys of this rank, any number including none.
+/// @return The keys of this rank after sorting: sorted, and not greater than any key of a higher rank.
+std::vector<T> SampleSort(const ppc::parallel::ExecutionPolicy<kBackend> &policy, MPI_Comm comm, std::vector<T> keys,
+                          int oversampling = kSampleSortOversampling) {
+  if constexpr (ppc::parallel::RadixKey<T>) {
+    ppc::parallel::RadixSort(policy, keys.begin(), keys.end());
+  } else {
+    ppc::parallel::Sort(policy, keys.begin(), keys.end());
+  }
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  if (size == 1) {
+    return keys;
+  }
+
+  const auto n = static_cast<int64_t>(keys.size());
+  const int64_t sample_count = std::min<int64_t>(std::max(oversampling, 1), n);
+  std::vector<T> samples;
+  for (int64_t i = 0; i < sample_count; i++) {
+    samples.push_back(keys[static_cast<std::size_t>(((i + 1) * n) / (sample_count + 1))]);
+  }
+  std::vector<int> sample_counts(static_cast<std::size_t>(size));
+  auto local_samples = static_cast<int>(sample_count);
+  MPI_Allgather(&local_samples, 1, MPI_INT, sample_counts.data(), 1, MPI_INT, comm);
+  std::vector<int> sample_displs(static_cast<std::size_t>(size), 0);
+  for (std::size_t rank = 1; rank < sample_displs.size(); rank++) {
+    sample_displs[rank] = sample_displs[rank - 1] + sample_counts[rank - 1];
+  }
+  std::vector<T> all_samples(static_cast<std::size_t>(sample_displs.back() + sample_counts.back()));
+  MPI_Allgatherv(samples.data(), local_samples, MpiDatatype<T>(), all_samples.data(), sample_counts.data(),
+                 sample_displs.data(), MpiDatatype<T>(), comm);
+  if (all_samples.empty()) {
+    return keys;
+  }
+  std::ranges::sort(all_samples);
+
+  // Piece r holds the keys in (splitter r - 1, splitter r]
+  std::vector<int> send_counts(static_cast<std::size_t>(size), 0);
+  auto piece_begin = keys.begin();
+  for (int rank = 0; rank < size; rank++) {
+    auto piece_end = keys.end();
+    if (rank + 1 < size) {
+      const auto splitter = all_samples[((static_cast<std::size_t>(rank) + 1) * all_samples.size()) / size];
+      piece_end = std::upper_bound(piece_begin, keys.end(), splitter);
+    }
+    send_counts[static_cast<std::size_t>(rank)] = static_cast<int>(piece_end - piece_begin);
+    piece_begin = piece_end;
+  }
+  std::vector<int> recv_counts(static_cast<std::size_t>(size));
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+  std::vector<int> send_displs(static_cast<std::size_t>(size), 0);
+  std::vector<int> recv_displs(static_cast<std::size_t>(size), 0);
+  for (std::size_t rank = 1; rank < send_displs.size(); rank++) {
+    send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+    recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+  }
+  std::vector<T> received(static_cast<std::size_t>(recv_displs.back() + recv_counts.back()));
+  MPI_Alltoallv(keys.data(), send_counts.data(), send_displs.data(), MpiDatatype<T>(), received.data(),
+                recv_counts.data(), recv_displs.data(), MpiDatatype<T>(), comm);
+
+  std::vector<int64_t> bounds(recv_displs.begin(), recv_displs.end());
+  bounds.push_back(static_cast<int64_t>(received.size()));
+  ppc::parallel::MergeRuns(policy, received.begin(), received.end(), std::move(bounds));
+  return received;
+}
+
+}  // namespace ppc::distributed
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace ppc::distributed {
+
+/// @brief Two-level view of a communicator: the ranks sharing a node and the leaders (node rank 0) of all nodes.
+/// @details Built with MPI_Comm_split_type(MPI_COMM_TYPE_SHARED). Construction and destruction are collective.
+class NodeTopology {
+ public:
+  explicit NodeTopology(MPI_Comm comm);
+
+  NodeTopology(const NodeTopology &) = delete;
+  NodeTopology &operator=(const NodeTopology &) = delete;
+
+  ~NodeTopology();
+
+  /// @brief Returns the communicator the topology was built from.
+  [[nodiscard]] MPI_Comm GetComm() const {
+    return comm_;
+  }
+  /// @brief Returns the communicator of the ranks on the calling rank's node.
+  [[nodiscard]] MPI_Comm GetNodeComm() const {
+    return node_comm_;
+  }
+  /// @brief Returns the communicator of the node leaders; MPI_COMM_NULL on ranks that are not leaders.
+  [[nodiscard]] MPI_Comm GetLeaderComm() const {
+    return leader_comm_;
+  }
+  [[nodiscard]] int GetNodeRank() const {
+    return node_rank_;
+  }
+  [[nodiscard]] int GetNodeSize() const {
+    return node_size_;
+  }
+  /// @brief Returns the index of the calling rank's node, i.e. the rank of its leader in the leader communicator.
+  [[nodiscard]] int GetNodeIndex() const {
+    return node_index_;
+  }
+  [[nodiscard]] int GetNumNodes() const {
+    return num_nodes_;
+  }
+  [[nodiscard]] bool IsLeader() const {
+    return node_rank_ == 0;
+  }
+
+ private:
+  MPI_Comm comm_;
+  MPI_Comm node_comm_ = MPI_COMM_NULL;
+  MPI_Comm leader_comm_ = MPI_COMM_NULL;
+  int node_rank_ = 0;
+  int node_size_ = 1;
+  int node_index_ = 0;
+  int num_nodes_ = 1;
+};
+
+namespace detail {
+
+/// @brief MPI_Bcast of @p bytes bytes, split into pieces whose count fits into an int.
+void BroadcastBytes(void *data, std::size_t bytes, int root, MPI_Comm comm);
+
+}  // namespace detail
+
+template <typename T>
+/// @brief Array stored once per node in an MPI-3 shared-memory window and mapped into every rank of the node.
+/// @details The node leader allocates the whole array, the other ranks of the node access it through
+///          MPI_Win_shared_query() without a copy. Writes become visible to the other ranks of the node after
+///          Publish(). Construction and destruction are collective over the node communicator of the topology.
+/// @tparam T Trivially copyable element type.
+class SharedArray {
+  static_assert(std::is_trivially_copyable_v<T>, "SharedArray requires a trivially copyable element type");
+
+ public:
+  /// @brief Allocates @p size elements on the node leader; @p size must be the same on all ranks of the node.
+  SharedArray(const NodeTopology &topology, std::size_t size) : node_comm_(topology.GetNodeComm()), size_(size) {
+    const auto bytes = static_cast<MPI_Aint>(topology.IsLeader() ? size * sizeof(T) : 0);
+    void *base = nullptr;
+    MPI_Win_allocate_shared(bytes, static_cast<int>(sizeof(T)), MPI_INFO_NULL, node_comm_, &base, &window_);
+    MPI_Aint leader_bytes = 0;
+    int disp_unit = 0;
+    MPI_Win_shared_query(window_, 0, &leader_bytes, &disp_unit, static_cast<void *>(&data_));
+    // Passive epoch for the whole lifetime, so Publish() can use MPI_Win_sync
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+  }
+
+  SharedArray(const SharedArray &) = delete;
+  SharedArray &operator=(const SharedArray &) = delete;
+
+  SharedArray(SharedArray &&other) noexcept
+      : node_comm_(other.node_comm_),
+        window_(std::exchange(other.window_, MPI_WIN_NULL)),
+        data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  SharedArray &operator=(SharedArray &&other) noexcept {
+    if (this != &other) {
+      Free();
+      node_comm_ = other.node_comm_;
+      window_ = std::exchange(other.window_, MPI_WIN_NULL);
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  ~SharedArray() {
+    Free();
+  }
+
+  /// @brief Makes the writes of every rank of the node visible to all ranks of the node (collective on the node).
+  void Publish() {
+    MPI_Win_sync(window_);
+    MPI_Barrier(node_comm_);
+    MPI_Win_sync(window_);
+  }
+
+  [[nodiscard]] T *Data() noexcept {
+    return data_;
+  }
+  [[nodiscard]] const T *Data() const noexcept {
+    return data_;
+  }
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return size_;
+  }
+  [[nodiscard]] std::span<T> Span() noexcept {
+    return {data_, size_};
+  }
+  [[nodiscard]] std::span<const T> Span() const noexcept {
+    return {data_, size_};
+  }
+  T &operator[](std::size_t i) noexcept {
+    return data_[i];
+  }
+  const T &operator[](std::size_t i) const noexcept {
+    return data_[i];
+  }
+
+ private:
+  void Free() noexcept {
+    if (window_ != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(window_);
+      MPI_Win_free(&window_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  MPI_Comm node_comm_;
+  MPI_Win window_ = MPI_WIN_NULL;
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+template <typename T>
+/// @brief Makes the data of rank @p root available to all ranks with one copy per node (collective).
+/// @details The root writes its data straight into the shared array of its node, the node leaders broadcast it
+///          to the other nodes and every rank maps its node's copy. Compared with MPI_Bcast to every rank this
+///          keeps one copy per node in memory and sends the data only between nodes.
+/// @param data Data to share; only read on @p root.
+/// @return Node-shared array holding the data on every rank.
+SharedArray<T> ShareFromRoot(const NodeTopology &topology, std::span<const T> data, int root = 0) {
+  MPI_Comm comm = topology.GetComm();
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  // Size of the data and node of the root, both known on the root only
+  std::array<int64_t, 2> header = {static_cast<int64_t>(data.size()), topology.GetNodeIndex()};
+  MPI_Bcast(header.data(), 2, MPI_INT64_T, root, comm);
+  const auto size = static_cast<std::size_t>(header[0]);
+  const auto root_node = static_cast<int>(header[1]);
+
+  SharedArray<T> shared(topology, size);
+  if (rank == root) {
+    std::copy(data.begin(), data.end(), shared.Data());
+  }
+  shared.Publish();
+  if (topology.IsLeader() && topology.GetNumNodes() > 1) {
+    detail::BroadcastBytes(static_cast<void *>(shared.Data()), size * sizeof(T), root_node, topology.GetLeaderComm());
+  }
+  shared.Publish();
+  return shared;
+}
+
+}  // namespace ppc::distributed
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "util/include/partition.hpp"
+
+namespace ppc::distributed {
+
+/// @brief How a WorkDistributor hands out chunks.
+enum class DistributionMode : uint8_t {
+  /// Every rank takes chunks itself with an MPI-3 RMA atomic fetch-and-add on a counter hosted by rank 0
+  kSharedCounter,
+  /// Rank 0 only answers chunk requests of the other ranks (point-to-point); it computes alone if it is alone
+  kMasterWorker
+};
+
+/// @brief Parameters of a WorkDistributor.
+struct DistributionOptions {
+  DistributionMode mode = DistributionMode::kSharedCounter;
+  /// Smallest chunk handed out; raise it when a single index is too cheap to be worth one round trip
+  int64_t min_chunk = 1;
+};
+
+/// @brief Dynamic load balancer distributing the index range [begin, end) over the ranks of a communicator.
+/// @details Chunks follow the guided sequence of ppc::util::GuidedRanges() with one part per rank: the first
+///          chunks are remaining / size indices large and later chunks shrink down to min_chunk, so ranks that got
+///          cheap indices come back for more while stragglers finish their last small chunk. All ranks compute
+///          the same chunk sequence locally, so taking a chunk only has to agree on a chunk number. In the
+///          shared-counter mode that is a single MPI_Fetch_and_op on rank 0's window, which needs no progress
+///          from rank 0 and keeps rank 0 computing. In the master/worker mode rank 0 serves the chunk numbers
+///          with point-to-point messages instead, which works with MPI libraries whose passive-target RMA is slow.
+///
+///          Construction and destruction are collective over the communicator. Every rank must call Next() until
+///          it returns false.
+class WorkDistributor {
+ public:
+  WorkDistributor(MPI_Comm comm, int64_t begin, int64_t end, const DistributionOptions &options = {});
+
+  WorkDistributor(const WorkDistributor &) = delete;
+  WorkDistributor &operator=(const WorkDistributor &) = delete;
+
+  ~WorkDistributor();
+
+  /// @brief Takes the next chunk for the calling rank.
+  /// @param range Receives the chunk.
+  /// @return False when no work is left for this rank; the master of kMasterWorker returns false once every
+  ///         worker has been told so.
+  bool Next(ppc::util::IndexRange &range);
+
+  /// @brief Returns the number of chunks the calling rank has taken so far.
+  [[nodiscard]] int64_t GetChunksTaken() const {
+    return chunks_taken_;
+  }
+
+  /// @brief Returns the whole chunk sequence shared by all ranks.
+  [[nodiscard]] const std::vector<ppc::util::IndexRange> &GetChunks() const {
+    return chunks_;
+  }
+
+ private:
+  int64_t TakeTicket();
+  void Serve();
+
+  MPI_Comm comm_;
+  DistributionMode mode_;
+  int rank_ = 0;
+  int size_ = 1;
+  std::vector<ppc::util::IndexRange> chunks_;
+  int64_t chunks_taken_ = 0;
+  bool done_ = false;
+  // kSharedCounter
+  MPI_Win window_ = MPI_WIN_NULL;
+  // kMasterWorker, on rank 0
+  int64_t next_ticket_ = 0;
+  int active_workers_ = 0;
+};
+
+template <typename Body>
+/// @brief Collective dynamic loop: calls @p body(b, e) for the chunks of [@p begin, @p end) this rank receives.
+/// @details Meant for the RunImpl() of kMPI tasks with irregular per-index cost. Each index is processed by exactly
+///          one rank; combine the partial results afterwards, e.g. with MPI_Allreduce.
+void DynamicFor(MPI_Comm comm, int64_t begin, int64_t end, const Body &body, const DistributionOptions &options = {}) {
+  WorkDistributor distributor(comm, begin, end, options);
+  ppc::util::IndexRange range;
+  while (distributor.Next(range)) {
+    body(range.begin, range.end);
+  }
+}
+
+}  // namespace ppc::distributed
@@ -0,0 +1,330 @@
+#include "distributed/include/distributed_matrix.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "util/include/partition.hpp"
+
+namespace ppc::distributed {
+
+namespace {
+
+constexpr int kScatterTag = 1;
+constexpr int kGatherTag = 2;
+
+std::vector<ppc::util::IndexRange> BlockRanges(int64_t n, int parts) {
+  std::vector<ppc::util::IndexRange> ranges(static_cast<std::size_t>(parts));
+  for (int part = 0; part < parts; part++) {
+    ranges[static_cast<std::size_t>(part)] = ppc::util::BlockRange(n, parts, part);
+  }
+  return ranges;
+}
+
+std::array<int, 2> GridShape(MatrixLayout layout, int size) {
+  if (layout == MatrixLayout::kRows) {
+    return {size, 1};
+  }
+  if (layout == MatrixLayout::kColumns) {
+    return {1, size};
+  }
+  std::array<int, 2> dims = {0, 0};
+  MPI_Dims_create(size, 2, dims.data());
+  return dims;
+}
+
+/// Returns the end of the ranges after checking that they tile [0, end) in order.
+int64_t CheckTiling(const std::vector<ppc::util::IndexRange> &ranges) {
+  if (ranges.empty()) {
+    throw std::invalid_argument("MatrixDistribution needs at least one range per dimension");
+  }
+  int64_t end = 0;
+  for (const auto &range : ranges) {
+    if (range.begin != end || range.end < range.begin) {
+      throw std::invalid_argument("MatrixDistribution ranges must tile [0, n) in order");
+    }
+    end = range.end;
+  }
+  return end;
+}
+
+/// Index of the range containing @p index; empty ranges never contain anything.
+int FindRange(const std::vector<ppc::util::IndexRange> &ranges, int64_t index) {
+  const auto it = std::ranges::upper_bound(ranges, index, {}, &ppc::util::IndexRange::end);
+  if (index < 0 || it == ranges.end()) {
+    throw std::out_of_range("MatrixDistribution: index outside of the matrix");
+  }
+  return static_cast<int>(it - ranges.begin());
+}
+
+/// Nearest non-empty range next to range @p from in direction @p step, or -1.
+int NextNonEmpty(const std::vector<ppc::util::IndexRange> &ranges, int from, int step) {
+  for (int i = from + step; i >= 0 && std::cmp_less(i, ranges.size()); i += step) {
+    if (!ranges[static_cast<std::size_t>(i)].Empty()) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int ToInt(int64_t value) {
+  if (value > INT_MAX) {
+    throw std::invalid_argument("DistributedMatrix: dimensions must fit into an int for MPI subarray types");
+  }
+  return static_cast<int>(value);
+}
+
+ppc::util::IndexRange Intersect(ppc::util::IndexRange a, ppc::util::IndexRange b) {
+  return {.begin = std::max(a.begin, b.begin), .end = std::max(std::max(a.begin, b.begin), std::min(a.end, b.end))};
+}
+
+MPI_Datatype Subarray(std::array<int64_t, 2> sizes, std::array<int64_t, 2> subsizes, std::array<int64_t, 2> starts,
+                      MPI_Datatype type) {
+  const std::array<int, 2> int_sizes = {ToInt(sizes[0]), ToInt(sizes[1])};
+  const std::array<int, 2> int_subsizes = {ToInt(subsizes[0]), ToInt(subsizes[1])};
+  const std::array<int, 2> int_starts = {ToInt(starts[0]), ToInt(starts[1])};
+  MPI_Datatype subarray = MPI_DATATYPE_NULL;
+  MPI_Type_create_subarray(2, int_sizes.data(), int_subsizes.data(), int_starts.data(), MPI_ORDER_C, type, &subarray);
+  MPI_Type_commit(&subarray);
+  return subarray;
+}
+
+void FreeType(MPI_Datatype &type) {
+  if (type != MPI_DATATYPE_NULL) {
+    MPI_Type_free(&type);
+  }
+}
+
+}  // namespace
+
+MatrixDistribution::MatrixDistribution(int64_t rows, int64_t cols, MatrixLayout layout, int size)
+    : MatrixDistribution(layout, BlockRanges(rows, GridShape(layout, size)[0]),
+                         BlockRanges(cols, GridShape(layout, size)[1])) {}
+
+MatrixDistribution::MatrixDistribution(MatrixLayout layout, std::vector<ppc::util::IndexRange> row_ranges,
+                                       std::vector<ppc::util::IndexRange> col_ranges)
+    : layout_(layout), row_ranges_(std::move(row_ranges)), col_ranges_(std::move(col_ranges)) {
+  rows_ = CheckTiling(row_ranges_);
+  cols_ = CheckTiling(col_ranges_);
+}
+
+int MatrixDistribution::Owner(int64_t row, int64_t col) const {
+  return (FindRange(row_ranges_, row) * GetGridCols()) + FindRange(col_ranges_, col);
+}
+
+int MatrixDistribution::Neighbor(int rank, Side side) const {
+  if (RowRange(rank).Empty() || ColRange(rank).Empty()) {
+    return MPI_PROC_NULL;
+  }
+  const int grid_row = rank / GetGridCols();
+  const int grid_col = rank % GetGridCols();
+  if (side == Side::kTop || side == Side::kBottom) {
+    const int row = NextNonEmpty(row_ranges_, grid_row, side == Side::kTop ? -1 : 1);
+    return row < 0 ? MPI_PROC_NULL : (row * GetGridCols()) + grid_col;
+  }
+  const int col = NextNonEmpty(col_ranges_, grid_col, side == Side::kLeft ? -1 : 1);
+  return col < 0 ? MPI_PROC_NULL : (grid_row * GetGridCols()) + col;
+}
+
+namespace detail {
+
+DistributedBlock::DistributedBlock(MPI_Comm comm, MatrixDistribution distribution, int halo, MPI_Datatype type)
+    : distribution_(std::move(distribution)), halo_(halo), type_(type) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  if (size != distribution_.GetSize()) {
+    throw std::invalid_argument("DistributedMatrix: the distribution does not match the communicator size");
+  }
+  if (halo < 0) {
+    throw std::invalid_argument("DistributedMatrix: the halo width must not be negative");
+  }
+  const MatrixLayout layout = distribution_.GetLayout();
+  halo_rows_ = layout == MatrixLayout::kColumns ? 0 : halo;
+  halo_cols_ = layout == MatrixLayout::kRows ? 0 : halo;
+  for (int rank = 0; rank < size; rank++) {
+    const int64_t rows = distribution_.RowRange(rank).Size();
+    const int64_t cols = distribution_.ColRange(rank).Size();
+    // A thinner block could not fill the halo of its neighbour on its own
+    if ((rows > 0 && rows < halo_rows_) || (cols > 0 && cols < halo_cols_)) {
+      throw std::invalid_argument("DistributedMatrix: every non-empty block must be at least as wide as the halo");
+    }
+  }
+
+  MPI_Comm_dup(comm, &comm_);
+  MPI_Comm_rank(comm_, &rank_);
+  local_rows_ = distribution_.RowRange(rank_).Size();
+  local_cols_ = distribution_.ColRange(rank_).Size();
+  if (Empty()) {
+    return;
+  }
+
+  const std::array<int64_t, 2> storage = {local_rows_ + (2 * halo_rows_), GetStride()};
+  owned_type_ = Subarray(storage, {local_rows_, local_cols_}, {halo_rows_, halo_cols_}, type_);
+  for (Side side : {Side::kTop, Side::kBottom, Side::kLeft, Side::kRight}) {
+    neighbors_.at(static_cast<std::size_t>(side)) = distribution_.Neighbor(rank_, side);
+  }
+  if (halo_cols_ > 0) {
+    // Owned rows only; the row phase then forwards the corners along with the ghost columns
+    const std::array<int64_t, 2> strip = {local_rows_, halo_cols_};
+    halo_send_types_[static_cast<std::size_t>(Side::kLeft)] = Subarray(storage, strip, {halo_rows_, halo_cols_}, type_);
+    halo_send_types_[static_cast<std::size_t>(Side::kRight)] =
+        Subarray(storage, strip, {halo_rows_, local_cols_}, type_);
+    halo_recv_types_[static_cast<std::size_t>(Side::kLeft)] = Subarray(storage, strip, {halo_rows_, 0}, type_);
+    halo_recv_types_[static_cast<std::size_t>(Side::kRight)] =
+        Subarray(storage, strip, {halo_rows_, halo_cols_ + local_cols_}, type_);
+  }
+  if (halo_rows_ > 0) {
+    const std::array<int64_t, 2> strip = {halo_rows_, GetStride()};
+    halo_send_types_[static_cast<std::size_t>(Side::kTop)] = Subarray(storage, strip, {halo_rows_, 0}, type_);
+    halo_send_types_[static_cast<std::size_t>(Side::kBottom)] = Subarray(storage, strip, {local_rows_, 0}, type_);
+    halo_recv_types_[static_cast<std::size_t>(Side::kTop)] = Subarray(storage, strip, {0, 0}, type_);
+    halo_recv_types_[static_cast<std::size_t>(Side::kBottom)] =
+        Subarray(storage, strip, {halo_rows_ + local_rows_, 0}, type_);
+  }
+}
+
+DistributedBlock::~DistributedBlock() {
+  FreeType(owned_type_);
+  for (auto &type : halo_send_types_) {
+    FreeType(type);
+  }
+  for (auto &type : halo_recv_types_) {
+    FreeType(type);
+  }
+  for (auto &type : global_block_types_) {
+    FreeType(type);
+  }
+  MPI_Comm_free(&comm_);
+}
+
+MPI_Datatype DistributedBlock::GlobalBlockType(int rank) {
+  if (global_block_types_.empty()) {
+    global_block_types_.assign(static_cast<std::size_t>(distribution_.GetSize()), MPI_DATATYPE_NULL);
+  }
+  auto &type = global_block_types_[static_cast<std::size_t>(rank)];
+  if (type == MPI_DATATYPE_NULL) {
+    const auto rows = distribution_.RowRange(rank);
+    const auto cols = distribution_.ColRange(rank);
+    type = Subarray({distribution_.GetRows(), distribution_.GetCols()}, {rows.Size(), cols.Size()},
+                    {rows.begin, cols.begin}, type_);
+  }
+  return type;
+}
+
+void DistributedBlock::Scatter(const void *global, void *local, int root) {
+  std::vector<MPI_Request> requests;
+  if (!Empty()) {
+    requests.emplace_back();
+    MPI_Irecv(local, 1, owned_type_, root, kScatterTag, comm_, &requests.back());
+  }
+  if (rank_ == root) {
+    for (int rank = 0; rank < distribution_.GetSize(); rank++) {
+      if (distribution_.RowRange(rank).Empty() || distribution_.ColRange(rank).Empty()) {
+        continue;
+      }
+      requests.emplace_back();
+      MPI_Isend(global, 1, GlobalBlockType(rank), rank, kScatterTag, comm_, &requests.back());
+    }
+  }
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+void DistributedBlock::Gather(void *global, const void *local, int root) {
+  std::vector<MPI_Request> requests;
+  if (rank_ == root) {
+    for (int rank = 0; rank < distribution_.GetSize(); rank++) {
+      if (distribution_.RowRange(rank).Empty() || distribution_.ColRange(rank).Empty()) {
+        continue;
+      }
+      requests.emplace_back();
+      MPI_Irecv(global, 1, GlobalBlockType(rank), rank, kGatherTag, comm_, &requests.back());
+    }
+  }
+  if (!Empty()) {
+    requests.emplace_back();
+    MPI_Isend(local, 1, owned_type_, root, kGatherTag, comm_, &requests.back());
+  }
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+void DistributedBlock::ExchangeHalo(void *local) {
+  if (Empty()) {
+    return;
+  }
+  // Columns first, then whole stored rows, so the corner ghosts of kBlocks are filled as well
+  const std::array<std::array<Side, 2>, 2> phases = {{{Side::kLeft, Side::kRight}, {Side::kTop, Side::kBottom}}};
+  for (const auto &[first, second] : phases) {
+    const auto a = static_cast<std::size_t>(first);
+    const auto b = static_cast<std::size_t>(second);
+    if (halo_send_types_[a] == MPI_DATATYPE_NULL) {
+      continue;
+    }
+    MPI_Sendrecv(local, 1, halo_send_types_[a], neighbors_[a], static_cast<int>(first), local, 1, halo_recv_types_[b],
+                 neighbors_[b], static_cast<int>(first), comm_, MPI_STATUS_IGNORE);
+    MPI_Sendrecv(local, 1, halo_send_types_[b], neighbors_[b], static_cast<int>(second), local, 1,
+                 halo_recv_types_[a], neighbors_[a], static_cast<int>(second), comm_, MPI_STATUS_IGNORE);
+  }
+}
+
+MPI_Datatype DistributedBlock::LocalSubarray(const DistributedBlock &block, ppc::util::IndexRange rows,
+                                             ppc::util::IndexRange cols) const {
+  const auto own_rows = block.distribution_.RowRange(block.rank_);
+  const auto own_cols = block.distribution_.ColRange(block.rank_);
+  return Subarray({block.local_rows_ + (2 * block.halo_rows_), block.GetStride()}, {rows.Size(), cols.Size()},
+                  {rows.begin - own_rows.begin + block.halo_rows_, cols.begin - own_cols.begin + block.halo_cols_},
+                  type_);
+}
+
+void DistributedBlock::RedistributeTo(const void *local, const DistributedBlock &target, void *target_local) const {
+  const auto &to = target.distribution_;
+  if (to.GetSize() != distribution_.GetSize() || to.GetRows() != distribution_.GetRows() ||
+      to.GetCols() != distribution_.GetCols()) {
+    throw std::invalid_argument("DistributedMatrix::Redistribute: shapes or communicator sizes differ");
+  }
+  const auto size = static_cast<std::size_t>(distribution_.GetSize());
+  std::vector<int> send_counts(size, 0);
+  std::vector<int> recv_counts(size, 0);
+  std::vector<int> displacements(size, 0);
+  std::vector<MPI_Datatype> send_types(size, MPI_BYTE);
+  std::vector<MPI_Datatype> recv_types(size, MPI_BYTE);
+  const auto my_rows = distribution_.RowRange(rank_);
+  const auto my_cols = distribution_.ColRange(rank_);
+  const auto my_target_rows = to.RowRange(rank_);
+  const auto my_target_cols = to.ColRange(rank_);
+  for (std::size_t rank = 0; rank < size; rank++) {
+    const auto peer = static_cast<int>(rank);
+    const auto send_rows = Intersect(my_rows, to.RowRange(peer));
+    const auto send_cols = Intersect(my_cols, to.ColRange(peer));
+    if (!send_rows.Empty() && !send_cols.Empty()) {
+      send_types[rank] = LocalSubarray(*this, send_rows, send_cols);
+      send_counts[rank] = 1;
+    }
+    const auto recv_rows = Intersect(distribution_.RowRange(peer), my_target_rows);
+    const auto recv_cols = Intersect(distribution_.ColRange(peer), my_target_cols);
+    if (!recv_rows.Empty() && !recv_cols.Empty()) {
+      recv_types[rank] = LocalSubarray(target, recv_rows, recv_cols);
+      recv_counts[rank] = 1;
+    }
+  }
+  MPI_Alltoallw(local, send_counts.data(), displacements.data(), send_types.data(), target_local, recv_counts.data(),
+                displacements.data(), recv_types.data(), comm_);
+  for (std::size_t rank = 0; rank < size; rank++) {
+    if (send_counts[rank] != 0) {
+      MPI_Type_free(&send_types[rank]);
+    }
+    if (recv_counts[rank] != 0) {
+      MPI_Type_free(&recv_types[rank]);
+    }
+  }
+}
+
+}  // namespace detail
+
+}  // namespace ppc::distributed
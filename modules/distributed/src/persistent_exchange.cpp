@@ -0,0 +1,72 @@
+#include "distributed/include/persistent_exchange.hpp"
+
+#include <mpi.h>
+
+#include <stdexcept>
+
+namespace ppc::distributed {
+
+PersistentExchange::PersistentExchange(MPI_Comm comm) {
+  MPI_Comm_dup(comm, &comm_);
+}
+
+PersistentExchange::~PersistentExchange() {
+  // Freeing an active request would leave its buffers in use after the owner released them
+  Wait();
+  for (auto &request : requests_) {
+    MPI_Request_free(&request);
+  }
+  MPI_Comm_free(&comm_);
+}
+
+void PersistentExchange::AddSend(const void *buffer, int count, MPI_Datatype type, int dest, int tag) {
+  CheckInactive();
+  MPI_Request request = MPI_REQUEST_NULL;
+  MPI_Send_init(buffer, count, type, dest, tag, comm_, &request);
+  requests_.push_back(request);
+}
+
+void PersistentExchange::AddRecv(void *buffer, int count, MPI_Datatype type, int source, int tag) {
+  CheckInactive();
+  MPI_Request request = MPI_REQUEST_NULL;
+  MPI_Recv_init(buffer, count, type, source, tag, comm_, &request);
+  requests_.push_back(request);
+}
+
+void PersistentExchange::Start() {
+  CheckInactive();
+  if (!requests_.empty()) {
+    MPI_Startall(static_cast<int>(requests_.size()), requests_.data());
+  }
+  active_ = true;
+}
+
+void PersistentExchange::Wait() {
+  if (!active_) {
+    return;
+  }
+  if (!requests_.empty()) {
+    MPI_Waitall(static_cast<int>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE);
+  }
+  active_ = false;
+}
+
+bool PersistentExchange::Test() {
+  if (!active_) {
+    return true;
+  }
+  int flag = 1;
+  if (!requests_.empty()) {
+    MPI_Testall(static_cast<int>(requests_.size()), requests_.data(), &flag, MPI_STATUSES_IGNORE);
+  }
+  active_ = flag == 0;
+  return !active_;
+}
+
+void PersistentExchange::CheckInactive() const {
+  if (active_) {
+    throw std::logic_error("PersistentExchange: the previous round has not been waited for");
+  }
+}
+
+}  // namespace ppc::distributed
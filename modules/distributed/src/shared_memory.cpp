@@ -0,0 +1,50 @@
+#include "distributed/include/shared_memory.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+
+namespace ppc::distributed {
+
+NodeTopology::NodeTopology(MPI_Comm comm) : comm_(comm) {
+  int rank = 0;
+  MPI_Comm_rank(comm_, &rank);
+  MPI_Comm_split_type(comm_, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm_);
+  MPI_Comm_rank(node_comm_, &node_rank_);
+  MPI_Comm_size(node_comm_, &node_size_);
+  MPI_Comm_split(comm_, IsLeader() ? 0 : MPI_UNDEFINED, rank, &leader_comm_);
+
+  std::array<int, 2> node_info = {0, 1};
+  if (IsLeader()) {
+    MPI_Comm_rank(leader_comm_, node_info.data());
+    MPI_Comm_size(leader_comm_, &node_info[1]);
+  }
+  MPI_Bcast(node_info.data(), 2, MPI_INT, 0, node_comm_);
+  node_index_ = node_info[0];
+  num_nodes_ = node_info[1];
+}
+
+NodeTopology::~NodeTopology() {
+  if (leader_comm_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&leader_comm_);
+  }
+  MPI_Comm_free(&node_comm_);
+}
+
+namespace detail {
+
+void BroadcastBytes(void *data, std::size_t bytes, int root, MPI_Comm comm) {
+  auto *bytes_ptr = static_cast<char *>(data);
+  constexpr auto kMaxPiece = static_cast<std::size_t>(INT_MAX);
+  for (std::size_t offset = 0; offset < bytes; offset += kMaxPiece) {
+    const std::size_t piece = std::min(kMaxPiece, bytes - offset);
+    MPI_Bcast(bytes_ptr + offset, static_cast<int>(piece), MPI_BYTE, root, comm);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace ppc::distributed
@@ -0,0 +1,112 @@
+#include "distributed/include/work_distributor.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "util/include/partition.hpp"
+
+namespace ppc::distributed {
+
+namespace {
+
+constexpr int kRequestTag = 1;
+constexpr int kTicketTag = 2;
+
+}  // namespace
+
+WorkDistributor::WorkDistributor(MPI_Comm comm, int64_t begin, int64_t end, const DistributionOptions &options)
+    : comm_(MPI_COMM_NULL), mode_(options.mode) {
+  if (end < begin) {
+    throw std::invalid_argument("WorkDistributor needs begin <= end");
+  }
+  // A private communicator keeps the chunk requests apart from the messages of the task itself
+  MPI_Comm_dup(comm, &comm_);
+  MPI_Comm_rank(comm_, &rank_);
+  MPI_Comm_size(comm_, &size_);
+
+  const bool master_worker = mode_ == DistributionMode::kMasterWorker && size_ > 1;
+  // The master does not compute, so the chunks are sized for the workers only
+  const int parts = master_worker ? size_ - 1 : size_;
+  chunks_ = ppc::util::GuidedRanges(end - begin, parts, options.min_chunk);
+  for (auto &chunk : chunks_) {
+    chunk.begin += begin;
+    chunk.end += begin;
+  }
+
+  if (mode_ == DistributionMode::kSharedCounter) {
+    int64_t *counter = nullptr;
+    const MPI_Aint bytes = rank_ == 0 ? static_cast<MPI_Aint>(sizeof(int64_t)) : 0;
+    MPI_Win_allocate(bytes, static_cast<int>(sizeof(int64_t)), MPI_INFO_NULL, comm_, static_cast<void *>(&counter),
+                     &window_);
+    if (rank_ == 0) {
+      // Exclusive self-lock makes the store visible to RMA under the separate memory model as well
+      MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, window_);
+      *counter = 0;
+      MPI_Win_unlock(0, window_);
+    }
+    MPI_Barrier(comm_);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+  } else {
+    active_workers_ = size_ - 1;
+  }
+}
+
+WorkDistributor::~WorkDistributor() {
+  if (window_ != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(window_);
+    MPI_Win_free(&window_);
+  }
+  MPI_Comm_free(&comm_);
+}
+
+bool WorkDistributor::Next(ppc::util::IndexRange &range) {
+  if (done_) {
+    return false;
+  }
+  if (mode_ == DistributionMode::kMasterWorker && size_ > 1 && rank_ == 0) {
+    Serve();
+    done_ = true;
+    return false;
+  }
+  const int64_t ticket = TakeTicket();
+  if (ticket >= static_cast<int64_t>(chunks_.size())) {
+    done_ = true;
+    return false;
+  }
+  range = chunks_[static_cast<std::size_t>(ticket)];
+  chunks_taken_++;
+  return true;
+}
+
+int64_t WorkDistributor::TakeTicket() {
+  int64_t ticket = 0;
+  if (mode_ == DistributionMode::kSharedCounter) {
+    const int64_t one = 1;
+    MPI_Fetch_and_op(&one, &ticket, MPI_INT64_T, 0, 0, MPI_SUM, window_);
+    MPI_Win_flush(0, window_);
+  } else if (size_ == 1) {
+    ticket = next_ticket_++;
+  } else {
+    MPI_Send(nullptr, 0, MPI_BYTE, 0, kRequestTag, comm_);
+    MPI_Recv(&ticket, 1, MPI_INT64_T, 0, kTicketTag, comm_, MPI_STATUS_IGNORE);
+  }
+  return ticket;
+}
+
+void WorkDistributor::Serve() {
+  // Every worker keeps asking until it receives a ticket past the end, which tells it to stop
+  while (active_workers_ > 0) {
+    MPI_Status status;
+    MPI_Recv(nullptr, 0, MPI_BYTE, MPI_ANY_SOURCE, kRequestTag, comm_, &status);
+    const int64_t ticket = next_ticket_ < static_cast<int64_t>(chunks_.size()) ? next_ticket_++ : next_ticket_;
+    MPI_Send(&ticket, 1, MPI_INT64_T, status.MPI_SOURCE, kTicketTag, comm_);
+    if (ticket >= static_cast<int64_t>(chunks_.size())) {
+      active_workers_--;
+    }
+  }
+}
+
+}  // namespace ppc::distributed
@@ -0,0 +1,251 @@
+#include "distributed/include/distributed_matrix.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "distributed/include/distributed_vector.hpp"
+#include "distributed/include/mpi_datatype.hpp"
+#include "runners/include/runners.hpp"
+#include "util/include/partition.hpp"
+
+const auto *const kDistributedMatrixMpiEnvironment =
+    ::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());
+
+namespace {
+
+using ppc::distributed::DistributedMatrix;
+using ppc::distributed::DistributedVector;
+using ppc::distributed::MatrixDistribution;
+using ppc::distributed::MatrixLayout;
+using ppc::distributed::Side;
+
+int GetRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetSize() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+int64_t Value(int64_t row, int64_t col) {
+  return (row * 1000) + col;
+}
+
+std::vector<int64_t> GlobalMatrix(int64_t rows, int64_t cols) {
+  std::vector<int64_t> global(static_cast<std::size_t>(rows * cols));
+  for (int64_t row = 0; row < rows; row++) {
+    for (int64_t col = 0; col < cols; col++) {
+      global[static_cast<std::size_t>((row * cols) + col)] = Value(row, col);
+    }
+  }
+  return global;
+}
+
+void ExpectOwnedValues(const DistributedMatrix<int64_t> &matrix) {
+  const auto rows = matrix.GetRowRange();
+  const auto cols = matrix.GetColRange();
+  for (int64_t row = 0; row < matrix.GetLocalRows(); row++) {
+    for (int64_t col = 0; col < matrix.GetLocalCols(); col++) {
+      ASSERT_EQ(matrix(row, col), Value(rows.begin + row, cols.begin + col));
+    }
+  }
+}
+
+using ShapeParam = std::tuple<MatrixLayout, int64_t, int64_t>;
+
+std::string ParamName(const ::testing::TestParamInfo<ShapeParam> &info) {
+  const auto [layout, rows, cols] = info.param;
+  std::string name = "Blocks";
+  if (layout == MatrixLayout::kRows) {
+    name = "Rows";
+  } else if (layout == MatrixLayout::kColumns) {
+    name = "Columns";
+  }
+  return name + "_" + std::to_string(rows) + "x" + std::to_string(cols);
+}
+
+}  // namespace
+
+TEST(MatrixDistributionTest, BlocksTileTheMatrix) {
+  for (auto layout : {MatrixLayout::kRows, MatrixLayout::kColumns, MatrixLayout::kBlocks}) {
+    const MatrixDistribution distribution(7, 5, layout, 6);
+    EXPECT_EQ(distribution.GetSize(), 6);
+    std::vector<int> owned(35, 0);
+    for (int rank = 0; rank < 6; rank++) {
+      for (int64_t row = distribution.RowRange(rank).begin; row < distribution.RowRange(rank).end; row++) {
+        for (int64_t col = distribution.ColRange(rank).begin; col < distribution.ColRange(rank).end; col++) {
+          EXPECT_EQ(distribution.Owner(row, col), rank);
+          owned[static_cast<std::size_t>((row * 5) + col)]++;
+        }
+      }
+    }
+    EXPECT_EQ(owned, std::vector<int>(35, 1));
+  }
+  const MatrixDistribution blocks(6, 6, MatrixLayout::kBlocks, 6);
+  EXPECT_EQ(blocks.GetGridRows() * blocks.GetGridCols(), 6);
+  EXPECT_GT(blocks.GetGridRows(), 1);
+  EXPECT_GT(blocks.GetGridCols(), 1);
+}
+
+TEST(MatrixDistributionTest, NeighborsSkipEmptyBlocks) {
+  // Rows 0-1 on rank 0, none on rank 1, row 2 on rank 2
+  const MatrixDistribution distribution(MatrixLayout::kRows, {{0, 2}, {2, 2}, {2, 3}}, {{0, 4}});
+  EXPECT_EQ(distribution.Neighbor(0, Side::kTop), MPI_PROC_NULL);
+  EXPECT_EQ(distribution.Neighbor(0, Side::kBottom), 2);
+  EXPECT_EQ(distribution.Neighbor(2, Side::kTop), 0);
+  EXPECT_EQ(distribution.Neighbor(1, Side::kTop), MPI_PROC_NULL);
+  EXPECT_EQ(distribution.Neighbor(0, Side::kLeft), MPI_PROC_NULL);
+  EXPECT_EQ(distribution.Owner(2, 3), 2);
+  EXPECT_THROW((void)distribution.Owner(3, 0), std::out_of_range);
+}
+
+TEST(MatrixDistributionTest, RejectsRangesWithGaps) {
+  EXPECT_THROW(MatrixDistribution(MatrixLayout::kRows, {{0, 2}, {3, 4}}, {{0, 1}}), std::invalid_argument);
+  EXPECT_THROW(MatrixDistribution(MatrixLayout::kRows, {}, {{0, 1}}), std::invalid_argument);
+}
+
+TEST(MpiDatatypeTest, MapsBySizeAndSignedness) {
+  EXPECT_EQ(ppc::distributed::MpiDatatype<double>(), MPI_DOUBLE);
+  EXPECT_EQ(ppc::distributed::MpiDatatype<float>(), MPI_FLOAT);
+  EXPECT_EQ(ppc::distributed::MpiDatatype<int>(), MPI_INT32_T);
+  EXPECT_EQ(ppc::distributed::MpiDatatype<long long>(), MPI_INT64_T);
+  EXPECT_EQ(ppc::distributed::MpiDatatype<unsigned char>(), MPI_UINT8_T);
+}
+
+class DistributedMatrixTest : public ::testing::TestWithParam<ShapeParam> {};
+
+TEST_P(DistributedMatrixTest, ScatterGatherRoundTrip) {
+  const auto [layout, rows, cols] = GetParam();
+  const auto global = GlobalMatrix(rows, cols);
+  const int root = GetSize() - 1;
+  DistributedMatrix<int64_t> matrix(MPI_COMM_WORLD, rows, cols, layout, 1);
+  matrix.Scatter(GetRank() == root ? global : std::vector<int64_t>{}, root);
+  ExpectOwnedValues(matrix);
+  const auto gathered = matrix.Gather(root);
+  if (GetRank() == root) {
+    EXPECT_EQ(gathered, global);
+  } else {
+    EXPECT_TRUE(gathered.empty());
+  }
+}
+
+TEST_P(DistributedMatrixTest, HaloHoldsNeighbourValues) {
+  const auto [layout, rows, cols] = GetParam();
+  DistributedMatrix<int64_t> matrix(MPI_COMM_WORLD, rows, cols, layout, 1);
+  // Ghosts beyond the edge of the matrix keep this value
+  for (auto &value : matrix.Storage()) {
+    value = -1;
+  }
+  matrix.Scatter(GlobalMatrix(rows, cols));
+  matrix.ExchangeHalo();
+
+  const auto row_range = matrix.GetRowRange();
+  const auto col_range = matrix.GetColRange();
+  const int64_t halo_rows = layout == MatrixLayout::kColumns ? 0 : 1;
+  const int64_t halo_cols = layout == MatrixLayout::kRows ? 0 : 1;
+  if (matrix.GetLocalRows() == 0 || matrix.GetLocalCols() == 0) {
+    return;
+  }
+  for (int64_t row = -halo_rows; row < matrix.GetLocalRows() + halo_rows; row++) {
+    for (int64_t col = -halo_cols; col < matrix.GetLocalCols() + halo_cols; col++) {
+      const int64_t global_row = row_range.begin + row;
+      const int64_t global_col = col_range.begin + col;
+      const bool inside = global_row >= 0 && global_row < rows && global_col >= 0 && global_col < cols;
+      ASSERT_EQ(matrix(row, col), inside ? Value(global_row, global_col) : -1) << "at " << row << ", " << col;
+    }
+  }
+}
+
+TEST_P(DistributedMatrixTest, RedistributeKeepsEveryElement) {
+  const auto [layout, rows, cols] = GetParam();
+  DistributedMatrix<int64_t> matrix(MPI_COMM_WORLD, rows, cols, layout);
+  matrix.Scatter(GlobalMatrix(rows, cols));
+  for (auto target : {MatrixLayout::kRows, MatrixLayout::kColumns, MatrixLayout::kBlocks}) {
+    const auto redistributed = matrix.Redistribute(target, 1);
+    EXPECT_EQ(redistributed.GetDistribution().GetLayout(), target);
+    ExpectOwnedValues(redistributed);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Shapes, DistributedMatrixTest,
+                         ::testing::Combine(::testing::Values(MatrixLayout::kRows, MatrixLayout::kColumns,
+                                                              MatrixLayout::kBlocks),
+                                            ::testing::Values(int64_t{1}, int64_t{9}), ::testing::Values(int64_t{13})),
+                         ParamName);
+
+TEST(DistributedMatrixArgumentsTest, RejectsWrongShapes) {
+  DistributedMatrix<double> matrix(MPI_COMM_WORLD, 4, 4, MatrixLayout::kRows);
+  if (GetRank() == 0) {
+    EXPECT_THROW(matrix.Scatter(std::vector<double>(3)), std::invalid_argument);
+  }
+  EXPECT_THROW(DistributedMatrix<double>(MPI_COMM_WORLD, MatrixDistribution(4, 4, MatrixLayout::kRows, GetSize() + 1)),
+               std::invalid_argument);
+  if (GetSize() > 1) {
+    // Blocks of one row cannot fill a halo of two rows
+    EXPECT_THROW(DistributedMatrix<double>(MPI_COMM_WORLD, GetSize(), 4, MatrixLayout::kRows, 2),
+                 std::invalid_argument);
+  }
+}
+
+TEST(DistributedVectorTest, ScatterHaloGather) {
+  const int64_t size = 50;
+  std::vector<double> global(static_cast<std::size_t>(size));
+  for (int64_t i = 0; i < size; i++) {
+    global[static_cast<std::size_t>(i)] = static_cast<double>(i) * 0.5;
+  }
+  DistributedVector<double> vector(MPI_COMM_WORLD, size, 2);
+  vector.Scatter(global);
+  vector.ExchangeHalo();
+  const auto range = vector.GetLocalRange();
+  ASSERT_EQ(vector.Local().size(), static_cast<std::size_t>(range.Size()));
+  for (int64_t i = -2; i < vector.GetLocalSize() + 2; i++) {
+    const int64_t global_index = range.begin + i;
+    if (global_index >= 0 && global_index < size) {
+      ASSERT_EQ(vector[i], global[static_cast<std::size_t>(global_index)]);
+    }
+  }
+  EXPECT_EQ(vector.Owner(range.begin), GetRank());
+  if (GetRank() == 0) {
+    EXPECT_EQ(vector.Neighbor(true), MPI_PROC_NULL);
+    EXPECT_EQ(vector.Gather(), global);
+  } else {
+    EXPECT_TRUE(vector.Gather().empty());
+  }
+}
+
+TEST(DistributedVectorTest, RedistributeToWeightedRanges) {
+  const int64_t size = 40;
+  std::vector<int> global(static_cast<std::size_t>(size));
+  for (int64_t i = 0; i < size; i++) {
+    global[static_cast<std::size_t>(i)] = static_cast<int>(i * 3);
+  }
+  DistributedVector<int> vector(MPI_COMM_WORLD, size);
+  vector.Scatter(global);
+
+  // Costs growing with the index give the first ranks more elements
+  std::vector<double> costs(static_cast<std::size_t>(size));
+  for (std::size_t i = 0; i < costs.size(); i++) {
+    costs[i] = static_cast<double>(i + 1);
+  }
+  const auto ranges = ppc::util::WeightedRanges(costs, GetSize());
+  const auto rebalanced = vector.Redistribute(ranges, 1);
+  EXPECT_EQ(rebalanced.GetLocalRange(), ranges[static_cast<std::size_t>(GetRank())]);
+  for (int64_t i = 0; i < rebalanced.GetLocalSize(); i++) {
+    ASSERT_EQ(rebalanced[i], global[static_cast<std::size_t>(rebalanced.GetLocalRange().begin + i)]);
+  }
+  const auto gathered = rebalanced.Gather();
+  if (GetRank() == 0) {
+    EXPECT_EQ(gathered, global);
+  }
+}
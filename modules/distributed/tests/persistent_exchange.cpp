@@ -0,0 +1,151 @@
+#include "distributed/include/persistent_exchange.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "runners/include/runners.hpp"
+
+const auto *const kPersistentExchangeMpiEnvironment =
+    ::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());
+
+namespace {
+
+int GetRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetSize() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+constexpr int kToRightTag = 1;
+constexpr int kToLeftTag = 2;
+
+}  // namespace
+
+TEST(PersistentExchangeTest, RingExchangeSeesNewDataEveryRound) {
+  const int rank = GetRank();
+  const int size = GetSize();
+  const int left = (rank + size - 1) % size;
+  const int right = (rank + 1) % size;
+
+  int64_t send = 0;
+  std::array<int64_t, 2> recv = {-1, -1};
+  ppc::distributed::PersistentExchange exchange(MPI_COMM_WORLD);
+  exchange.AddRecv(recv.data(), 1, MPI_INT64_T, left, kToRightTag);
+  exchange.AddRecv(&recv[1], 1, MPI_INT64_T, right, kToLeftTag);
+  exchange.AddSend(&send, 1, MPI_INT64_T, right, kToRightTag);
+  exchange.AddSend(&send, 1, MPI_INT64_T, left, kToLeftTag);
+  EXPECT_EQ(exchange.Size(), 4U);
+
+  for (int64_t round = 0; round < 5; round++) {
+    send = (round * 1000) + rank;
+    exchange.Start();
+    EXPECT_TRUE(exchange.IsActive());
+    exchange.Wait();
+    EXPECT_FALSE(exchange.IsActive());
+    EXPECT_EQ(recv[0], (round * 1000) + left);
+    EXPECT_EQ(recv[1], (round * 1000) + right);
+  }
+}
+
+TEST(PersistentExchangeTest, ProcNullPeersCompleteImmediately) {
+  int64_t send = 7;
+  int64_t recv = -1;
+  ppc::distributed::PersistentExchange exchange(MPI_COMM_WORLD);
+  exchange.AddSend(&send, 1, MPI_INT64_T, MPI_PROC_NULL, kToRightTag);
+  exchange.AddRecv(&recv, 1, MPI_INT64_T, MPI_PROC_NULL, kToRightTag);
+  exchange.Start();
+  while (!exchange.Test()) {
+  }
+  EXPECT_FALSE(exchange.IsActive());
+  EXPECT_EQ(recv, -1);
+}
+
+TEST(PersistentExchangeTest, EmptyExchangeCanBeStarted) {
+  ppc::distributed::PersistentExchange exchange(MPI_COMM_WORLD);
+  exchange.Start();
+  EXPECT_TRUE(exchange.Test());
+  exchange.Wait();
+}
+
+TEST(PersistentExchangeTest, RestartAndRegisterWhileActiveThrow) {
+  int64_t value = 0;
+  ppc::distributed::PersistentExchange exchange(MPI_COMM_WORLD);
+  exchange.Start();
+  EXPECT_THROW(exchange.Start(), std::logic_error);
+  EXPECT_THROW(exchange.AddSend(&value, 1, MPI_INT64_T, MPI_PROC_NULL, 0), std::logic_error);
+  exchange.Wait();
+  EXPECT_NO_THROW(exchange.AddSend(&value, 1, MPI_INT64_T, MPI_PROC_NULL, 0));
+}
+
+TEST(PersistentExchangeTest, DestructorCompletesAnActiveRound) {
+  const int rank = GetRank();
+  const int size = GetSize();
+  int64_t send = rank;
+  int64_t recv = -1;
+  {
+    ppc::distributed::PersistentExchange exchange(MPI_COMM_WORLD);
+    exchange.AddRecv(&recv, 1, MPI_INT64_T, (rank + size - 1) % size, kToRightTag);
+    exchange.AddSend(&send, 1, MPI_INT64_T, (rank + 1) % size, kToRightTag);
+    exchange.Start();
+  }
+  EXPECT_EQ(recv, (rank + size - 1) % size);
+}
+
+TEST(DoubleBufferedExchangeTest, StepsAlternateBuffersAndOverlapInterior) {
+  const int rank = GetRank();
+  const int size = GetSize();
+  const int left = (rank + size - 1) % size;
+  const int right = (rank + 1) % size;
+
+  // Every buffer holds {own value, value received from the left}; each step adds the neighbour's value
+  std::array<std::array<int64_t, 2>, 2> buffers = {{{rank, -1}, {0, -1}}};
+  ppc::distributed::DoubleBufferedExchange exchange(MPI_COMM_WORLD);
+  for (int parity = 0; parity < 2; parity++) {
+    auto &buffer = buffers.at(static_cast<std::size_t>(parity));
+    exchange.Buffer(parity).AddRecv(&buffer[1], 1, MPI_INT64_T, left, kToRightTag);
+    exchange.Buffer(parity).AddSend(buffer.data(), 1, MPI_INT64_T, right, kToRightTag);
+  }
+
+  // Reference: value_{t+1}(r) = value_t(r) + value_t(r - 1) + 1, simulated for all ranks
+  std::vector<int64_t> expected(static_cast<std::size_t>(size));
+  for (int r = 0; r < size; r++) {
+    expected[static_cast<std::size_t>(r)] = r;
+  }
+
+  std::vector<int> order;
+  for (int64_t t = 0; t < 6; t++) {
+    auto &current = buffers.at(static_cast<std::size_t>(t % 2));
+    auto &next = buffers.at(static_cast<std::size_t>((t + 1) % 2));
+    auto interior = [&] {
+      order.push_back(0);
+      next[0] = current[0] + 1;
+    };
+    auto boundary = [&] {
+      order.push_back(1);
+      next[0] += current[1];
+    };
+    exchange.Step(t, interior, boundary);
+
+    std::vector<int64_t> previous = expected;
+    for (int r = 0; r < size; r++) {
+      expected[static_cast<std::size_t>(r)] =
+          previous[static_cast<std::size_t>(r)] + previous[static_cast<std::size_t>((r + size - 1) % size)] + 1;
+    }
+    ASSERT_EQ(next[0], expected[static_cast<std::size_t>(rank)]);
+  }
+  EXPECT_EQ(order, std::vector<int>({0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1}));
+  EXPECT_FALSE(exchange.Buffer(0).IsActive());
+  EXPECT_FALSE(exchange.Buffer(1).IsActive());
+}
@@ -0,0 +1,93 @@
+#include "distributed/include/sample_sort.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "distributed/include/mpi_datatype.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "runners/include/runners.hpp"
+
+const auto *const kSampleSortMpiEnvironment = ::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());
+
+namespace {
+
+int GetRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetSize() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+template <typename T>
+/// Gathers the pieces of all ranks in rank order
+std::vector<T> GatherAll(const std::vector<T> &local) {
+  const int size = GetSize();
+  auto count = static_cast<int>(local.size());
+  std::vector<int> counts(static_cast<std::size_t>(size));
+  MPI_Allgather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  std::vector<int> displs(static_cast<std::size_t>(size), 0);
+  for (std::size_t rank = 1; rank < displs.size(); rank++) {
+    displs[rank] = displs[rank - 1] + counts[rank - 1];
+  }
+  std::vector<T> all(static_cast<std::size_t>(displs.back() + counts.back()));
+  const auto type = ppc::distributed::MpiDatatype<T>();
+  MPI_Allgatherv(local.data(), count, type, all.data(), counts.data(), displs.data(), type, MPI_COMM_WORLD);
+  return all;
+}
+
+/// Every rank generates @p count keys of its own; returns the local keys and all keys sorted
+std::vector<int32_t> LocalKeys(int64_t count, int32_t low, int32_t high) {
+  std::mt19937 gen(static_cast<uint32_t>(17 + GetRank()));
+  std::uniform_int_distribution<int32_t> dist(low, high);
+  std::vector<int32_t> keys(static_cast<std::size_t>(count));
+  for (auto &key : keys) {
+    key = dist(gen);
+  }
+  return keys;
+}
+
+}  // namespace
+
+TEST(SampleSortTest, RandomKeysAreSortedAcrossRanks) {
+  const auto keys = LocalKeys(10000, -1000000, 1000000);
+  auto expected = GatherAll(keys);
+  std::ranges::sort(expected);
+  const auto sorted = ppc::distributed::SampleSort(ppc::parallel::kOmp, MPI_COMM_WORLD, keys);
+  EXPECT_TRUE(std::ranges::is_sorted(sorted));
+  EXPECT_EQ(GatherAll(sorted), expected);
+  // Regular sampling keeps every piece below twice the average
+  EXPECT_LE(sorted.size(), 2 * keys.size());
+}
+
+TEST(SampleSortTest, UnevenInputsAndEmptyRanks) {
+  // Only even ranks have keys, and their numbers differ
+  const int rank = GetRank();
+  const auto keys = LocalKeys(rank % 2 == 0 ? 100 * (rank + 1) : 0, -50, 50);
+  auto expected = GatherAll(keys);
+  std::ranges::sort(expected);
+  EXPECT_EQ(GatherAll(ppc::distributed::SampleSort(ppc::parallel::kSeq, MPI_COMM_WORLD, keys, 3)), expected);
+  EXPECT_TRUE(ppc::distributed::SampleSort(ppc::parallel::kSeq, MPI_COMM_WORLD, std::vector<int32_t>{}).empty());
+}
+
+TEST(SampleSortTest, FloatingPointKeys) {
+  std::mt19937 gen(static_cast<uint32_t>(GetRank()));
+  std::normal_distribution<double> dist;
+  std::vector<double> keys(777);
+  for (auto &key : keys) {
+    key = dist(gen);
+  }
+  auto expected = GatherAll(keys);
+  std::ranges::sort(expected);
+  EXPECT_EQ(GatherAll(ppc::distributed::SampleSort(ppc::parallel::kTbb, MPI_COMM_WORLD, keys)), expected);
+}
@@ -0,0 +1,94 @@
+#include "distributed/include/shared_memory.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "runners/include/runners.hpp"
+
+const auto *const kSharedMemoryMpiEnvironment =
+    ::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());
+
+namespace {
+
+int GetRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetSize() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+}  // namespace
+
+TEST(NodeTopologyTest, NodesPartitionTheCommunicator) {
+  ppc::distributed::NodeTopology topology(MPI_COMM_WORLD);
+  EXPECT_GE(topology.GetNodeRank(), 0);
+  EXPECT_LT(topology.GetNodeRank(), topology.GetNodeSize());
+  EXPECT_EQ(topology.IsLeader(), topology.GetLeaderComm() != MPI_COMM_NULL);
+
+  int leaders = topology.IsLeader() ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &leaders, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  EXPECT_EQ(leaders, topology.GetNumNodes());
+  EXPECT_LT(topology.GetNodeIndex(), topology.GetNumNodes());
+
+  int ranks_in_nodes = topology.IsLeader() ? topology.GetNodeSize() : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &ranks_in_nodes, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  EXPECT_EQ(ranks_in_nodes, GetSize());
+}
+
+TEST(SharedArrayTest, WritesOfEveryNodeRankAreVisibleToAll) {
+  ppc::distributed::NodeTopology topology(MPI_COMM_WORLD);
+  ppc::distributed::SharedArray<int> shared(topology, static_cast<std::size_t>(topology.GetNodeSize()));
+  ASSERT_EQ(shared.Size(), static_cast<std::size_t>(topology.GetNodeSize()));
+  shared[static_cast<std::size_t>(topology.GetNodeRank())] = topology.GetNodeRank() + 1;
+  shared.Publish();
+  for (int node_rank = 0; node_rank < topology.GetNodeSize(); node_rank++) {
+    EXPECT_EQ(shared[static_cast<std::size_t>(node_rank)], node_rank + 1);
+  }
+  shared.Publish();
+}
+
+TEST(SharedArrayTest, ShareFromEveryRoot) {
+  ppc::distributed::NodeTopology topology(MPI_COMM_WORLD);
+  for (int root = 0; root < GetSize(); root++) {
+    std::vector<int64_t> data;
+    if (GetRank() == root) {
+      data.resize(1000);
+      std::iota(data.begin(), data.end(), root * 10000);
+    }
+    auto shared = ppc::distributed::ShareFromRoot<int64_t>(topology, data, root);
+    ASSERT_EQ(shared.Size(), 1000U);
+    for (std::size_t i = 0; i < shared.Size(); i++) {
+      ASSERT_EQ(shared[i], (root * 10000) + static_cast<int64_t>(i));
+    }
+  }
+}
+
+TEST(SharedArrayTest, ShareEmptyData) {
+  ppc::distributed::NodeTopology topology(MPI_COMM_WORLD);
+  auto shared = ppc::distributed::ShareFromRoot<double>(topology, std::span<const double>{});
+  EXPECT_EQ(shared.Size(), 0U);
+  EXPECT_TRUE(shared.Span().empty());
+}
+
+TEST(SharedArrayTest, MoveKeepsTheMapping) {
+  ppc::distributed::NodeTopology topology(MPI_COMM_WORLD);
+  const std::vector<int> data = {1, 2, 3};
+  auto shared = ppc::distributed::ShareFromRoot<int>(topology, data);
+  const int *mapped = shared.Data();
+  ppc::distributed::SharedArray<int> moved(std::move(shared));
+  EXPECT_EQ(moved.Data(), mapped);
+  EXPECT_EQ(moved[2], 3);
+  EXPECT_EQ(shared.Size(), 0U);  // NOLINT(bugprone-use-after-move)
+}
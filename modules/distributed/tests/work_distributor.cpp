@@ -0,0 +1,109 @@
+#include "distributed/include/work_distributor.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "runners/include/runners.hpp"
+#include "util/include/partition.hpp"
+
+// The tests run with any number of processes, including the single process of core_func_tests
+const auto *const kMpiEnvironment = ::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());
+
+namespace {
+
+using ppc::distributed::DistributionMode;
+using ppc::distributed::DistributionOptions;
+
+int GetRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetSize() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+/// Returns how many times each index of [begin, end) was handed out over all ranks.
+std::vector<int> CountVisits(int64_t begin, int64_t end, const DistributionOptions &options) {
+  std::vector<int> visits(static_cast<std::size_t>(end - begin), 0);
+  ppc::distributed::DynamicFor(
+      MPI_COMM_WORLD, begin, end,
+      [&](int64_t b, int64_t e) {
+        for (int64_t i = b; i < e; i++) {
+          visits[static_cast<std::size_t>(i - begin)]++;
+        }
+      },
+      options);
+  MPI_Allreduce(MPI_IN_PLACE, visits.data(), static_cast<int>(visits.size()), MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  return visits;
+}
+
+class WorkDistributorTest : public ::testing::TestWithParam<std::tuple<DistributionMode, int64_t>> {};
+
+}  // namespace
+
+TEST_P(WorkDistributorTest, EveryIndexIsHandedOutOnce) {
+  const auto [mode, min_chunk] = GetParam();
+  const auto visits = CountVisits(100, 10100, {.mode = mode, .min_chunk = min_chunk});
+  for (int v : visits) {
+    ASSERT_EQ(v, 1);
+  }
+}
+
+TEST_P(WorkDistributorTest, EmptyRangeGivesNoWork) {
+  const auto [mode, min_chunk] = GetParam();
+  ppc::distributed::WorkDistributor distributor(MPI_COMM_WORLD, 5, 5, {.mode = mode, .min_chunk = min_chunk});
+  ppc::util::IndexRange range;
+  EXPECT_FALSE(distributor.Next(range));
+  EXPECT_FALSE(distributor.Next(range));
+  EXPECT_EQ(distributor.GetChunksTaken(), 0);
+}
+
+TEST_P(WorkDistributorTest, ChunksShrinkDownToMinChunk) {
+  const auto [mode, min_chunk] = GetParam();
+  ppc::distributed::WorkDistributor distributor(MPI_COMM_WORLD, 0, 100000, {.mode = mode, .min_chunk = min_chunk});
+  const auto &chunks = distributor.GetChunks();
+  ASSERT_FALSE(chunks.empty());
+  for (std::size_t i = 1; i < chunks.size(); i++) {
+    EXPECT_LE(chunks[i].Size(), chunks[i - 1].Size());
+  }
+  // A single computing rank gets the whole range in one chunk
+  if (chunks.size() > 1) {
+    EXPECT_LE(chunks.back().Size(), min_chunk);
+  }
+  ppc::util::IndexRange range;
+  while (distributor.Next(range)) {
+  }
+}
+
+TEST_P(WorkDistributorTest, ChunksTakenAddUpOverRanks) {
+  const auto [mode, min_chunk] = GetParam();
+  ppc::distributed::WorkDistributor distributor(MPI_COMM_WORLD, 0, 5000, {.mode = mode, .min_chunk = min_chunk});
+  ppc::util::IndexRange range;
+  while (distributor.Next(range)) {
+  }
+  int64_t taken = distributor.GetChunksTaken();
+  MPI_Allreduce(MPI_IN_PLACE, &taken, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+  EXPECT_EQ(taken, static_cast<int64_t>(distributor.GetChunks().size()));
+  if (mode == DistributionMode::kMasterWorker && GetSize() > 1 && GetRank() == 0) {
+    EXPECT_EQ(distributor.GetChunksTaken(), 0);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Modes, WorkDistributorTest,
+                         ::testing::Combine(::testing::Values(DistributionMode::kSharedCounter,
+                                                              DistributionMode::kMasterWorker),
+                                            ::testing::Values(int64_t{1}, int64_t{64})));
+
+TEST(WorkDistributorArgumentsTest, RejectsReversedRange) {
+  EXPECT_THROW(ppc::distributed::WorkDistributor(MPI_COMM_WORLD, 10, 0), std::invalid_argument);
+}
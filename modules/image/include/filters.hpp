@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "image/include/image.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+
+namespace ppc::image {
+
+/// @brief Number of bins per channel of Histogram().
+inline constexpr int64_t kHistogramBins = 256;
+
+/// @brief Returns the radius of GaussianKernel(@p sigma), ceil(3 sigma).
+/// @throws std::invalid_argument if @p sigma is not positive.
+inline int64_t GaussianRadius(double sigma) {
+  if (!(sigma > 0.0)) {
+    throw std::invalid_argument("GaussianRadius: sigma must be positive");
+  }
+  return static_cast<int64_t>(std::ceil(3.0 * sigma));
+}
+
+/// @brief Returns the 2 * GaussianRadius(@p sigma) + 1 weights of a normalized 1D Gaussian.
+inline std::vector<float> GaussianKernel(double sigma) {
+  const int64_t radius = GaussianRadius(sigma);
+  std::vector<double> weights;
+  double sum = 0.0;
+  for (int64_t i = -radius; i <= radius; i++) {
+    weights.push_back(std::exp(-static_cast<double>(i * i) / (2.0 * sigma * sigma)));
+    sum += weights.back();
+  }
+  std::vector<float> kernel;
+  for (double weight : weights) {
+    kernel.push_back(static_cast<float>(weight / sum));
+  }
+  return kernel;
+}
+
+namespace detail {
+
+/// Rounds to the nearest 8-bit value, saturating.
+inline uint8_t ToByte(float value) {
+  return static_cast<uint8_t>(std::clamp(value, 0.0F, 255.0F) + 0.5F);
+}
+
+/// Returns src row @p y clamped to the rows of @p src, i.e. pixels beyond the edges repeat the edge pixel.
+inline int64_t ClampRow(int64_t y, int64_t height) {
+  return std::clamp<int64_t>(y, 0, height - 1);
+}
+
+template <typename T>
+/// Copies @p channel of row @p y with unit stride into @p row, preceded and followed by @p radius copies of the
+/// edge pixels, so the filter loops over it need neither bounds checks nor the pixel step of the layout.
+void LoadPaddedRow(ImageView<const uint8_t> src, int64_t y, int64_t channel, int64_t radius, T *row) {
+  const uint8_t *in = src.Row(y, channel);
+  const int64_t step = src.PixelStep();
+  for (int64_t x = 0; x < src.width; x++) {
+    row[radius + x] = static_cast<T>(in[x * step]);
+  }
+  std::fill_n(row, radius, row[radius]);
+  std::fill_n(row + radius + src.width, radius, row[radius + src.width - 1]);
+}
+
+/// Checks the contract shared by the neighbourhood filters: rows [@p src_row_offset, @p src_row_offset +
+/// dst.height) of @p src exist and have the shape of @p dst.
+inline void CheckRows(const char *message, ImageView<const uint8_t> src, ImageView<uint8_t> dst,
+                      int64_t src_row_offset) {
+  if (src.width != dst.width || src.channels != dst.channels || src_row_offset < 0 ||
+      src_row_offset + dst.height > src.height) {
+    throw std::invalid_argument(message);
+  }
+}
+
+}  // namespace detail
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Gaussian blur of every channel, as a horizontal and a vertical pass with GaussianKernel(@p sigma).
+/// @details The horizontal pass writes the needed source rows as float rows, the vertical pass sums weighted rows
+///          of them. Both inner loops run over a whole row with unit stride and vectorize for either layout. Every
+///          pixel is summed in the same order under every backend, so all policies give identical images. Pixels
+///          beyond the edges repeat the edge pixel.
+/// @param src_row_offset Row of @p src that becomes row 0 of @p dst. Rows of @p src beyond its edges are clamped,
+///        so for the strip of a rank with GaussianRadius() halo rows on each side that exist, the rows of @p dst
+///        equal the ones computed from the whole image.
+/// @throws std::invalid_argument if the shapes do not match or @p sigma is not positive.
+void GaussianBlur(const ppc::parallel::ExecutionPolicy<kBackend> &policy, ImageView<const uint8_t> src,
+                  ImageView<uint8_t> dst, double sigma, int64_t src_row_offset = 0) {
+  detail::CheckRows("GaussianBlur: dst rows must lie within src", src, dst, src_row_offset);
+  const std::vector<float> kernel = GaussianKernel(sigma);
+  const auto taps = static_cast<int64_t>(kernel.size());
+  const int64_t radius = taps / 2;
+  const int64_t width = dst.width;
+  if (width == 0 || dst.height == 0) {
+    return;
+  }
+  // Source rows read by the vertical pass
+  const int64_t first = std::max<int64_t>(0, src_row_offset - radius);
+  const int64_t rows = std::min(src.height, src_row_offset + dst.height + radius) - first;
+  std::vector<float> horizontal(static_cast<std::size_t>(dst.channels * rows * width));
+
+  ppc::parallel::ParallelForRange(policy, 0, dst.channels * rows, [&](int64_t begin, int64_t end) {
+    std::vector<float> padded(static_cast<std::size_t>(width + (2 * radius)));
+    for (int64_t i = begin; i < end; i++) {
+      detail::LoadPaddedRow(src, first + (i % rows), i / rows, radius, padded.data());
+      float *out = horizontal.data() + (i * width);
+      std::fill_n(out, width, 0.0F);
+      for (int64_t tap = 0; tap < taps; tap++) {
+        const float weight = kernel[static_cast<std::size_t>(tap)];
+        const float *in = padded.data() + tap;
+#pragma omp simd
+        for (int64_t x = 0; x < width; x++) {
+          out[x] += weight * in[x];
+        }
+      }
+    }
+  });
+
+  ppc::parallel::ParallelForRange(policy, 0, dst.channels * dst.height, [&](int64_t begin, int64_t end) {
+    std::vector<float> sum(static_cast<std::size_t>(width));
+    for (int64_t i = begin; i < end; i++) {
+      const int64_t channel = i / dst.height;
+      const int64_t y = i % dst.height;
+      std::ranges::fill(sum, 0.0F);
+      for (int64_t tap = 0; tap < taps; tap++) {
+        const float weight = kernel[static_cast<std::size_t>(tap)];
+        const int64_t row = detail::ClampRow(y + src_row_offset + tap - radius, src.height) - first;
+        const float *in = horizontal.data() + (((channel * rows) + row) * width);
+        float *acc = sum.data();
+#pragma omp simd
+        for (int64_t x = 0; x < width; x++) {
+          acc[x] += weight * in[x];
+        }
+      }
+      uint8_t *out = dst.Row(y, channel);
+      const int64_t step = dst.PixelStep();
+      for (int64_t x = 0; x < width; x++) {
+        out[x * step] = detail::ToByte(sum[static_cast<std::size_t>(x)]);
+      }
+    }
+  });
+}
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Converts @p src to the single channel of @p dst: one channel is copied, RGB and RGBA become BT.601 luma
+///        with 8-bit fixed-point weights (77 R + 150 G + 29 B) / 256; alpha is ignored.
+/// @throws std::invalid_argument if the sizes differ, @p dst has more than one channel or @p src has 2 or more
+///         than 4 channels.
+void ToGray(const ppc::parallel::ExecutionPolicy<kBackend> &policy, ImageView<const uint8_t> src,
+            ImageView<uint8_t> dst) {
+  if (src.width != dst.width || src.height != dst.height || dst.channels != 1 || src.channels == 2 ||
+      src.channels > 4) {
+    throw std::invalid_argument("ToGray: expected a 1, 3 or 4 channel source and a 1 channel target of equal size");
+  }
+  const bool color = src.channels > 1;
+  ppc::parallel::ParallelFor(policy, 0, dst.height, [&](int64_t y) {
+    const uint8_t *r = src.Row(y, 0);
+    const uint8_t *g = src.Row(y, color ? 1 : 0);
+    const uint8_t *b = src.Row(y, color ? 2 : 0);
+    const int64_t step = src.PixelStep();
+    uint8_t *out = dst.Row(y, 0);
+    const int64_t out_step = dst.PixelStep();
+    if (!color) {
+      for (int64_t x = 0; x < dst.width; x++) {
+        out[x * out_step] = r[x * step];
+      }
+      return;
+    }
+#pragma omp simd
+    for (int64_t x = 0; x < dst.width; x++) {
+      const int luma = (77 * r[x * step]) + (150 * g[x * step]) + (29 * b[x * step]) + 128;
+      out[x * out_step] = static_cast<uint8_t>(luma >> 8);
+    }
+  });
+}
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Gradient magnitude of every channel with the 3 x 3 Sobel operators.
+/// @details The magnitude sqrt(gx^2 + gy^2) is scaled by 1 / (4 sqrt(2)), so no edge exceeds 255, and rounded.
+///          The gradients of an output row are computed from three padded rows in one vectorizable loop. Pixels
+///          beyond the edges repeat the edge pixel.
+/// @param src_row_offset Row of @p src that becomes row 0 of @p dst, as for GaussianBlur(); one halo row on each
+///        side suffices.
+/// @throws std::invalid_argument if the shapes do not match.
+void Sobel(const ppc::parallel::ExecutionPolicy<kBackend> &policy, ImageView<const uint8_t> src,
+           ImageView<uint8_t> dst, int64_t src_row_offset = 0) {
+  detail::CheckRows("Sobel: dst rows must lie within src", src, dst, src_row_offset);
+  constexpr float kScale = 0.17677669F;  // 1 / (4 sqrt(2))
+  const int64_t width = dst.width;
+  if (width == 0 || dst.height == 0) {
+    return;
+  }
+  ppc::parallel::ParallelForRange(policy, 0, dst.channels * dst.height, [&](int64_t begin, int64_t end) {
+    const auto padded = static_cast<std::size_t>(width + 2);
+    std::vector<int32_t> above(padded);
+    std::vector<int32_t> center(padded);
+    std::vector<int32_t> below(padded);
+    std::vector<float> squared(static_cast<std::size_t>(width));
+    for (int64_t i = begin; i < end; i++) {
+      const int64_t channel = i / dst.height;
+      const int64_t y = i % dst.height;
+      const int64_t row = y + src_row_offset;
+      detail::LoadPaddedRow(src, detail::ClampRow(row - 1, src.height), channel, 1, above.data());
+      detail::LoadPaddedRow(src, row, channel, 1, center.data());
+      detail::LoadPaddedRow(src, detail::ClampRow(row + 1, src.height), channel, 1, below.data());
+      const int32_t *a = above.data();
+      const int32_t *c = center.data();
+      const int32_t *b = below.data();
+      float *m = squared.data();
+#pragma omp simd
+      for (int64_t x = 0; x < width; x++) {
+        const int32_t gx = (a[x + 2] + (2 * c[x + 2]) + b[x + 2]) - (a[x] + (2 * c[x]) + b[x]);
+        const int32_t gy = (b[x] + (2 * b[x + 1]) + b[x + 2]) - (a[x] + (2 * a[x + 1]) + a[x + 2]);
+        m[x] = static_cast<float>((gx * gx) + (gy * gy));
+      }
+      // Without -fno-math-errno, std::sqrt keeps an errno branch that would stop the gradient loop from vectorizing
+      uint8_t *out = dst.Row(y, channel);
+      const int64_t step = dst.PixelStep();
+      for (int64_t x = 0; x < width; x++) {
+        out[x * step] = detail::ToByte(std::sqrt(m[x]) * kScale);
+      }
+    }
+  });
+}
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Counts the values of every channel: bin kHistogramBins * c + v is the number of pixels whose channel c
+///        has value v.
+/// @details Every MakeBlocks() block of rows counts into its own four sub-histograms, one per pixel x % 4, so
+///          runs of equal values (flat areas) do not wait on increments of one counter; the counts are added
+///          afterwards.
+std::vector<int64_t> Histogram(const ppc::parallel::ExecutionPolicy<kBackend> &policy, ImageView<const uint8_t> src) {
+  constexpr int64_t kLanes = 4;
+  const int64_t bins = kHistogramBins * src.channels;
+  const ppc::parallel::Blocks blocks = ppc::parallel::MakeBlocks(policy, src.height);
+  std::vector<std::vector<int64_t>> partial(static_cast<std::size_t>(blocks.count));
+  ppc::parallel::ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    auto &counts = partial[static_cast<std::size_t>(block)];
+    counts.assign(static_cast<std::size_t>(kLanes * bins), 0);
+    const int64_t step = src.PixelStep();
+    for (int64_t y = blocks.Begin(block); y < blocks.End(block, src.height); y++) {
+      for (int64_t channel = 0; channel < src.channels; channel++) {
+        const uint8_t *row = src.Row(y, channel);
+        int64_t *lanes = counts.data() + (channel * kLanes * kHistogramBins);
+        for (int64_t x = 0; x < src.width; x++) {
+          lanes[((x % kLanes) * kHistogramBins) + row[x * step]]++;
+        }
+      }
+    }
+  });
+  std::vector<int64_t> histogram(static_cast<std::size_t>(bins), 0);
+  for (const auto &counts : partial) {
+    for (int64_t bin = 0; bin < bins; bin++) {
+      const int64_t channel = bin / kHistogramBins;
+      const int64_t value = bin % kHistogramBins;
+      for (int64_t lane = 0; lane < kLanes; lane++) {
+        histogram[static_cast<std::size_t>(bin)] +=
+            counts[static_cast<std::size_t>((((channel * kLanes) + lane) * kHistogramBins) + value)];
+      }
+    }
+  }
+  return histogram;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Resamples @p src to @p width x @p height with bilinear interpolation between pixel centres, e.g. to
+///        make large inputs from a small image. The result has the layout of @p src.
+/// @throws std::invalid_argument if @p src is empty or a target dimension is not positive.
+Image<uint8_t> ResizeBilinear(const ppc::parallel::ExecutionPolicy<kBackend> &policy, ImageView<const uint8_t> src,
+                              int64_t width, int64_t height) {
+  if (src.width < 1 || src.height < 1 || width < 1 || height < 1) {
+    throw std::invalid_argument("ResizeBilinear: source and target must not be empty");
+  }
+  // Source coordinate of a target pixel centre, clamped to the outermost source centres
+  auto source = [](int64_t i, int64_t from, int64_t to) {
+    const double scale = static_cast<double>(from) / static_cast<double>(to);
+    return std::clamp(((static_cast<double>(i) + 0.5) * scale) - 0.5, 0.0, static_cast<double>(from - 1));
+  };
+  Image<uint8_t> resized(width, height, src.channels, src.layout);
+  const ImageView<uint8_t> dst = resized.View();
+  ppc::parallel::ParallelFor(policy, 0, height, [&](int64_t y) {
+    const double sy = source(y, src.height, height);
+    const auto y0 = static_cast<int64_t>(sy);
+    const int64_t y1 = std::min(y0 + 1, src.height - 1);
+    const double fy = sy - static_cast<double>(y0);
+    for (int64_t x = 0; x < width; x++) {
+      const double sx = source(x, src.width, width);
+      const auto x0 = static_cast<int64_t>(sx);
+      const int64_t x1 = std::min(x0 + 1, src.width - 1);
+      const double fx = sx - static_cast<double>(x0);
+      for (int64_t channel = 0; channel < src.channels; channel++) {
+        const double top = ((1.0 - fx) * src(x0, y0, channel)) + (fx * src(x1, y0, channel));
+        const double bottom = ((1.0 - fx) * src(x0, y1, channel)) + (fx * src(x1, y1, channel));
+        dst(x, y, channel) = detail::ToByte(static_cast<float>(((1.0 - fy) * top) + (fy * bottom)));
+      }
+    }
+  });
+  return resized;
+}
+
+}  // namespace ppc::image
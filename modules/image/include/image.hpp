@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util/include/aligned_buffer.hpp"
+
+namespace ppc::image {
+
+/// @brief Order in which the channels of an image are stored.
+enum class ImageLayout : uint8_t {
+  /// Pixel by pixel with the channels of a pixel next to each other (RGBRGB...), as images are loaded
+  kInterleaved,
+  /// One whole plane per channel (RR...GG...BB...); rows of a channel are contiguous, which suits vector loops
+  kPlanar,
+};
+
+template <typename T>
+/// @brief Non-owning view of an image whose rows are @p row_stride elements apart.
+/// @details Used for whole images as well as for bands of rows (see Rows()), e.g. the strip of a rank with its halo
+///          rows; an ImageView<T> converts to ImageView<const T>.
+struct ImageView {
+  T *data = nullptr;
+  int64_t width = 0;
+  int64_t height = 0;
+  int64_t channels = 1;
+  ImageLayout layout = ImageLayout::kInterleaved;
+  /// Distance between two rows in elements (within a plane for kPlanar)
+  int64_t row_stride = 0;
+  /// Distance between two planes in elements; unused for kInterleaved
+  int64_t plane_stride = 0;
+
+  /// @brief Returns the distance between two pixels of a row in elements.
+  [[nodiscard]] int64_t PixelStep() const {
+    return layout == ImageLayout::kPlanar ? 1 : channels;
+  }
+
+  /// @brief Returns the first element of @p channel in row @p y; pixel x is PixelStep() * x elements further.
+  [[nodiscard]] T *Row(int64_t y, int64_t channel) const {
+    return layout == ImageLayout::kPlanar ? data + (channel * plane_stride) + (y * row_stride)
+                                          : data + (y * row_stride) + channel;
+  }
+
+  T &operator()(int64_t x, int64_t y, int64_t channel) const {
+    return Row(y, channel)[x * PixelStep()];
+  }
+
+  /// @brief Returns rows [@p first, @p first + @p count) of the view.
+  [[nodiscard]] ImageView Rows(int64_t first, int64_t count) const {
+    ImageView rows = *this;
+    rows.data = data + (first * row_stride);
+    rows.height = count;
+    return rows;
+  }
+
+  operator ImageView<const T>() const  // NOLINT(google-explicit-constructor)
+    requires(!std::is_const_v<T>)
+  {
+    return {.data = data,
+            .width = width,
+            .height = height,
+            .channels = channels,
+            .layout = layout,
+            .row_stride = row_stride,
+            .plane_stride = plane_stride};
+  }
+};
+
+template <typename T>
+/// @brief Densely packed image on an AlignedBuffer in interleaved or planar layout.
+/// @details Filters accept either layout (see filters.hpp); the planar one lets them read a row of a channel with
+///          unit stride. ToLayout() converts between the two.
+/// @tparam T Arithmetic element type, e.g. uint8_t for 8-bit images.
+class Image {
+  static_assert(std::is_arithmetic_v<T>, "Image requires an arithmetic element type");
+
+ public:
+  Image() = default;
+
+  /// @brief Allocates a @p width x @p height image with @p channels channels filled with @p value.
+  /// @throws std::invalid_argument if a dimension is negative or there is no channel.
+  Image(int64_t width, int64_t height, int64_t channels, ImageLayout layout = ImageLayout::kInterleaved,
+        const T &value = T{})
+      : width_(width), height_(height), channels_(channels), layout_(layout) {
+    if (width < 0 || height < 0 || channels < 1) {
+      throw std::invalid_argument("Image: dimensions must not be negative and there must be a channel");
+    }
+    data_ = ppc::util::AlignedBuffer<T>(static_cast<std::size_t>(width * height * channels), value);
+  }
+
+  /// @brief Copies the interleaved @p values of a @p width x @p height image, e.g. as returned by stb_image.
+  static Image FromInterleaved(std::span<const T> values, int64_t width, int64_t height, int64_t channels,
+                               ImageLayout layout = ImageLayout::kInterleaved) {
+    Image image(width, height, channels, ImageLayout::kInterleaved);
+    if (std::cmp_not_equal(values.size(), image.data_.Size())) {
+      throw std::invalid_argument("Image::FromInterleaved: size does not match the dimensions");
+    }
+    std::ranges::copy(values, image.data_.Data());
+    return layout == ImageLayout::kInterleaved ? image : image.ToLayout(layout);
+  }
+
+  /// @brief Returns the pixels in interleaved order.
+  [[nodiscard]] std::vector<T> ToInterleaved() const {
+    if (layout_ == ImageLayout::kInterleaved) {
+      return {data_.begin(), data_.end()};
+    }
+    const Image interleaved = ToLayout(ImageLayout::kInterleaved);
+    return {interleaved.data_.begin(), interleaved.data_.end()};
+  }
+
+  /// @brief Returns a copy of the image stored in @p layout.
+  [[nodiscard]] Image ToLayout(ImageLayout layout) const {
+    Image converted(width_, height_, channels_, layout);
+    const ImageView<const T> src = View();
+    const ImageView<T> dst = converted.View();
+    for (int64_t channel = 0; channel < channels_; channel++) {
+      for (int64_t y = 0; y < height_; y++) {
+        const T *src_row = src.Row(y, channel);
+        T *dst_row = dst.Row(y, channel);
+        for (int64_t x = 0; x < width_; x++) {
+          dst_row[x * dst.PixelStep()] = src_row[x * src.PixelStep()];
+        }
+      }
+    }
+    return converted;
+  }
+
+  [[nodiscard]] int64_t Width() const {
+    return width_;
+  }
+  [[nodiscard]] int64_t Height() const {
+    return height_;
+  }
+  [[nodiscard]] int64_t Channels() const {
+    return channels_;
+  }
+  [[nodiscard]] ImageLayout Layout() const {
+    return layout_;
+  }
+  /// @brief Returns the number of pixels, width x height.
+  [[nodiscard]] int64_t Pixels() const {
+    return width_ * height_;
+  }
+
+  T &operator()(int64_t x, int64_t y, int64_t channel) {
+    return View()(x, y, channel);
+  }
+  const T &operator()(int64_t x, int64_t y, int64_t channel) const {
+    return View()(x, y, channel);
+  }
+  [[nodiscard]] T *Data() {
+    return data_.Data();
+  }
+  [[nodiscard]] const T *Data() const {
+    return data_.Data();
+  }
+
+  [[nodiscard]] ImageView<T> View() {
+    return MakeView(data_.Data());
+  }
+  [[nodiscard]] ImageView<const T> View() const {
+    return MakeView(data_.Data());
+  }
+
+  /// @brief Images are equal if they have the same shape and pixels; the layout is not compared.
+  friend bool operator==(const Image &lhs, const Image &rhs) {
+    if (lhs.width_ != rhs.width_ || lhs.height_ != rhs.height_ || lhs.channels_ != rhs.channels_) {
+      return false;
+    }
+    return lhs.layout_ == rhs.layout_ ? lhs.data_ == rhs.data_ : lhs.ToInterleaved() == rhs.ToInterleaved();
+  }
+
+ private:
+  template <typename U>
+  ImageView<U> MakeView(U *data) const {
+    const bool planar = layout_ == ImageLayout::kPlanar;
+    return {.data = data,
+            .width = width_,
+            .height = height_,
+            .channels = channels_,
+            .layout = layout_,
+            .row_stride = planar ? width_ : width_ * channels_,
+            .plane_stride = planar ? width_ * height_ : 0};
+  }
+
+  int64_t width_ = 0;
+  int64_t height_ = 0;
+  int64_t channels_ = 1;
+  ImageLayout layout_ = ImageLayout::kInterleaved;
+  ppc::util::AlignedBuffer<T> data_;
+};
+
+}  // namespace ppc::image
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "image/include/image.hpp"
+
+namespace ppc::image {
+
+/// @brief Loads an 8-bit image file (JPEG, PNG, BMP, PNM, ... as supported by stb_image).
+/// @details The file is decoded once per process through ppc::util::LoadImageData(); every call copies the pixels.
+/// @param path Absolute path, e.g. from ppc::util::GetAbsoluteTaskPath().
+/// @param channels Channels of the result; the file is converted (e.g. 3 for RGB, 1 for gray).
+/// @param layout Layout of the result.
+/// @throws std::runtime_error if the file cannot be read or decoded, std::invalid_argument if @p channels is not
+///         in [1, 4].
+Image<uint8_t> LoadImage(const std::string &path, int channels = 3, ImageLayout layout = ImageLayout::kInterleaved);
+
+}  // namespace ppc::image
@@ -0,0 +1,16 @@
+#include "image/include/image_io.hpp"
+
+#include <cstdint>
+#include <string>
+
+#include "image/include/image.hpp"
+#include "util/include/test_data.hpp"
+
+namespace ppc::image {
+
+Image<uint8_t> LoadImage(const std::string &path, int channels, ImageLayout layout) {
+  const auto data = ppc::util::LoadImageData(path, channels);
+  return Image<uint8_t>::FromInterleaved(data->Pixels(), data->Width(), data->Height(), channels, layout);
+}
+
+}  // namespace ppc::image
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util/include/aligned_buffer.hpp"
+#include "util/include/cache_line.hpp"
+
+namespace ppc::linalg {
+
+template <typename T>
+/// @brief Non-owning view of a row-major matrix whose rows are @p stride elements apart.
+/// @details Used for whole matrices as well as for tiles of them (see Block()); a MatrixView<T> converts to
+///          MatrixView<const T>.
+struct MatrixView {
+  T *data = nullptr;
+  int64_t rows = 0;
+  int64_t cols = 0;
+  /// Distance between two rows in elements, at least cols
+  int64_t stride = 0;
+
+  T &operator()(int64_t row, int64_t col) const {
+    return data[(row * stride) + col];
+  }
+
+  /// @brief Returns the @p block_rows x @p block_cols tile starting at (@p row, @p col); the tile is clipped to
+  ///        the matrix.
+  [[nodiscard]] MatrixView Block(int64_t row, int64_t col, int64_t block_rows, int64_t block_cols) const {
+    return {.data = data + (row * stride) + col,
+            .rows = std::min(block_rows, rows - row),
+            .cols = std::min(block_cols, cols - col),
+            .stride = stride};
+  }
+
+  operator MatrixView<const T>() const  // NOLINT(google-explicit-constructor)
+    requires(!std::is_const_v<T>)
+  {
+    return {.data = data, .rows = rows, .cols = cols, .stride = stride};
+  }
+};
+
+template <typename T>
+/// @brief Row-major dense matrix on an AlignedBuffer whose rows start on cache-line boundaries.
+/// @details The stride is rounded up to a whole number of cache lines, so every row (and every tile starting at a
+///          multiple of kRowAlignment columns) is aligned for vector loads. The padding elements are zero.
+/// @tparam T Arithmetic element type.
+class DenseMatrix {
+  static_assert(std::is_arithmetic_v<T>, "DenseMatrix requires an arithmetic element type");
+
+ public:
+  /// @brief Number of elements in a cache line; the stride is a multiple of it.
+  static constexpr int64_t kRowAlignment = static_cast<int64_t>(ppc::util::kCacheLineSize / sizeof(T));
+
+  DenseMatrix() = default;
+
+  /// @brief Allocates a @p rows x @p cols matrix filled with @p value.
+  /// @param first_touch Thread partitioning of the first write; use the backend that later processes the matrix.
+  DenseMatrix(int64_t rows, int64_t cols, const T &value = T{},
+              ppc::util::FirstTouch first_touch = ppc::util::FirstTouch::kOMP)
+      : rows_(rows), cols_(cols), stride_(PaddedStride(cols)) {
+    if (rows < 0 || cols < 0) {
+      throw std::invalid_argument("DenseMatrix: dimensions must not be negative");
+    }
+    data_ = ppc::util::AlignedBuffer<T>(static_cast<std::size_t>(rows_ * stride_), T{}, first_touch);
+    if (value != T{}) {
+      Fill(value);
+    }
+  }
+
+  /// @brief Copies the densely packed row-major @p values of a @p rows x @p cols matrix.
+  static DenseMatrix FromRowMajor(std::span<const T> values, int64_t rows, int64_t cols,
+                                  ppc::util::FirstTouch first_touch = ppc::util::FirstTouch::kOMP) {
+    if (std::cmp_not_equal(values.size(), rows * cols)) {
+      throw std::invalid_argument("DenseMatrix::FromRowMajor: size does not match the dimensions");
+    }
+    DenseMatrix matrix(rows, cols, T{}, first_touch);
+    for (int64_t row = 0; row < rows; row++) {
+      std::copy_n(values.data() + (row * cols), cols, matrix.data_.Data() + (row * matrix.stride_));
+    }
+    return matrix;
+  }
+
+  /// @brief Returns the elements densely packed in row-major order (without the row padding).
+  [[nodiscard]] std::vector<T> ToRowMajor() const {
+    std::vector<T> values(static_cast<std::size_t>(rows_ * cols_));
+    for (int64_t row = 0; row < rows_; row++) {
+      std::copy_n(data_.Data() + (row * stride_), cols_, values.data() + (row * cols_));
+    }
+    return values;
+  }
+
+  [[nodiscard]] int64_t Rows() const {
+    return rows_;
+  }
+  [[nodiscard]] int64_t Cols() const {
+    return cols_;
+  }
+  /// @brief Returns the distance between two rows in elements.
+  [[nodiscard]] int64_t Stride() const {
+    return stride_;
+  }
+
+  T &operator()(int64_t row, int64_t col) {
+    return data_[static_cast<std::size_t>((row * stride_) + col)];
+  }
+  const T &operator()(int64_t row, int64_t col) const {
+    return data_[static_cast<std::size_t>((row * stride_) + col)];
+  }
+  [[nodiscard]] T *Data() {
+    return data_.Data();
+  }
+  [[nodiscard]] const T *Data() const {
+    return data_.Data();
+  }
+
+  [[nodiscard]] MatrixView<T> View() {
+    return {.data = data_.Data(), .rows = rows_, .cols = cols_, .stride = stride_};
+  }
+  [[nodiscard]] MatrixView<const T> View() const {
+    return {.data = data_.Data(), .rows = rows_, .cols = cols_, .stride = stride_};
+  }
+
+  /// @brief Sets every element (not the row padding) to @p value.
+  void Fill(const T &value) {
+    for (int64_t row = 0; row < rows_; row++) {
+      std::fill_n(data_.Data() + (row * stride_), cols_, value);
+    }
+  }
+
+ private:
+  static int64_t PaddedStride(int64_t cols) {
+    return ((std::max<int64_t>(cols, 0) + kRowAlignment - 1) / kRowAlignment) * kRowAlignment;
+  }
+
+  int64_t rows_ = 0;
+  int64_t cols_ = 0;
+  int64_t stride_ = 0;
+  ppc::util::AlignedBuffer<T> data_;
+};
+
+}  // namespace ppc::linalg
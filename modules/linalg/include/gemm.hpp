@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "linalg/include/dense_matrix.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+#include "util/include/aligned_buffer.hpp"
+#include "util/include/cache_line.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::linalg {
+
+/// @brief Cache blocking of Gemm(): the sizes of the packed panels.
+/// @details A kc x nc panel of B is packed once per step and shared by all threads (meant for the last-level
+///          cache); every thread packs mc x kc blocks of A (meant for its L2 cache) and multiplies them with the
+///          panel in kGemmMr x kGemmNr register tiles. The defaults suit double on common x86-64 and AArch64 cores.
+struct GemmBlocking {
+  int64_t mc = 96;
+  int64_t kc = 256;
+  int64_t nc = 2048;
+};
+
+/// @brief Rows of the register tile computed by the micro-kernel.
+inline constexpr int64_t kGemmMr = 4;
+
+template <typename T>
+/// @brief Columns of the register tile: one cache line of a packed B row per step of k.
+inline constexpr int64_t kGemmNr = static_cast<int64_t>(ppc::util::kCacheLineSize / sizeof(T));
+
+/// @brief Returns the floating-point operations of an @p m x @p k by @p k x @p n product (one multiply and one
+///        add per term), e.g. for PerfAttr::items_per_run.
+inline uint64_t GemmFlops(int64_t m, int64_t n, int64_t k) {
+  return 2 * static_cast<uint64_t>(m) * static_cast<uint64_t>(n) * static_cast<uint64_t>(k);
+}
+
+namespace detail {
+
+inline int64_t RoundUp(int64_t value, int64_t multiple) {
+  return ((value + multiple - 1) / multiple) * multiple;
+}
+
+template <typename T>
+/// Copies @p a into slivers of kGemmMr rows stored column by column; rows past the end are zero.
+void PackA(MatrixView<const T> a, T *packed) {
+  for (int64_t sliver = 0; sliver * kGemmMr < a.rows; sliver++) {
+    T *dst = packed + (sliver * a.cols * kGemmMr);
+    for (int64_t i = 0; i < kGemmMr; i++) {
+      const int64_t row = (sliver * kGemmMr) + i;
+      for (int64_t p = 0; p < a.cols; p++) {
+        dst[(p * kGemmMr) + i] = row < a.rows ? a(row, p) : T{};
+      }
+    }
+  }
+}
+
+template <typename T>
+/// Copies slivers [@p first, @p last) of kGemmNr columns of @p b stored row by row; columns past the end are zero.
+void PackB(MatrixView<const T> b, int64_t first, int64_t last, T *packed) {
+  constexpr int64_t kNr = kGemmNr<T>;
+  for (int64_t sliver = first; sliver < last; sliver++) {
+    T *dst = packed + (sliver * b.rows * kNr);
+    const int64_t col = sliver * kNr;
+    const int64_t width = std::min(kNr, b.cols - col);
+    for (int64_t p = 0; p < b.rows; p++) {
+      std::copy_n(&b(p, col), width, dst + (p * kNr));
+      std::fill(dst + (p * kNr) + width, dst + ((p + 1) * kNr), T{});
+    }
+  }
+}
+
+template <typename T>
+/// Register tile of the product of a packed A sliver and a packed B sliver over @p kc steps. The inner loop is
+/// the vectorized one: one broadcast element of A times one row of B per accumulator row.
+std::array<T, kGemmMr * kGemmNr<T>> MicroKernel(int64_t kc, const T *a, const T *b) {
+  constexpr int64_t kNr = kGemmNr<T>;
+  std::array<T, kGemmMr * kNr> acc{};
+  for (int64_t p = 0; p < kc; p++) {
+    const T *a_step = a + (p * kGemmMr);
+    const T *b_step = b + (p * kNr);
+    for (int64_t i = 0; i < kGemmMr; i++) {
+      const T a_value = a_step[i];
+      T *acc_row = acc.data() + (i * kNr);
+#pragma omp simd
+      for (int64_t j = 0; j < kNr; j++) {
+        acc_row[j] += a_value * b_step[j];
+      }
+    }
+  }
+  return acc;
+}
+
+template <typename T>
+/// Adds alpha times the product of a packed mc x kc block of A and a packed kc x nc panel of B to @p c.
+void MacroKernel(T alpha, int64_t kc, const T *a_packed, const T *b_packed, MatrixView<T> c) {
+  constexpr int64_t kNr = kGemmNr<T>;
+  for (int64_t col = 0; col < c.cols; col += kNr) {
+    const T *b_sliver = b_packed + ((col / kNr) * kc * kNr);
+    const int64_t width = std::min(kNr, c.cols - col);
+    for (int64_t row = 0; row < c.rows; row += kGemmMr) {
+      const auto acc = MicroKernel(kc, a_packed + ((row / kGemmMr) * kc * kGemmMr), b_sliver);
+      const int64_t height = std::min(kGemmMr, c.rows - row);
+      for (int64_t i = 0; i < height; i++) {
+        T *c_row = &c(row + i, col);
+        for (int64_t j = 0; j < width; j++) {
+          c_row[j] += alpha * acc[static_cast<std::size_t>((i * kNr) + j)];
+        }
+      }
+    }
+  }
+}
+
+template <ppc::task::TypeOfTask kBackend, typename T>
+void ScaleRows(const ppc::parallel::ExecutionPolicy<kBackend> &policy, T beta, MatrixView<T> c) {
+  if (beta == T{1}) {
+    return;
+  }
+  ppc::parallel::ParallelFor(policy, 0, c.rows, [&](int64_t row) {
+    T *c_row = &c(row, 0);
+    for (int64_t col = 0; col < c.cols; col++) {
+      // beta == 0 overwrites C, as in BLAS, so uninitialized values (NaN) do not propagate
+      c_row[col] = beta == T{} ? T{} : beta * c_row[col];
+    }
+  });
+}
+
+}  // namespace detail
+
+template <ppc::task::TypeOfTask kBackend, typename T>
+/// @brief Computes C = alpha * A * B + beta * C with a cache-blocked, packed algorithm (GotoBLAS loop order).
+/// @details For every nc-column panel and kc-deep step, the B panel is packed in parallel and the mc-row blocks of
+///          A are then packed and multiplied in parallel, one block per task, into disjoint rows of C. Every element
+///          of C receives its kc-step partial sums in the same order under every backend and thread count, so all
+///          policies give bit-identical results.
+/// @param policy Threading backend.
+/// @param a m x k matrix.
+/// @param b k x n matrix.
+/// @param c m x n matrix; must not overlap @p a or @p b.
+/// @param blocking Panel sizes; mc and nc are rounded up to the register tile.
+/// @throws std::invalid_argument if the shapes do not match or a block size is not positive.
+void Gemm(const ppc::parallel::ExecutionPolicy<kBackend> &policy, std::type_identity_t<T> alpha,
+          std::type_identity_t<MatrixView<const T>> a, std::type_identity_t<MatrixView<const T>> b,
+          std::type_identity_t<T> beta, MatrixView<T> c, const GemmBlocking &blocking = {}) {
+  if (a.rows != c.rows || b.cols != c.cols || a.cols != b.rows) {
+    throw std::invalid_argument("Gemm: matrix shapes do not match");
+  }
+  if (blocking.mc <= 0 || blocking.kc <= 0 || blocking.nc <= 0) {
+    throw std::invalid_argument("Gemm: block sizes must be positive");
+  }
+  constexpr int64_t kNr = kGemmNr<T>;
+  const int64_t m = c.rows;
+  const int64_t n = c.cols;
+  const int64_t k = a.cols;
+  detail::ScaleRows(policy, beta, c);
+  if (alpha == T{} || m == 0 || n == 0 || k == 0) {
+    return;
+  }
+
+  // Smaller row blocks when a matrix is too short to give every thread a few of them
+  const int64_t threads = kBackend == ppc::task::TypeOfTask::kSEQ ? 1 : ppc::util::GetNumThreads();
+  const int64_t tasks = threads * ppc::parallel::kBlocksPerThread;
+  const int64_t mc = detail::RoundUp(std::min(blocking.mc, (m + tasks - 1) / tasks), kGemmMr);
+  const int64_t kc = std::min(blocking.kc, k);
+  const int64_t nc = std::min(detail::RoundUp(blocking.nc, kNr), detail::RoundUp(n, kNr));
+
+  ppc::util::AlignedBuffer<T> b_packed(static_cast<std::size_t>(kc * nc), T{}, ppc::util::FirstTouch::kSequential);
+  for (int64_t jc = 0; jc < n; jc += nc) {
+    for (int64_t pc = 0; pc < k; pc += kc) {
+      const MatrixView<const T> b_panel = b.Block(pc, jc, kc, nc);
+      const int64_t depth = b_panel.rows;
+      ppc::parallel::ParallelForRange(policy, 0, (b_panel.cols + kNr - 1) / kNr, [&](int64_t first, int64_t last) {
+        detail::PackB(b_panel, first, last, b_packed.Data());
+      });
+      ppc::parallel::ForEachBlock(policy, (m + mc - 1) / mc, [&](int64_t block) {
+        // One buffer per worker thread, reused by all Gemm() calls on it
+        thread_local ppc::util::AlignedBuffer<T> a_packed(0, T{}, ppc::util::FirstTouch::kSequential);
+        const MatrixView<const T> a_block = a.Block(block * mc, pc, mc, depth);
+        a_packed.Resize(static_cast<std::size_t>(detail::RoundUp(a_block.rows, kGemmMr) * depth));
+        detail::PackA(a_block, a_packed.Data());
+        detail::MacroKernel<T>(alpha, depth, a_packed.Data(), b_packed.Data(), c.Block(block * mc, jc, mc, nc));
+      });
+    }
+  }
+}
+
+template <typename T>
+/// @brief Straightforward C = alpha * A * B + beta * C without blocking, the reference for testing Gemm().
+/// @throws std::invalid_argument if the shapes do not match.
+void GemmReference(std::type_identity_t<T> alpha, std::type_identity_t<MatrixView<const T>> a,
+                   std::type_identity_t<MatrixView<const T>> b, std::type_identity_t<T> beta, MatrixView<T> c) {
+  if (a.rows != c.rows || b.cols != c.cols || a.cols != b.rows) {
+    throw std::invalid_argument("GemmReference: matrix shapes do not match");
+  }
+  for (int64_t row = 0; row < c.rows; row++) {
+    for (int64_t col = 0; col < c.cols; col++) {
+      T sum{};
+      for (int64_t p = 0; p < a.cols; p++) {
+        sum += a(row, p) * b(p, col);
+      }
+      c(row, col) = (alpha * sum) + (beta == T{} ? T{} : beta * c(row, col));
+    }
+  }
+}
+
+}  // namespace ppc::linalg
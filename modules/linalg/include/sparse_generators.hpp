@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "linalg/include/sparse_matrix.hpp"
+
+namespace ppc::linalg {
+
+/// @brief Shape of a matrix produced by MakeRandomMatrix().
+struct RandomMatrixOptions {
+  int64_t rows = 0;
+  int64_t cols = 0;
+  /// Average number of entries per row
+  double nnz_per_row = 8.0;
+  /// 0 gives all rows about nnz_per_row entries; values in (0, 1) draw the row lengths from a power law with the
+  /// same mean, so a few rows are much longer than the rest (as in web or social graphs)
+  double skew = 0.0;
+  uint64_t seed = 0;
+};
+
+/// @brief Returns an @p n x @p n matrix with entries on the diagonals -@p lower .. +@p upper, e.g. a discretized
+///        differential operator.
+/// @details The off-diagonal values are random in [-1, 1) and every diagonal entry is one more than the absolute
+///          sum of the other entries of its row, so the matrix is strictly diagonally dominant.
+inline CsrMatrix<double> MakeBandedMatrix(int64_t n, int lower, int upper, uint64_t seed = 0) {
+  if (n < 0 || n > std::numeric_limits<int>::max() || lower < 0 || upper < 0) {
+    throw std::invalid_argument("MakeBandedMatrix: invalid size or band width");
+  }
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<int64_t> row_ptr(static_cast<std::size_t>(n) + 1, 0);
+  std::vector<int> col_idx;
+  std::vector<double> values;
+  col_idx.reserve(static_cast<std::size_t>(n * (lower + upper + 1)));
+  values.reserve(col_idx.capacity());
+  for (int64_t row = 0; row < n; row++) {
+    const int64_t first = std::max<int64_t>(0, row - lower);
+    const int64_t last = std::min<int64_t>(n - 1, row + upper);
+    const auto diagonal = static_cast<std::size_t>(values.size() + (row - first));
+    double off_diagonal = 0.0;
+    for (int64_t col = first; col <= last; col++) {
+      const double value = col == row ? 0.0 : dist(gen);
+      off_diagonal += std::abs(value);
+      col_idx.push_back(static_cast<int>(col));
+      values.push_back(value);
+    }
+    values[diagonal] = off_diagonal + 1.0;
+    row_ptr[static_cast<std::size_t>(row) + 1] = static_cast<int64_t>(values.size());
+  }
+  return {n, n, std::move(row_ptr), std::move(col_idx), std::move(values)};
+}
+
+/// @brief Returns a matrix whose rows have entries at uniformly random distinct columns, with values in [-1, 1).
+/// @details Every row gets at least one entry. With RandomMatrixOptions::skew > 0 the row lengths are very uneven,
+///          which is what nnz-balanced row partitioning (ppc::util::PrefixRanges()) is for.
+inline CsrMatrix<double> MakeRandomMatrix(const RandomMatrixOptions &options) {
+  if (options.rows < 0 || options.cols <= 0 || options.cols > std::numeric_limits<int>::max() ||
+      options.nnz_per_row < 1.0 || options.skew < 0.0 || options.skew >= 1.0) {
+    throw std::invalid_argument("MakeRandomMatrix: invalid options");
+  }
+  std::mt19937_64 gen(options.seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::uniform_int_distribution<int> column(0, static_cast<int>(options.cols - 1));
+  std::vector<int64_t> row_ptr(static_cast<std::size_t>(options.rows) + 1, 0);
+  std::vector<int> col_idx;
+  std::vector<double> values;
+  std::vector<int> row_cols;
+  for (int64_t row = 0; row < options.rows; row++) {
+    // (1 - s) * u^-s has mean 1 for u uniform in (0, 1]
+    const double scale = (1.0 - options.skew) * std::pow(1.0 - unit(gen), -options.skew);
+    const auto length = std::clamp<int64_t>(std::llround(options.nnz_per_row * scale), 1, options.cols);
+    row_cols.clear();
+    while (std::cmp_less(row_cols.size(), length)) {
+      row_cols.push_back(column(gen));
+      if (std::cmp_equal(row_cols.size(), length)) {
+        std::ranges::sort(row_cols);
+        row_cols.erase(std::ranges::unique(row_cols).begin(), row_cols.end());
+      }
+    }
+    for (int col : row_cols) {
+      col_idx.push_back(col);
+      values.push_back(dist(gen));
+    }
+    row_ptr[static_cast<std::size_t>(row) + 1] = static_cast<int64_t>(values.size());
+  }
+  return {options.rows, options.cols, std::move(row_ptr), std::move(col_idx), std::move(values)};
+}
+
+}  // namespace ppc::linalg
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::linalg {
+
+template <typename T>
+class CscMatrix;
+
+template <typename T>
+/// @brief Compressed sparse row matrix.
+/// @details The entries of row r are [RowPtr()[r], RowPtr()[r + 1]) of ColIdx() and Values(), with the column
+///          indices strictly increasing within a row. Column indices are int, which keeps the index stream small
+///          (SpMV is bandwidth-bound) and lets it be sent with MPI_INT.
+/// @tparam T Arithmetic value type.
+class CsrMatrix {
+  static_assert(std::is_arithmetic_v<T>, "CsrMatrix requires an arithmetic value type");
+
+ public:
+  /// @brief Creates an empty 0 x 0 matrix.
+  CsrMatrix() = default;
+
+  /// @brief Takes over the three CSR arrays of a @p rows x @p cols matrix.
+  /// @throws std::invalid_argument if the arrays are inconsistent or a row has unsorted or out-of-range columns.
+  CsrMatrix(int64_t rows, int64_t cols, std::vector<int64_t> row_ptr, std::vector<int> col_idx, std::vector<T> values)
+      : rows_(rows),
+        cols_(cols),
+        row_ptr_(std::move(row_ptr)),
+        col_idx_(std::move(col_idx)),
+        values_(std::move(values)) {
+    Validate();
+  }
+
+  /// @brief Builds a matrix from (row, col, value) entries in any order; duplicates are summed.
+  static CsrMatrix FromTriplets(int64_t rows, int64_t cols, std::vector<std::tuple<int64_t, int, T>> triplets) {
+    auto position = [](const auto &entry) { return std::pair(std::get<0>(entry), std::get<1>(entry)); };
+    std::ranges::sort(triplets, {}, position);
+    std::vector<int64_t> row_ptr(static_cast<std::size_t>(std::max<int64_t>(rows, 0) + 1), 0);
+    std::vector<int> col_idx;
+    std::vector<T> values;
+    int64_t last_row = -1;
+    for (const auto &[row, col, value] : triplets) {
+      if (row < 0 || row >= rows) {
+        throw std::invalid_argument("CsrMatrix::FromTriplets: row index out of range");
+      }
+      if (row == last_row && col == col_idx.back()) {
+        values.back() += value;
+        continue;
+      }
+      col_idx.push_back(col);
+      values.push_back(value);
+      row_ptr[static_cast<std::size_t>(row) + 1]++;
+      last_row = row;
+    }
+    for (std::size_t row = 1; row < row_ptr.size(); row++) {
+      row_ptr[row] += row_ptr[row - 1];
+    }
+    return {rows, cols, std::move(row_ptr), std::move(col_idx), std::move(values)};
+  }
+
+  [[nodiscard]] int64_t Rows() const {
+    return rows_;
+  }
+  [[nodiscard]] int64_t Cols() const {
+    return cols_;
+  }
+  /// @brief Returns the number of stored entries.
+  [[nodiscard]] int64_t NonZeros() const {
+    return static_cast<int64_t>(values_.size());
+  }
+
+  [[nodiscard]] std::span<const int64_t> RowPtr() const {
+    return row_ptr_;
+  }
+  [[nodiscard]] std::span<const int> ColIdx() const {
+    return col_idx_;
+  }
+  [[nodiscard]] std::span<const T> Values() const {
+    return values_;
+  }
+  /// @brief Returns the values for in-place updates; the sparsity pattern cannot be changed.
+  [[nodiscard]] std::span<T> Values() {
+    return values_;
+  }
+
+  /// @brief Returns the same matrix in compressed sparse column format.
+  [[nodiscard]] CscMatrix<T> ToCsc() const;
+
+  bool operator==(const CsrMatrix &) const = default;
+
+ private:
+  void Validate() const {
+    if (rows_ < 0 || cols_ < 0 || std::cmp_not_equal(row_ptr_.size(), rows_ + 1) || row_ptr_.front() != 0 ||
+        std::cmp_not_equal(row_ptr_.back(), col_idx_.size()) || col_idx_.size() != values_.size()) {
+      throw std::invalid_argument("CsrMatrix: inconsistent row pointers, column indices or values");
+    }
+    for (int64_t row = 0; row < rows_; row++) {
+      const auto begin = row_ptr_[static_cast<std::size_t>(row)];
+      const auto end = row_ptr_[static_cast<std::size_t>(row) + 1];
+      if (end < begin) {
+        throw std::invalid_argument("CsrMatrix: row pointers must not decrease");
+      }
+      for (int64_t entry = begin; entry < end; entry++) {
+        const int col = col_idx_[static_cast<std::size_t>(entry)];
+        const bool sorted = entry == begin || col_idx_[static_cast<std::size_t>(entry) - 1] < col;
+        if (col < 0 || col >= cols_ || !sorted) {
+          throw std::invalid_argument("CsrMatrix: column indices must be in range and increasing within a row");
+        }
+      }
+    }
+  }
+
+  int64_t rows_ = 0;
+  int64_t cols_ = 0;
+  std::vector<int64_t> row_ptr_{0};
+  std::vector<int> col_idx_;
+  std::vector<T> values_;
+};
+
+template <typename T>
+/// @brief Compressed sparse column matrix, the transposed storage of CsrMatrix.
+/// @details The entries of column c are [ColPtr()[c], ColPtr()[c + 1]) of RowIdx() and Values(), with the row
+///          indices strictly increasing within a column. Row indices are int like the column indices of CsrMatrix.
+/// @tparam T Arithmetic value type.
+class CscMatrix {
+  static_assert(std::is_arithmetic_v<T>, "CscMatrix requires an arithmetic value type");
+
+ public:
+  /// @brief Creates an empty 0 x 0 matrix.
+  CscMatrix() = default;
+
+  /// @brief Takes over the three CSC arrays of a @p rows x @p cols matrix.
+  /// @throws std::invalid_argument if the arrays are inconsistent or a column has unsorted or out-of-range rows.
+  CscMatrix(int64_t rows, int64_t cols, std::vector<int64_t> col_ptr, std::vector<int> row_idx, std::vector<T> values)
+      : transposed_(cols, rows, std::move(col_ptr), std::move(row_idx), std::move(values)) {}
+
+  [[nodiscard]] int64_t Rows() const {
+    return transposed_.Cols();
+  }
+  [[nodiscard]] int64_t Cols() const {
+    return transposed_.Rows();
+  }
+  [[nodiscard]] int64_t NonZeros() const {
+    return transposed_.NonZeros();
+  }
+  [[nodiscard]] std::span<const int64_t> ColPtr() const {
+    return transposed_.RowPtr();
+  }
+  [[nodiscard]] std::span<const int> RowIdx() const {
+    return transposed_.ColIdx();
+  }
+  [[nodiscard]] std::span<const T> Values() const {
+    return transposed_.Values();
+  }
+  [[nodiscard]] std::span<T> Values() {
+    return transposed_.Values();
+  }
+
+  /// @brief Returns the same matrix in compressed sparse row format.
+  [[nodiscard]] CsrMatrix<T> ToCsr() const {
+    // Converting the CSR form of the transpose to CSC gives the CSR arrays of this matrix
+    const CscMatrix<T> swapped = transposed_.ToCsc();
+    return {Rows(), Cols(), std::vector<int64_t>(swapped.ColPtr().begin(), swapped.ColPtr().end()),
+            std::vector<int>(swapped.RowIdx().begin(), swapped.RowIdx().end()),
+            std::vector<T>(swapped.Values().begin(), swapped.Values().end())};
+  }
+
+  bool operator==(const CscMatrix &) const = default;
+
+ private:
+  /// The CSC arrays of a matrix are the CSR arrays of its transpose
+  CsrMatrix<T> transposed_;
+};
+
+template <typename T>
+CscMatrix<T> CsrMatrix<T>::ToCsc() const {
+  // Counting sort of the entries by column; visiting the rows in order keeps the row indices increasing
+  std::vector<int64_t> col_ptr(static_cast<std::size_t>(cols_) + 1, 0);
+  for (int col : col_idx_) {
+    col_ptr[static_cast<std::size_t>(col) + 1]++;
+  }
+  for (std::size_t col = 1; col < col_ptr.size(); col++) {
+    col_ptr[col] += col_ptr[col - 1];
+  }
+  std::vector<int64_t> next(col_ptr.begin(), col_ptr.end() - 1);
+  std::vector<int> row_idx(col_idx_.size());
+  std::vector<T> values(values_.size());
+  for (int64_t row = 0; row < rows_; row++) {
+    const auto end = static_cast<std::size_t>(row_ptr_[static_cast<std::size_t>(row) + 1]);
+    for (auto entry = static_cast<std::size_t>(row_ptr_[static_cast<std::size_t>(row)]); entry < end; entry++) {
+      const auto slot = static_cast<std::size_t>(next[static_cast<std::size_t>(col_idx_[entry])]++);
+      row_idx[slot] = static_cast<int>(row);
+      values[slot] = values_[entry];
+    }
+  }
+  return {rows_, cols_, std::move(col_ptr), std::move(row_idx), std::move(values)};
+}
+
+}  // namespace ppc::linalg
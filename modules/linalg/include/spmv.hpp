@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "linalg/include/sparse_matrix.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+#include "util/include/partition.hpp"
+
+namespace ppc::linalg {
+
+template <typename T>
+/// @brief Returns the bytes a sparse matrix-vector product with @p a has to move at least: every matrix entry and
+///        row pointer once, x and y once each, e.g. for PerfAttr::items_per_run.
+uint64_t SpMVBytes(const CsrMatrix<T> &a) {
+  const auto nnz = static_cast<uint64_t>(a.NonZeros());
+  return (nnz * (sizeof(T) + sizeof(int))) + ((static_cast<uint64_t>(a.Rows()) + 1) * sizeof(int64_t)) +
+         ((static_cast<uint64_t>(a.Cols()) + static_cast<uint64_t>(a.Rows())) * sizeof(T));
+}
+
+template <typename T>
+/// @brief Computes y[row] = (A x)[row] for the rows [@p first, @p last) of @p a.
+/// @details The building block of SpMV(), also usable directly when the rows are split by the caller (e.g. into
+///          rows that need halo values and rows that do not).
+void SpMVRows(const CsrMatrix<T> &a, std::type_identity_t<std::span<const T>> x,
+              std::type_identity_t<std::span<T>> y, int64_t first, int64_t last) {
+  const int64_t *row_ptr = a.RowPtr().data();
+  const int *col_idx = a.ColIdx().data();
+  const T *values = a.Values().data();
+  const T *xs = x.data();
+  for (int64_t row = first; row < last; row++) {
+    T sum{};
+    const int64_t end = row_ptr[row + 1];
+    for (int64_t entry = row_ptr[row]; entry < end; entry++) {
+      sum += values[entry] * xs[col_idx[entry]];
+    }
+    y[static_cast<std::size_t>(row)] = sum;
+  }
+}
+
+template <ppc::task::TypeOfTask kBackend, typename T>
+/// @brief Computes y = A x with the backend of @p policy.
+/// @details Rows are split into blocks of about the same number of entries (ppc::util::PrefixRanges() on the row
+///          pointers) rather than the same number of rows, so a few long rows do not leave one thread with most of
+///          the work. The blocks are then handed to the backend like in ForEachBlock().
+/// @param x Vector of a.Cols() elements.
+/// @param y Vector of a.Rows() elements; must not overlap @p x.
+/// @throws std::invalid_argument if the vector sizes do not match the matrix.
+void SpMV(const ppc::parallel::ExecutionPolicy<kBackend> &policy, const CsrMatrix<T> &a,
+          std::type_identity_t<std::span<const T>> x, std::type_identity_t<std::span<T>> y) {
+  if (std::cmp_not_equal(x.size(), a.Cols()) || std::cmp_not_equal(y.size(), a.Rows())) {
+    throw std::invalid_argument("SpMV: vector sizes do not match the matrix");
+  }
+  if (a.Rows() == 0) {
+    return;
+  }
+  const auto blocks = ppc::parallel::MakeBlocks(policy, std::max<int64_t>(a.NonZeros(), 1));
+  const auto ranges = ppc::util::PrefixRanges(a.RowPtr(), static_cast<int>(std::min(blocks.count, a.Rows())));
+  ppc::parallel::ForEachBlock(policy, static_cast<int64_t>(ranges.size()), [&](int64_t block) {
+    const auto &range = ranges[static_cast<std::size_t>(block)];
+    SpMVRows(a, x, y, range.begin, range.end);
+  });
+}
+
+template <typename T>
+/// @brief Computes y = A x column by column from the CSC form, the reference for testing SpMV().
+/// @throws std::invalid_argument if the vector sizes do not match the matrix.
+void SpMVReference(const CscMatrix<T> &a, std::type_identity_t<std::span<const T>> x,
+                   std::type_identity_t<std::span<T>> y) {
+  if (std::cmp_not_equal(x.size(), a.Cols()) || std::cmp_not_equal(y.size(), a.Rows())) {
+    throw std::invalid_argument("SpMVReference: vector sizes do not match the matrix");
+  }
+  std::ranges::fill(y, T{});
+  for (int64_t col = 0; col < a.Cols(); col++) {
+    const T value = x[static_cast<std::size_t>(col)];
+    const auto end = static_cast<std::size_t>(a.ColPtr()[static_cast<std::size_t>(col) + 1]);
+    for (auto entry = static_cast<std::size_t>(a.ColPtr()[static_cast<std::size_t>(col)]); entry < end; entry++) {
+      y[static_cast<std::size_t>(a.RowIdx()[entry])] += a.Values()[entry] * value;
+    }
+  }
+}
+
+}  // namespace ppc::linalg
@@ -0,0 +1,170 @@
+#include "linalg/include/gemm.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "linalg/include/dense_matrix.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/aligned_buffer.hpp"
+#include "util/include/cache_line.hpp"
+
+namespace {
+
+using ppc::linalg::DenseMatrix;
+using ppc::linalg::GemmBlocking;
+
+DenseMatrix<double> RandomMatrix(int64_t rows, int64_t cols, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  DenseMatrix<double> matrix(rows, cols);
+  for (int64_t row = 0; row < rows; row++) {
+    for (int64_t col = 0; col < cols; col++) {
+      matrix(row, col) = dist(gen);
+    }
+  }
+  return matrix;
+}
+
+void ExpectNear(const DenseMatrix<double> &actual, const DenseMatrix<double> &expected, int64_t k) {
+  ASSERT_EQ(actual.Rows(), expected.Rows());
+  ASSERT_EQ(actual.Cols(), expected.Cols());
+  // Entries are sums of k products of values in [-1, 1], added up in a different order than the reference
+  const double tolerance = 1e-13 * static_cast<double>(k + 1);
+  for (int64_t row = 0; row < actual.Rows(); row++) {
+    for (int64_t col = 0; col < actual.Cols(); col++) {
+      ASSERT_NEAR(actual(row, col), expected(row, col), tolerance) << "at " << row << ", " << col;
+    }
+  }
+}
+
+template <typename Policy>
+class GemmTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<ppc::parallel::SeqPolicy, ppc::parallel::OmpPolicy, ppc::parallel::TbbPolicy,
+                                  ppc::parallel::StlPolicy>;
+TYPED_TEST_SUITE(GemmTest, Policies);
+
+// Shapes around the register tile and small blocks, so every edge case of the packing is hit
+const std::vector<std::tuple<int64_t, int64_t, int64_t>> kShapes = {
+    {1, 1, 1}, {3, 5, 2}, {4, 8, 1}, {17, 33, 9}, {64, 64, 64}, {70, 19, 130}};
+const GemmBlocking kSmallBlocking{.mc = 8, .kc = 16, .nc = 24};
+
+}  // namespace
+
+TEST(DenseMatrixTest, RowsStartOnCacheLines) {
+  DenseMatrix<double> matrix(5, 3, 2.0);
+  EXPECT_EQ(matrix.Stride(), DenseMatrix<double>::kRowAlignment);
+  for (int64_t row = 0; row < matrix.Rows(); row++) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&matrix(row, 0)) % ppc::util::kCacheLineSize, 0U);
+    EXPECT_EQ(matrix(row, 2), 2.0);
+    // Padding stays zero
+    EXPECT_EQ(matrix.Data()[(row * matrix.Stride()) + 3], 0.0);
+  }
+  EXPECT_EQ(DenseMatrix<float>(1, 17).Stride(), 32);
+  EXPECT_THROW(DenseMatrix<double>(-1, 2), std::invalid_argument);
+}
+
+TEST(DenseMatrixTest, RowMajorRoundTripAndBlocks) {
+  std::vector<int> values(12);
+  for (int i = 0; i < 12; i++) {
+    values[static_cast<std::size_t>(i)] = i;
+  }
+  auto matrix = DenseMatrix<int>::FromRowMajor(values, 3, 4);
+  EXPECT_EQ(matrix(2, 1), 9);
+  EXPECT_EQ(matrix.ToRowMajor(), values);
+
+  const auto block = matrix.View().Block(1, 2, 5, 5);
+  EXPECT_EQ(block.rows, 2);
+  EXPECT_EQ(block.cols, 2);
+  EXPECT_EQ(block(1, 1), 11);
+  block(0, 0) = -1;
+  EXPECT_EQ(matrix(1, 2), -1);
+  EXPECT_THROW((void)DenseMatrix<int>::FromRowMajor(values, 5, 5), std::invalid_argument);
+}
+
+TYPED_TEST(GemmTest, MatchesReference) {
+  for (const auto &[m, n, k] : kShapes) {
+    for (const auto &blocking : {GemmBlocking{}, kSmallBlocking}) {
+      const auto a = RandomMatrix(m, k, 1);
+      const auto b = RandomMatrix(k, n, 2);
+      auto c = RandomMatrix(m, n, 3);
+      auto expected = c;
+      ppc::linalg::Gemm(TypeParam{}, 0.5, a.View(), b.View(), -2.0, c.View(), blocking);
+      ppc::linalg::GemmReference(0.5, a.View(), b.View(), -2.0, expected.View());
+      ExpectNear(c, expected, k);
+    }
+  }
+}
+
+TYPED_TEST(GemmTest, BitIdenticalToSeqPolicy) {
+  const auto a = RandomMatrix(97, 130, 4);
+  const auto b = RandomMatrix(130, 45, 5);
+  DenseMatrix<double> c(97, 45);
+  DenseMatrix<double> expected(97, 45);
+  ppc::linalg::Gemm(TypeParam{}, 1.0, a.View(), b.View(), 0.0, c.View(), kSmallBlocking);
+  ppc::linalg::Gemm(ppc::parallel::kSeq, 1.0, a.View(), b.View(), 0.0, expected.View(), kSmallBlocking);
+  EXPECT_EQ(c.ToRowMajor(), expected.ToRowMajor());
+}
+
+TYPED_TEST(GemmTest, WritesIntoSubBlocksOnly) {
+  const auto a = RandomMatrix(6, 7, 6);
+  const auto b = RandomMatrix(7, 5, 7);
+  DenseMatrix<double> c(10, 10, std::numeric_limits<double>::quiet_NaN());
+  // beta == 0 must overwrite the NaNs inside the block without reading them
+  ppc::linalg::Gemm(TypeParam{}, 1.0, a.View(), b.View(), 0.0, c.View().Block(2, 3, 6, 5));
+  DenseMatrix<double> expected(6, 5);
+  ppc::linalg::GemmReference(1.0, a.View(), b.View(), 0.0, expected.View());
+  for (int64_t row = 0; row < 10; row++) {
+    for (int64_t col = 0; col < 10; col++) {
+      const bool inside = row >= 2 && row < 8 && col >= 3 && col < 8;
+      if (inside) {
+        EXPECT_NEAR(c(row, col), expected(row - 2, col - 3), 1e-12);
+      } else {
+        EXPECT_TRUE(std::isnan(c(row, col)));
+      }
+    }
+  }
+}
+
+TEST(GemmFloatTest, MatchesReference) {
+  std::mt19937 gen(8);
+  std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+  DenseMatrix<float> a(33, 40);
+  DenseMatrix<float> b(40, 50);
+  for (auto *matrix : {&a, &b}) {
+    for (int64_t row = 0; row < matrix->Rows(); row++) {
+      for (int64_t col = 0; col < matrix->Cols(); col++) {
+        (*matrix)(row, col) = dist(gen);
+      }
+    }
+  }
+  DenseMatrix<float> c(33, 50);
+  DenseMatrix<float> expected(33, 50);
+  ppc::linalg::Gemm(ppc::parallel::kOmp, 1.0F, a.View(), b.View(), 0.0F, c.View(), kSmallBlocking);
+  ppc::linalg::GemmReference(1.0F, a.View(), b.View(), 0.0F, expected.View());
+  for (int64_t row = 0; row < 33; row++) {
+    for (int64_t col = 0; col < 50; col++) {
+      ASSERT_NEAR(c(row, col), expected(row, col), 1e-4F);
+    }
+  }
+}
+
+TEST(GemmArgumentsTest, RejectsMismatchedShapes) {
+  DenseMatrix<double> a(3, 4);
+  DenseMatrix<double> b(5, 2);
+  DenseMatrix<double> c(3, 2);
+  EXPECT_THROW(ppc::linalg::Gemm(ppc::parallel::kSeq, 1.0, a.View(), b.View(), 0.0, c.View()), std::invalid_argument);
+  DenseMatrix<double> b_ok(4, 2);
+  const GemmBlocking empty_steps{.kc = 0};
+  EXPECT_THROW(ppc::linalg::Gemm(ppc::parallel::kSeq, 1.0, a.View(), b_ok.View(), 0.0, c.View(), empty_steps),
+               std::invalid_argument);
+  EXPECT_EQ(ppc::linalg::GemmFlops(2, 3, 4), 48U);
+}
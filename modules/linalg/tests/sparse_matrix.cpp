@@ -0,0 +1,146 @@
+#include "linalg/include/sparse_matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "linalg/include/sparse_generators.hpp"
+#include "linalg/include/spmv.hpp"
+#include "parallel/include/execution_policy.hpp"
+
+namespace {
+
+using ppc::linalg::CsrMatrix;
+
+std::vector<double> RandomVector(int64_t size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> vector(static_cast<std::size_t>(size));
+  std::ranges::generate(vector, [&]() { return dist(gen); });
+  return vector;
+}
+
+std::vector<double> ReferenceProduct(const CsrMatrix<double> &a, const std::vector<double> &x) {
+  std::vector<double> y(static_cast<std::size_t>(a.Rows()));
+  ppc::linalg::SpMVReference(a.ToCsc(), x, y);
+  return y;
+}
+
+void ExpectNear(const std::vector<double> &actual, const std::vector<double> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < actual.size(); i++) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-12 * (1.0 + std::abs(expected[i]))) << "at " << i;
+  }
+}
+
+template <typename Policy>
+class SpMVTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<ppc::parallel::SeqPolicy, ppc::parallel::OmpPolicy, ppc::parallel::TbbPolicy,
+                                  ppc::parallel::StlPolicy>;
+TYPED_TEST_SUITE(SpMVTest, Policies);
+
+}  // namespace
+
+TEST(SparseMatrixTest, FromTripletsSortsAndSumsDuplicates) {
+  const auto a = CsrMatrix<double>::FromTriplets(3, 4, {{2, 1, 1.0}, {0, 3, 2.0}, {0, 0, 3.0}, {2, 1, 4.0}});
+  EXPECT_EQ(a.NonZeros(), 3);
+  EXPECT_EQ(std::vector<int64_t>(a.RowPtr().begin(), a.RowPtr().end()), (std::vector<int64_t>{0, 2, 2, 3}));
+  EXPECT_EQ(std::vector<int>(a.ColIdx().begin(), a.ColIdx().end()), (std::vector<int>{0, 3, 1}));
+  EXPECT_EQ(std::vector<double>(a.Values().begin(), a.Values().end()), (std::vector<double>{3.0, 2.0, 5.0}));
+}
+
+TEST(SparseMatrixTest, CscRoundTrip) {
+  const auto a = ppc::linalg::MakeRandomMatrix({.rows = 57, .cols = 31, .nnz_per_row = 4.0, .skew = 0.5, .seed = 1});
+  const auto csc = a.ToCsc();
+  EXPECT_EQ(csc.Rows(), 57);
+  EXPECT_EQ(csc.Cols(), 31);
+  EXPECT_EQ(csc.NonZeros(), a.NonZeros());
+  EXPECT_EQ(csc.ToCsr(), a);
+}
+
+TEST(SparseMatrixTest, RejectsInconsistentArrays) {
+  EXPECT_THROW(CsrMatrix<double>(2, 2, {0, 1}, {0}, {1.0}), std::invalid_argument);
+  EXPECT_THROW(CsrMatrix<double>(2, 2, {0, 1, 2}, {0}, {1.0}), std::invalid_argument);
+  EXPECT_THROW(CsrMatrix<double>(1, 2, {0, 2}, {1, 0}, {1.0, 2.0}), std::invalid_argument);
+  EXPECT_THROW(CsrMatrix<double>(1, 2, {0, 1}, {2}, {1.0}), std::invalid_argument);
+  EXPECT_THROW((void)CsrMatrix<double>::FromTriplets(2, 2, {{2, 0, 1.0}}), std::invalid_argument);
+  EXPECT_NO_THROW(CsrMatrix<double>(2, 0, {0, 0, 0}, {}, {}));
+}
+
+TEST(SparseGeneratorsTest, BandedMatrixIsDiagonallyDominant) {
+  const auto a = ppc::linalg::MakeBandedMatrix(100, 2, 3, 7);
+  EXPECT_EQ(a.NonZeros(), (100 * 6) - (1 + 2) - (1 + 2 + 3));
+  for (int64_t row = 0; row < a.Rows(); row++) {
+    double diagonal = 0.0;
+    double off_diagonal = 0.0;
+    for (auto entry = a.RowPtr()[row]; entry < a.RowPtr()[row + 1]; entry++) {
+      const int col = a.ColIdx()[entry];
+      EXPECT_LE(col - row, 3);
+      EXPECT_LE(row - col, 2);
+      (col == row ? diagonal : off_diagonal) += std::abs(a.Values()[entry]);
+    }
+    EXPECT_DOUBLE_EQ(diagonal, off_diagonal + 1.0);
+  }
+  EXPECT_EQ(ppc::linalg::MakeBandedMatrix(100, 2, 3, 7), a);
+}
+
+TEST(SparseGeneratorsTest, SkewedRowsKeepAverageLength) {
+  const auto uniform = ppc::linalg::MakeRandomMatrix({.rows = 4000, .cols = 4000, .nnz_per_row = 16.0, .seed = 3});
+  const auto skewed =
+      ppc::linalg::MakeRandomMatrix({.rows = 4000, .cols = 4000, .nnz_per_row = 16.0, .skew = 0.6, .seed = 3});
+  auto longest = [](const CsrMatrix<double> &a) {
+    int64_t longest = 0;
+    for (int64_t row = 0; row < a.Rows(); row++) {
+      longest = std::max(longest, a.RowPtr()[row + 1] - a.RowPtr()[row]);
+    }
+    return longest;
+  };
+  EXPECT_NEAR(static_cast<double>(uniform.NonZeros()) / 4000.0, 16.0, 0.1);
+  EXPECT_NEAR(static_cast<double>(skewed.NonZeros()) / 4000.0, 16.0, 2.0);
+  EXPECT_EQ(longest(uniform), 16);
+  EXPECT_GT(longest(skewed), 10 * longest(uniform));
+  EXPECT_THROW((void)ppc::linalg::MakeRandomMatrix({.rows = 1, .cols = 1, .skew = 1.0}), std::invalid_argument);
+}
+
+TYPED_TEST(SpMVTest, MatchesReference) {
+  const std::vector<CsrMatrix<double>> matrices = {
+      CsrMatrix<double>(), CsrMatrix<double>(3, 5, {0, 0, 0, 0}, {}, {}), ppc::linalg::MakeBandedMatrix(1, 0, 0),
+      ppc::linalg::MakeBandedMatrix(1000, 3, 3, 1),
+      ppc::linalg::MakeRandomMatrix({.rows = 777, .cols = 333, .nnz_per_row = 5.0, .skew = 0.7, .seed = 2})};
+  for (const auto &a : matrices) {
+    const auto x = RandomVector(a.Cols(), 4);
+    std::vector<double> y(static_cast<std::size_t>(a.Rows()), 42.0);
+    ppc::linalg::SpMV(TypeParam{}, a, x, y);
+    ExpectNear(y, ReferenceProduct(a, x));
+  }
+}
+
+TYPED_TEST(SpMVTest, FineGrainSplitsLongRowsApart) {
+  // One row holds half of the entries; blocks of a few entries must still cover every row exactly once
+  std::vector<std::tuple<int64_t, int, double>> triplets;
+  for (int col = 0; col < 500; col++) {
+    triplets.emplace_back(3, col, 1.0);
+    triplets.emplace_back(col % 10, col, 0.5);
+  }
+  const auto a = CsrMatrix<double>::FromTriplets(10, 500, std::move(triplets));
+  const auto x = RandomVector(500, 5);
+  std::vector<double> y(10);
+  ppc::linalg::SpMV(TypeParam{.grain = 7}, a, x, y);
+  ExpectNear(y, ReferenceProduct(a, x));
+}
+
+TEST(SpMVArgumentsTest, RejectsMismatchedSizesAndCountsBytes) {
+  const auto a = ppc::linalg::MakeBandedMatrix(10, 1, 1);
+  std::vector<double> x(10);
+  std::vector<double> y(9);
+  EXPECT_THROW(ppc::linalg::SpMV(ppc::parallel::kSeq, a, x, y), std::invalid_argument);
+  EXPECT_EQ(ppc::linalg::SpMVBytes(a), (28 * (8 + 4)) + (11 * 8) + (20 * 8));
+}
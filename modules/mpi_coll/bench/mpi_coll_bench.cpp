@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mpi_coll/include/collectives.hpp"
+#include "performance/include/microbench.hpp"
+#include "runners/include/runners.hpp"
+
+// Every algorithm of ppc::mpi_coll against the vendor collectives, for messages of 8 B to 8 MiB of doubles.
+// Operation names are <collective>_<bytes>; the thread column holds the number of processes. The crossover points
+// are the values to put into the k*Threshold constants of collectives.hpp for the machine at hand.
+
+namespace {
+
+using ppc::mpi_coll::Algorithm;
+using ppc::mpi_coll::Collective;
+
+constexpr std::string_view kSuite = "mpi_coll";
+constexpr int kMaxCount = 1 << 20;
+constexpr std::size_t kBytesPerRepetitionBudget = std::size_t{64} << 20;
+
+constexpr std::array<Algorithm, 7> kAlgorithms = {Algorithm::kAuto,
+                                                  Algorithm::kVendor,
+                                                  Algorithm::kBinomial,
+                                                  Algorithm::kRing,
+                                                  Algorithm::kRecursiveDoubling,
+                                                  Algorithm::kRabenseifner,
+                                                  Algorithm::kHierarchical};
+
+std::string_view CollectiveName(Collective collective) {
+  switch (collective) {
+    case Collective::kBcast:
+      return "bcast";
+    case Collective::kReduce:
+      return "reduce";
+    case Collective::kAllreduce:
+      return "allreduce";
+    case Collective::kGather:
+      return "gather";
+  }
+  return "unknown";
+}
+
+/// Fewer repetitions for bigger messages, so every size takes roughly the same time.
+uint64_t Repetitions(std::size_t bytes) {
+  return std::clamp<uint64_t>(kBytesPerRepetitionBudget / std::max<std::size_t>(bytes, 1), 5, 1000);
+}
+
+void Sweep(Collective collective) {
+  ppc::mpi_coll::Communicator comm(MPI_COMM_WORLD);
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  const std::size_t result_count = collective == Collective::kGather ? static_cast<std::size_t>(size) : 1;
+  std::vector<double> data(kMaxCount, 1.0);
+  std::vector<double> result(static_cast<std::size_t>(kMaxCount) * (rank == 0 ? result_count : 1));
+
+  for (int count = 1; count <= kMaxCount; count *= 4) {
+    const std::size_t bytes = static_cast<std::size_t>(count) * sizeof(double);
+    for (Algorithm algorithm : kAlgorithms) {
+      if (!ppc::mpi_coll::Supports(collective, algorithm)) {
+        continue;
+      }
+      MPI_Barrier(MPI_COMM_WORLD);
+      const double sec = ppc::performance::MeasureAverage(Repetitions(bytes), [&] {
+        switch (collective) {
+          case Collective::kBcast:
+            comm.Bcast(data.data(), count, MPI_DOUBLE, 0, algorithm);
+            break;
+          case Collective::kReduce:
+            comm.Reduce(data.data(), result.data(), count, MPI_DOUBLE, MPI_SUM, 0, algorithm);
+            break;
+          case Collective::kAllreduce:
+            comm.Allreduce(data.data(), result.data(), count, MPI_DOUBLE, MPI_SUM, algorithm);
+            break;
+          case Collective::kGather:
+            comm.Gather(data.data(), count, MPI_DOUBLE, result.data(), 0, algorithm);
+            break;
+        }
+      });
+      // The slowest rank determines the time of a collective
+      double max_sec = 0.0;
+      MPI_Reduce(&sec, &max_sec, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+      if (rank == 0) {
+        ppc::performance::PrintBenchResult(
+            kSuite, ppc::mpi_coll::AlgorithmToString(algorithm),
+            std::string(CollectiveName(collective)) + "_" + std::to_string(bytes), size, max_sec);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(MpiCollBench, Bcast) {
+  Sweep(Collective::kBcast);
+}
+
+TEST(MpiCollBench, Reduce) {
+  Sweep(Collective::kReduce);
+}
+
+TEST(MpiCollBench, Allreduce) {
+  Sweep(Collective::kAllreduce);
+}
+
+TEST(MpiCollBench, Gather) {
+  Sweep(Collective::kGather);
+}
+
+int main(int argc, char **argv) {
+  return ppc::runners::Init(argc, argv);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ppc::mpi_coll {
+
+namespace detail {
+
+/// @brief Checks whether @p type has no holes and a zero lower bound, i.e. its elements can be copied as bytes.
+bool IsContiguous(MPI_Datatype type);
+
+/// @brief Throws std::invalid_argument unless IsContiguous(@p type).
+void CheckContiguous(MPI_Datatype type);
+
+/// @brief Returns the extent of @p type; throws std::invalid_argument for types with holes or a non-zero lower bound.
+std::size_t ContiguousExtent(MPI_Datatype type);
+
+/// @brief Throws std::invalid_argument unless @p op is commutative.
+void CheckCommutative(MPI_Op op);
+
+}  // namespace detail
+
+// Flat collective algorithms over point-to-point messages. The signatures mirror the MPI collectives, including
+// MPI_IN_PLACE as the send buffer of the root (Reduce) or of every rank (Allreduce). All of them require a
+// contiguous datatype; the reductions additionally require a commutative operation and throw
+// std::invalid_argument otherwise, checked on every call (also for count == 0).
+
+/// @brief Segment size of the pipelined ring broadcast.
+inline constexpr int64_t kRingSegmentBytes = int64_t{64} << 10;
+
+/// @brief Broadcast along a binomial tree: log2(p) rounds, the whole message in every round.
+/// @details Latency-optimal, so it is the choice for small messages.
+void BinomialBcast(void *buffer, int count, MPI_Datatype type, int root, MPI_Comm comm);
+
+/// @brief Pipelined broadcast along the ring root, root + 1, ...: the message is cut into segments of
+///        @p segment_bytes and every rank forwards a segment as soon as it arrived.
+/// @details Takes p - 1 + segments steps of one segment each, so for large messages every link carries the
+///          message only once.
+void RingBcast(void *buffer, int count, MPI_Datatype type, int root, MPI_Comm comm,
+               int64_t segment_bytes = kRingSegmentBytes);
+
+/// @brief Reduction along a binomial tree; the mirror image of BinomialBcast().
+void BinomialReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root,
+                    MPI_Comm comm);
+
+/// @brief Rabenseifner's reduction: reduce-scatter by recursive halving, then the reduced pieces are gathered on
+///        the root.
+/// @details Every rank sends and reduces about 2 * n bytes instead of n * log2(p), which pays off for large
+///          messages. Process counts that are not a power of two are handled by folding the surplus ranks into
+///          their neighbours first.
+void RabenseifnerReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root,
+                        MPI_Comm comm);
+
+/// @brief Allreduce by recursive doubling: log2(p) pairwise exchanges of the whole message.
+void RecursiveDoublingAllreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                                MPI_Comm comm);
+
+/// @brief Ring allreduce: reduce-scatter and allgather around the ring, 2 * (p - 1) steps of n / p elements.
+/// @details Bandwidth-optimal and insensitive to the process count, but its step count makes it a choice for large
+///          messages only.
+void RingAllreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, MPI_Comm comm);
+
+/// @brief Rabenseifner's allreduce: reduce-scatter by recursive halving, then allgather by recursive doubling.
+void RabenseifnerAllreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                           MPI_Comm comm);
+
+/// @brief Gather along a binomial tree: inner nodes forward the blocks of their whole subtree in one message.
+/// @param count Number of elements contributed by every rank.
+void BinomialGather(const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root, MPI_Comm comm);
+
+}  // namespace ppc::mpi_coll
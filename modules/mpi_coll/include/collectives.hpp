@@ -0,0 +1,113 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "distributed/include/shared_memory.hpp"
+
+namespace ppc::mpi_coll {
+
+/// @brief Collective operations provided by the library.
+enum class Collective : uint8_t { kBcast, kReduce, kAllreduce, kGather };
+
+/// @brief Algorithm implementing a collective.
+enum class Algorithm : uint8_t {
+  /// Chosen by message size and topology, see Communicator::Select()
+  kAuto,
+  /// The MPI library's own collective
+  kVendor,
+  kBinomial,
+  kRing,
+  kRecursiveDoubling,
+  kRabenseifner,
+  /// Intra-node step through a node-shared window, inter-node step between the node leaders
+  kHierarchical
+};
+
+/// @brief Message sizes (in bytes) at which the size-based selection switches algorithms.
+/// @details Starting points for a shared-memory node with a commodity interconnect; ppc_mpi_coll_bench prints the
+///          crossover points of the machine at hand.
+inline constexpr std::size_t kBcastRingThreshold = std::size_t{128} << 10;
+inline constexpr std::size_t kReduceRabenseifnerThreshold = std::size_t{64} << 10;
+inline constexpr std::size_t kAllreduceRabenseifnerThreshold = std::size_t{8} << 10;
+inline constexpr std::size_t kAllreduceRingThreshold = std::size_t{4} << 20;
+inline constexpr std::size_t kGatherBinomialThreshold = std::size_t{32} << 10;
+
+/// @brief Returns a short lowercase name of @p algorithm, e.g. "recursive_doubling".
+std::string_view AlgorithmToString(Algorithm algorithm);
+
+/// @brief Checks whether @p algorithm implements @p collective.
+bool Supports(Collective collective, Algorithm algorithm);
+
+/// @brief Picks a flat (non-hierarchical) algorithm for a message of @p bytes bytes on @p comm_size processes.
+/// @param bytes Message size; for kGather the size contributed by one rank.
+/// @param commutative Whether the reduction operation is commutative; kVendor is the only choice otherwise.
+Algorithm SelectFlatAlgorithm(Collective collective, std::size_t bytes, int comm_size, bool commutative = true);
+
+/// @brief Communicator wrapper running collectives with selectable algorithms.
+/// @details Caches the node topology of the communicator and a node-shared scratch window for the hierarchical
+///          algorithms, so it should be created once and reused. Every rank must pass the same algorithm to a
+///          collective. Construction, destruction and every collective are collective over the communicator.
+///          Buffers follow the MPI conventions, including MPI_IN_PLACE. kAuto uses the vendor collective for
+///          datatypes with holes; explicitly requesting another algorithm for them throws std::invalid_argument.
+///          The collectives run on a duplicate of the communicator, so their messages never match receives of the
+///          caller, even with MPI_ANY_SOURCE or MPI_ANY_TAG.
+class Communicator {
+ public:
+  explicit Communicator(MPI_Comm comm);
+
+  Communicator(const Communicator &) = delete;
+  Communicator &operator=(const Communicator &) = delete;
+
+  ~Communicator();
+
+  /// @brief Returns the duplicate of the communicator the collectives run on.
+  [[nodiscard]] MPI_Comm Get() const {
+    return comm_;
+  }
+  [[nodiscard]] const ppc::distributed::NodeTopology &GetTopology() const {
+    return topology_;
+  }
+
+  /// @brief Resolves kAuto: kHierarchical when the processes span several nodes with several ranks each, otherwise
+  ///        SelectFlatAlgorithm().
+  [[nodiscard]] Algorithm Select(Collective collective, std::size_t bytes, bool commutative = true) const;
+
+  void Bcast(void *buffer, int count, MPI_Datatype type, int root, Algorithm algorithm = Algorithm::kAuto);
+  void Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root,
+              Algorithm algorithm = Algorithm::kAuto);
+  void Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                 Algorithm algorithm = Algorithm::kAuto);
+  /// @param count Number of elements contributed by every rank.
+  void Gather(const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root,
+              Algorithm algorithm = Algorithm::kAuto);
+
+ private:
+  /// Returns node-shared scratch memory of at least @p bytes bytes (collective on the node).
+  std::byte *Scratch(std::size_t bytes);
+
+  void HierarchicalBcast(void *buffer, int count, MPI_Datatype type, int root);
+  /// Reduces the contributions of the node into slot 0 of the scratch window and then over the node leaders;
+  /// @p root < 0 selects allreduce.
+  void HierarchicalReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root);
+  void HierarchicalGather(const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root);
+
+  MPI_Comm comm_;
+  int rank_ = 0;
+  int size_ = 1;
+  ppc::distributed::NodeTopology topology_;
+  /// Node index of every rank of comm_
+  std::vector<int> node_of_rank_;
+  /// Ranks of comm_ ordered by node index, then node rank
+  std::vector<int> node_order_;
+  /// Number of ranks on every node
+  std::vector<int> node_sizes_;
+  std::optional<ppc::distributed::SharedArray<std::byte>> scratch_;
+};
+
+}  // namespace ppc::mpi_coll
@@ -0,0 +1,430 @@
+#include "mpi_coll/include/algorithms.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "util/include/partition.hpp"
+
+namespace ppc::mpi_coll {
+
+namespace {
+
+constexpr int kBcastTag = 7101;
+constexpr int kReduceTag = 7102;
+constexpr int kAllreduceTag = 7103;
+constexpr int kGatherTag = 7104;
+constexpr int kFoldTag = 7105;
+
+struct CommInfo {
+  int rank = 0;
+  int size = 1;
+};
+
+CommInfo GetCommInfo(MPI_Comm comm) {
+  CommInfo info;
+  MPI_Comm_rank(comm, &info.rank);
+  MPI_Comm_size(comm, &info.size);
+  return info;
+}
+
+std::byte *At(void *buffer, int64_t element, std::size_t extent) {
+  return static_cast<std::byte *>(buffer) + (static_cast<std::size_t>(element) * extent);
+}
+
+int FloorPowerOfTwo(int n) {
+  int pof2 = 1;
+  while (pof2 * 2 <= n) {
+    pof2 *= 2;
+  }
+  return pof2;
+}
+
+/// Power-of-two group used by recursive doubling and halving. The first 2 * rem ranks are paired up: the even
+/// rank of a pair hands its data to the odd one and sits out, so pof2 ranks remain.
+struct Group {
+  int pof2 = 1;
+  int rem = 0;
+
+  explicit Group(int size) : pof2(FloorPowerOfTwo(size)), rem(size - pof2) {}
+
+  /// Rank within the group, or -1 for a rank that sits out.
+  [[nodiscard]] int GroupRank(int rank) const {
+    if (rank < 2 * rem) {
+      return (rank % 2 == 0) ? -1 : rank / 2;
+    }
+    return rank - rem;
+  }
+
+  [[nodiscard]] int CommRank(int group_rank) const {
+    return group_rank < rem ? (group_rank * 2) + 1 : group_rank + rem;
+  }
+};
+
+/// Reduces the data of the sitting-out ranks into their partners.
+void FoldIn(const Group &group, void *data, std::byte *incoming, int count, MPI_Datatype type, MPI_Op op, int rank,
+            MPI_Comm comm) {
+  if (rank >= 2 * group.rem) {
+    return;
+  }
+  if (rank % 2 == 0) {
+    MPI_Send(data, count, type, rank + 1, kFoldTag, comm);
+  } else {
+    MPI_Recv(incoming, count, type, rank - 1, kFoldTag, comm, MPI_STATUS_IGNORE);
+    MPI_Reduce_local(incoming, data, count, type, op);
+  }
+}
+
+/// Hands the result back to the sitting-out ranks.
+void FoldOut(const Group &group, void *data, int count, MPI_Datatype type, int rank, MPI_Comm comm) {
+  if (rank >= 2 * group.rem) {
+    return;
+  }
+  if (rank % 2 == 0) {
+    MPI_Recv(data, count, type, rank + 1, kFoldTag, comm, MPI_STATUS_IGNORE);
+  } else {
+    MPI_Send(data, count, type, rank - 1, kFoldTag, comm);
+  }
+}
+
+/// Element window [begin, mid, end) split at one step of recursive halving.
+struct HalvingStep {
+  int64_t begin = 0;
+  int64_t mid = 0;
+  int64_t end = 0;
+  int partner = 0;
+};
+
+/// Returns the windows group rank @p group_rank passes through during recursive halving over [0, count).
+/// The rank keeps the lower half when its bit of the step is clear, so it ends up owning window group_rank.
+std::vector<HalvingStep> HalvingSteps(int group_rank, int pof2, int64_t count) {
+  std::vector<HalvingStep> steps;
+  int64_t begin = 0;
+  int64_t end = count;
+  for (int mask = pof2 >> 1; mask > 0; mask >>= 1) {
+    const int64_t mid = begin + ((end - begin) / 2);
+    steps.push_back({.begin = begin, .mid = mid, .end = end, .partner = group_rank ^ mask});
+    if ((group_rank & mask) == 0) {
+      end = mid;
+    } else {
+      begin = mid;
+    }
+  }
+  return steps;
+}
+
+/// Window owned by @p group_rank after the last halving step.
+ppc::util::IndexRange FinalWindow(int group_rank, int pof2, int64_t count) {
+  const auto steps = HalvingSteps(group_rank, pof2, count);
+  if (steps.empty()) {
+    return {.begin = 0, .end = count};
+  }
+  const auto &last = steps.back();
+  return (group_rank & 1) == 0 ? ppc::util::IndexRange{.begin = last.begin, .end = last.mid}
+                               : ppc::util::IndexRange{.begin = last.mid, .end = last.end};
+}
+
+/// Recursive-halving reduce-scatter over the group; @p data holds the whole vector and ends up holding the fully
+/// reduced FinalWindow() of the calling rank.
+void ReduceScatterHalving(const Group &group, int group_rank, void *data, std::byte *incoming, int64_t count,
+                          MPI_Datatype type, MPI_Op op, std::size_t extent, int tag, MPI_Comm comm) {
+  for (const auto &step : HalvingSteps(group_rank, group.pof2, count)) {
+    const bool keep_lower = step.partner > group_rank;
+    const int64_t keep_begin = keep_lower ? step.begin : step.mid;
+    const int64_t keep_end = keep_lower ? step.mid : step.end;
+    const int64_t give_begin = keep_lower ? step.mid : step.begin;
+    const int64_t give_end = keep_lower ? step.end : step.mid;
+    const int partner = group.CommRank(step.partner);
+    MPI_Sendrecv(At(data, give_begin, extent), static_cast<int>(give_end - give_begin), type, partner, tag, incoming,
+                 static_cast<int>(keep_end - keep_begin), type, partner, tag, comm, MPI_STATUS_IGNORE);
+    MPI_Reduce_local(incoming, At(data, keep_begin, extent), static_cast<int>(keep_end - keep_begin), type, op);
+  }
+}
+
+}  // namespace
+
+namespace detail {
+
+bool IsContiguous(MPI_Datatype type) {
+  MPI_Aint lb = 0;
+  MPI_Aint extent = 0;
+  MPI_Type_get_extent(type, &lb, &extent);
+  int size = 0;
+  MPI_Type_size(type, &size);
+  return lb == 0 && extent == static_cast<MPI_Aint>(size);
+}
+
+void CheckContiguous(MPI_Datatype type) {
+  if (!IsContiguous(type)) {
+    throw std::invalid_argument("ppc::mpi_coll algorithms need a contiguous datatype");
+  }
+}
+
+std::size_t ContiguousExtent(MPI_Datatype type) {
+  CheckContiguous(type);
+  int size = 0;
+  MPI_Type_size(type, &size);
+  return static_cast<std::size_t>(size);
+}
+
+void CheckCommutative(MPI_Op op) {
+  int commutative = 0;
+  MPI_Op_commutative(op, &commutative);
+  if (commutative == 0) {
+    throw std::invalid_argument("ppc::mpi_coll reduction algorithms need a commutative operation");
+  }
+}
+
+}  // namespace detail
+
+void BinomialBcast(void *buffer, int count, MPI_Datatype type, int root, MPI_Comm comm) {
+  detail::CheckContiguous(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  const int rel = (rank - root + size) % size;
+  int mask = 1;
+  while (mask < size) {
+    if ((rel & mask) != 0) {
+      MPI_Recv(buffer, count, type, (rel - mask + root) % size, kBcastTag, comm, MPI_STATUS_IGNORE);
+      break;
+    }
+    mask <<= 1;
+  }
+  for (mask >>= 1; mask > 0; mask >>= 1) {
+    if (rel + mask < size) {
+      MPI_Send(buffer, count, type, (rel + mask + root) % size, kBcastTag, comm);
+    }
+  }
+}
+
+void RingBcast(void *buffer, int count, MPI_Datatype type, int root, MPI_Comm comm, int64_t segment_bytes) {
+  const std::size_t extent = detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  const int rel = (rank - root + size) % size;
+  const int prev = (rank - 1 + size) % size;
+  const int next = (rank + 1) % size;
+  const int64_t segment = std::max<int64_t>(1, segment_bytes / static_cast<int64_t>(std::max<std::size_t>(1, extent)));
+  for (int64_t offset = 0; offset < count; offset += segment) {
+    const auto n = static_cast<int>(std::min<int64_t>(segment, count - offset));
+    if (rel > 0) {
+      MPI_Recv(At(buffer, offset, extent), n, type, prev, kBcastTag, comm, MPI_STATUS_IGNORE);
+    }
+    if (rel < size - 1) {
+      MPI_Send(At(buffer, offset, extent), n, type, next, kBcastTag, comm);
+    }
+  }
+}
+
+void BinomialReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root,
+                    MPI_Comm comm) {
+  detail::CheckCommutative(op);
+  const std::size_t bytes = static_cast<std::size_t>(count) * detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  std::vector<std::byte> acc(bytes);
+  std::vector<std::byte> incoming(bytes);
+  std::memcpy(acc.data(), sendbuf == MPI_IN_PLACE ? recvbuf : sendbuf, bytes);
+  const int rel = (rank - root + size) % size;
+  for (int mask = 1; mask < size; mask <<= 1) {
+    if ((rel & mask) != 0) {
+      MPI_Send(acc.data(), count, type, (rel - mask + root) % size, kReduceTag, comm);
+      break;
+    }
+    if (rel + mask < size) {
+      MPI_Recv(incoming.data(), count, type, (rel + mask + root) % size, kReduceTag, comm, MPI_STATUS_IGNORE);
+      MPI_Reduce_local(incoming.data(), acc.data(), count, type, op);
+    }
+  }
+  if (rank == root) {
+    std::memcpy(recvbuf, acc.data(), bytes);
+  }
+}
+
+void RabenseifnerReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root,
+                        MPI_Comm comm) {
+  detail::CheckCommutative(op);
+  const std::size_t extent = detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  const std::size_t bytes = static_cast<std::size_t>(count) * extent;
+  std::vector<std::byte> data(bytes);
+  std::vector<std::byte> incoming(bytes);
+  std::memcpy(data.data(), sendbuf == MPI_IN_PLACE ? recvbuf : sendbuf, bytes);
+
+  const Group group(size);
+  FoldIn(group, data.data(), incoming.data(), count, type, op, rank, comm);
+  const int group_rank = group.GroupRank(rank);
+  if (group_rank >= 0) {
+    ReduceScatterHalving(group, group_rank, data.data(), incoming.data(), count, type, op, extent, kReduceTag, comm);
+  }
+
+  // Gather the reduced windows on the root
+  if (rank == root) {
+    std::vector<MPI_Request> requests;
+    for (int member = 0; member < group.pof2; member++) {
+      const auto window = FinalWindow(member, group.pof2, count);
+      if (member == group_rank) {
+        std::memcpy(At(recvbuf, window.begin, extent), At(data.data(), window.begin, extent),
+                    static_cast<std::size_t>(window.Size()) * extent);
+      } else {
+        requests.emplace_back();
+        MPI_Irecv(At(recvbuf, window.begin, extent), static_cast<int>(window.Size()), type, group.CommRank(member),
+                  kGatherTag, comm, &requests.back());
+      }
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+  } else if (group_rank >= 0) {
+    const auto window = FinalWindow(group_rank, group.pof2, count);
+    MPI_Send(At(data.data(), window.begin, extent), static_cast<int>(window.Size()), type, root, kGatherTag, comm);
+  }
+}
+
+void RecursiveDoublingAllreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                                MPI_Comm comm) {
+  detail::CheckCommutative(op);
+  const std::size_t bytes = static_cast<std::size_t>(count) * detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  if (sendbuf != MPI_IN_PLACE) {
+    std::memcpy(recvbuf, sendbuf, bytes);
+  }
+  std::vector<std::byte> incoming(bytes);
+
+  const Group group(size);
+  FoldIn(group, recvbuf, incoming.data(), count, type, op, rank, comm);
+  const int group_rank = group.GroupRank(rank);
+  if (group_rank >= 0) {
+    // Both partners combine the same two values, so all ranks end with bitwise identical results
+    for (int mask = 1; mask < group.pof2; mask <<= 1) {
+      const int partner = group.CommRank(group_rank ^ mask);
+      MPI_Sendrecv(recvbuf, count, type, partner, kAllreduceTag, incoming.data(), count, type, partner, kAllreduceTag,
+                   comm, MPI_STATUS_IGNORE);
+      MPI_Reduce_local(incoming.data(), recvbuf, count, type, op);
+    }
+  }
+  FoldOut(group, recvbuf, count, type, rank, comm);
+}
+
+void RingAllreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, MPI_Comm comm) {
+  detail::CheckCommutative(op);
+  const std::size_t extent = detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  if (sendbuf != MPI_IN_PLACE) {
+    std::memcpy(recvbuf, sendbuf, static_cast<std::size_t>(count) * extent);
+  }
+  if (size == 1) {
+    return;
+  }
+  const int prev = (rank - 1 + size) % size;
+  const int next = (rank + 1) % size;
+  const auto chunk = [&](int index) { return ppc::util::BlockRange(count, size, ((index % size) + size) % size); };
+  std::vector<std::byte> incoming(static_cast<std::size_t>(chunk(0).Size()) * extent);
+
+  // Reduce-scatter: after step s the chunk rank - s - 1 holds the sum of s + 2 ranks
+  for (int step = 0; step < size - 1; step++) {
+    const auto send = chunk(rank - step);
+    const auto recv = chunk(rank - step - 1);
+    MPI_Sendrecv(At(recvbuf, send.begin, extent), static_cast<int>(send.Size()), type, next, kAllreduceTag,
+                 incoming.data(), static_cast<int>(recv.Size()), type, prev, kAllreduceTag, comm, MPI_STATUS_IGNORE);
+    MPI_Reduce_local(incoming.data(), At(recvbuf, recv.begin, extent), static_cast<int>(recv.Size()), type, op);
+  }
+  // Allgather: the fully reduced chunk rank + 1 travels around the ring
+  for (int step = 0; step < size - 1; step++) {
+    const auto send = chunk(rank + 1 - step);
+    const auto recv = chunk(rank - step);
+    MPI_Sendrecv(At(recvbuf, send.begin, extent), static_cast<int>(send.Size()), type, next, kAllreduceTag,
+                 At(recvbuf, recv.begin, extent), static_cast<int>(recv.Size()), type, prev, kAllreduceTag, comm,
+                 MPI_STATUS_IGNORE);
+  }
+}
+
+void RabenseifnerAllreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                           MPI_Comm comm) {
+  detail::CheckCommutative(op);
+  const std::size_t extent = detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  const std::size_t bytes = static_cast<std::size_t>(count) * extent;
+  if (sendbuf != MPI_IN_PLACE) {
+    std::memcpy(recvbuf, sendbuf, bytes);
+  }
+  std::vector<std::byte> incoming(bytes);
+
+  const Group group(size);
+  FoldIn(group, recvbuf, incoming.data(), count, type, op, rank, comm);
+  const int group_rank = group.GroupRank(rank);
+  if (group_rank >= 0) {
+    ReduceScatterHalving(group, group_rank, recvbuf, incoming.data(), count, type, op, extent, kAllreduceTag, comm);
+    // Allgather by recursive doubling: undo the halving steps in reverse order
+    const auto steps = HalvingSteps(group_rank, group.pof2, count);
+    for (auto it = steps.rbegin(); it != steps.rend(); ++it) {
+      const bool kept_lower = it->partner > group_rank;
+      const int64_t have_begin = kept_lower ? it->begin : it->mid;
+      const int64_t have_end = kept_lower ? it->mid : it->end;
+      const int64_t get_begin = kept_lower ? it->mid : it->begin;
+      const int64_t get_end = kept_lower ? it->end : it->mid;
+      const int partner = group.CommRank(it->partner);
+      MPI_Sendrecv(At(recvbuf, have_begin, extent), static_cast<int>(have_end - have_begin), type, partner,
+                   kAllreduceTag, At(recvbuf, get_begin, extent), static_cast<int>(get_end - get_begin), type, partner,
+                   kAllreduceTag, comm, MPI_STATUS_IGNORE);
+    }
+  }
+  FoldOut(group, recvbuf, count, type, rank, comm);
+}
+
+void BinomialGather(const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root, MPI_Comm comm) {
+  const std::size_t block = static_cast<std::size_t>(count) * detail::ContiguousExtent(type);
+  if (count == 0) {
+    return;
+  }
+  const auto [rank, size] = GetCommInfo(comm);
+  const int rel = (rank - root + size) % size;
+  // Blocks of the subtree rooted at rel, in relative rank order
+  const int lowest_bit = rel == 0 ? size : (rel & -rel);
+  const int subtree = std::min(lowest_bit, size - rel);
+  std::vector<std::byte> blocks(static_cast<std::size_t>(subtree) * block);
+  const void *own = sendbuf == MPI_IN_PLACE ? At(recvbuf, rank, block) : sendbuf;
+  std::memcpy(blocks.data(), own, block);
+
+  int held = 1;
+  for (int mask = 1; mask < size; mask <<= 1) {
+    if ((rel & mask) != 0) {
+      MPI_Send(blocks.data(), held * count, type, (rel - mask + root) % size, kGatherTag, comm);
+      break;
+    }
+    if (rel + mask < size) {
+      const int incoming = std::min(mask, size - rel - mask);
+      MPI_Recv(blocks.data() + (static_cast<std::size_t>(held) * block), incoming * count, type,
+               (rel + mask + root) % size, kGatherTag, comm, MPI_STATUS_IGNORE);
+      held += incoming;
+    }
+  }
+  if (rank == root) {
+    for (int j = 0; j < size; j++) {
+      std::memcpy(At(recvbuf, (j + root) % size, block), blocks.data() + (static_cast<std::size_t>(j) * block), block);
+    }
+  }
+}
+
+}  // namespace ppc::mpi_coll
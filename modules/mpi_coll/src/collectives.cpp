@@ -0,0 +1,400 @@
+#include "mpi_coll/include/collectives.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "distributed/include/shared_memory.hpp"
+#include "mpi_coll/include/algorithms.hpp"
+#include "util/include/partition.hpp"
+
+namespace ppc::mpi_coll {
+
+namespace {
+
+constexpr int kHierarchicalGatherTag = 7110;
+
+std::size_t TypeSize(MPI_Datatype type) {
+  int size = 0;
+  MPI_Type_size(type, &size);
+  return static_cast<std::size_t>(size);
+}
+
+bool IsCommutative(MPI_Op op) {
+  int commutative = 0;
+  MPI_Op_commutative(op, &commutative);
+  return commutative != 0;
+}
+
+void CheckSupported(Collective collective, Algorithm algorithm, MPI_Datatype type) {
+  if (!Supports(collective, algorithm)) {
+    throw std::invalid_argument("Algorithm " + std::string(AlgorithmToString(algorithm)) +
+                                " does not implement this collective");
+  }
+  // Only the vendor collective handles datatypes with holes
+  if (algorithm != Algorithm::kVendor) {
+    detail::CheckContiguous(type);
+  }
+}
+
+void FlatBcast(Algorithm algorithm, void *buffer, int count, MPI_Datatype type, int root, MPI_Comm comm) {
+  if (algorithm == Algorithm::kBinomial) {
+    BinomialBcast(buffer, count, type, root, comm);
+  } else if (algorithm == Algorithm::kRing) {
+    RingBcast(buffer, count, type, root, comm);
+  } else {
+    MPI_Bcast(buffer, count, type, root, comm);
+  }
+}
+
+void FlatReduce(Algorithm algorithm, const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                int root, MPI_Comm comm) {
+  if (algorithm == Algorithm::kBinomial) {
+    BinomialReduce(sendbuf, recvbuf, count, type, op, root, comm);
+  } else if (algorithm == Algorithm::kRabenseifner) {
+    RabenseifnerReduce(sendbuf, recvbuf, count, type, op, root, comm);
+  } else {
+    MPI_Reduce(sendbuf, recvbuf, count, type, op, root, comm);
+  }
+}
+
+void FlatAllreduce(Algorithm algorithm, const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                   MPI_Comm comm) {
+  if (algorithm == Algorithm::kRecursiveDoubling) {
+    RecursiveDoublingAllreduce(sendbuf, recvbuf, count, type, op, comm);
+  } else if (algorithm == Algorithm::kRing) {
+    RingAllreduce(sendbuf, recvbuf, count, type, op, comm);
+  } else if (algorithm == Algorithm::kRabenseifner) {
+    RabenseifnerAllreduce(sendbuf, recvbuf, count, type, op, comm);
+  } else {
+    MPI_Allreduce(sendbuf, recvbuf, count, type, op, comm);
+  }
+}
+
+void FlatGather(Algorithm algorithm, const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root,
+                MPI_Comm comm) {
+  if (algorithm == Algorithm::kBinomial) {
+    BinomialGather(sendbuf, count, type, recvbuf, root, comm);
+  } else {
+    MPI_Gather(sendbuf, count, type, recvbuf, count, type, root, comm);
+  }
+}
+
+MPI_Comm Duplicate(MPI_Comm comm) {
+  MPI_Comm duplicate = MPI_COMM_NULL;
+  MPI_Comm_dup(comm, &duplicate);
+  return duplicate;
+}
+
+}  // namespace
+
+std::string_view AlgorithmToString(Algorithm algorithm) {
+  switch (algorithm) {
+    case Algorithm::kAuto:
+      return "auto";
+    case Algorithm::kVendor:
+      return "vendor";
+    case Algorithm::kBinomial:
+      return "binomial";
+    case Algorithm::kRing:
+      return "ring";
+    case Algorithm::kRecursiveDoubling:
+      return "recursive_doubling";
+    case Algorithm::kRabenseifner:
+      return "rabenseifner";
+    case Algorithm::kHierarchical:
+      return "hierarchical";
+  }
+  return "unknown";
+}
+
+bool Supports(Collective collective, Algorithm algorithm) {
+  switch (algorithm) {
+    case Algorithm::kAuto:
+    case Algorithm::kVendor:
+    case Algorithm::kHierarchical:
+      return true;
+    case Algorithm::kBinomial:
+      return collective != Collective::kAllreduce;
+    case Algorithm::kRing:
+      return collective == Collective::kBcast || collective == Collective::kAllreduce;
+    case Algorithm::kRecursiveDoubling:
+      return collective == Collective::kAllreduce;
+    case Algorithm::kRabenseifner:
+      return collective == Collective::kReduce || collective == Collective::kAllreduce;
+  }
+  return false;
+}
+
+Algorithm SelectFlatAlgorithm(Collective collective, std::size_t bytes, int comm_size, bool commutative) {
+  const bool reduction = collective == Collective::kReduce || collective == Collective::kAllreduce;
+  if (comm_size <= 1 || (reduction && !commutative)) {
+    return Algorithm::kVendor;
+  }
+  switch (collective) {
+    case Collective::kBcast:
+      return bytes < kBcastRingThreshold ? Algorithm::kBinomial : Algorithm::kRing;
+    case Collective::kReduce:
+      return bytes < kReduceRabenseifnerThreshold ? Algorithm::kBinomial : Algorithm::kRabenseifner;
+    case Collective::kAllreduce:
+      if (bytes < kAllreduceRabenseifnerThreshold) {
+        return Algorithm::kRecursiveDoubling;
+      }
+      return bytes < kAllreduceRingThreshold ? Algorithm::kRabenseifner : Algorithm::kRing;
+    case Collective::kGather:
+      return bytes < kGatherBinomialThreshold ? Algorithm::kBinomial : Algorithm::kVendor;
+  }
+  return Algorithm::kVendor;
+}
+
+// The algorithms send on fixed tags; a private communicator keeps receives of the task with MPI_ANY_TAG or
+// MPI_ANY_SOURCE from matching them
+Communicator::Communicator(MPI_Comm comm) : comm_(Duplicate(comm)), topology_(comm_) {
+  MPI_Comm_rank(comm_, &rank_);
+  MPI_Comm_size(comm_, &size_);
+  const std::array<int, 2> own = {topology_.GetNodeIndex(), topology_.GetNodeRank()};
+  std::vector<int> all(static_cast<std::size_t>(2 * size_));
+  MPI_Allgather(own.data(), 2, MPI_INT, all.data(), 2, MPI_INT, comm_);
+
+  node_of_rank_.resize(static_cast<std::size_t>(size_));
+  node_sizes_.assign(static_cast<std::size_t>(topology_.GetNumNodes()), 0);
+  for (int rank = 0; rank < size_; rank++) {
+    const int node = all[static_cast<std::size_t>(2 * rank)];
+    node_of_rank_[static_cast<std::size_t>(rank)] = node;
+    node_sizes_[static_cast<std::size_t>(node)]++;
+  }
+  node_order_.resize(static_cast<std::size_t>(size_));
+  std::iota(node_order_.begin(), node_order_.end(), 0);
+  std::ranges::sort(node_order_, [&](int a, int b) {
+    const auto ia = static_cast<std::size_t>(2 * a);
+    const auto ib = static_cast<std::size_t>(2 * b);
+    return std::tie(all[ia], all[ia + 1]) < std::tie(all[ib], all[ib + 1]);
+  });
+}
+
+Communicator::~Communicator() {
+  MPI_Comm_free(&comm_);
+}
+
+Algorithm Communicator::Select(Collective collective, std::size_t bytes, bool commutative) const {
+  const bool reduction = collective == Collective::kReduce || collective == Collective::kAllreduce;
+  const int nodes = topology_.GetNumNodes();
+  // Same decision on every rank: several nodes, and at least one of them runs several ranks
+  if ((commutative || !reduction) && nodes > 1 && nodes < size_) {
+    return Algorithm::kHierarchical;
+  }
+  return SelectFlatAlgorithm(collective, bytes, size_, commutative);
+}
+
+void Communicator::Bcast(void *buffer, int count, MPI_Datatype type, int root, Algorithm algorithm) {
+  if (algorithm == Algorithm::kAuto && !detail::IsContiguous(type)) {
+    algorithm = Algorithm::kVendor;
+  }
+  if (algorithm == Algorithm::kAuto) {
+    algorithm = Select(Collective::kBcast, static_cast<std::size_t>(count) * TypeSize(type));
+  }
+  CheckSupported(Collective::kBcast, algorithm, type);
+  if (count == 0) {
+    return;
+  }
+  if (algorithm == Algorithm::kHierarchical) {
+    HierarchicalBcast(buffer, count, type, root);
+  } else {
+    FlatBcast(algorithm, buffer, count, type, root, comm_);
+  }
+}
+
+void Communicator::Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op, int root,
+                          Algorithm algorithm) {
+  if (algorithm == Algorithm::kAuto && !detail::IsContiguous(type)) {
+    algorithm = Algorithm::kVendor;
+  }
+  if (algorithm == Algorithm::kAuto) {
+    algorithm = Select(Collective::kReduce, static_cast<std::size_t>(count) * TypeSize(type), IsCommutative(op));
+  }
+  CheckSupported(Collective::kReduce, algorithm, type);
+  if (count == 0) {
+    return;
+  }
+  if (algorithm == Algorithm::kHierarchical) {
+    HierarchicalReduce(sendbuf, recvbuf, count, type, op, root);
+  } else {
+    FlatReduce(algorithm, sendbuf, recvbuf, count, type, op, root, comm_);
+  }
+}
+
+void Communicator::Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                             Algorithm algorithm) {
+  if (algorithm == Algorithm::kAuto && !detail::IsContiguous(type)) {
+    algorithm = Algorithm::kVendor;
+  }
+  if (algorithm == Algorithm::kAuto) {
+    algorithm = Select(Collective::kAllreduce, static_cast<std::size_t>(count) * TypeSize(type), IsCommutative(op));
+  }
+  CheckSupported(Collective::kAllreduce, algorithm, type);
+  if (count == 0) {
+    return;
+  }
+  if (algorithm == Algorithm::kHierarchical) {
+    HierarchicalReduce(sendbuf, recvbuf, count, type, op, -1);
+  } else {
+    FlatAllreduce(algorithm, sendbuf, recvbuf, count, type, op, comm_);
+  }
+}
+
+void Communicator::Gather(const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root,
+                          Algorithm algorithm) {
+  if (algorithm == Algorithm::kAuto && !detail::IsContiguous(type)) {
+    algorithm = Algorithm::kVendor;
+  }
+  if (algorithm == Algorithm::kAuto) {
+    algorithm = Select(Collective::kGather, static_cast<std::size_t>(count) * TypeSize(type));
+  }
+  CheckSupported(Collective::kGather, algorithm, type);
+  if (count == 0) {
+    return;
+  }
+  if (algorithm == Algorithm::kHierarchical) {
+    HierarchicalGather(sendbuf, count, type, recvbuf, root);
+  } else {
+    FlatGather(algorithm, sendbuf, count, type, recvbuf, root, comm_);
+  }
+}
+
+std::byte *Communicator::Scratch(std::size_t bytes) {
+  if (!scratch_ || scratch_->Size() < bytes) {
+    const std::size_t grown = std::max(bytes, scratch_ ? 2 * scratch_->Size() : bytes);
+    // The old window is freed before the new one is allocated, both collectively on the node
+    scratch_.reset();
+    scratch_.emplace(topology_, grown);
+  }
+  return scratch_->Data();
+}
+
+void Communicator::HierarchicalBcast(void *buffer, int count, MPI_Datatype type, int root) {
+  const std::size_t bytes = static_cast<std::size_t>(count) * detail::ContiguousExtent(type);
+  std::byte *shared = Scratch(bytes);
+  if (rank_ == root) {
+    std::memcpy(shared, buffer, bytes);
+  }
+  scratch_->Publish();
+  if (topology_.IsLeader() && topology_.GetNumNodes() > 1) {
+    const Algorithm inter = SelectFlatAlgorithm(Collective::kBcast, bytes, topology_.GetNumNodes());
+    FlatBcast(inter, shared, count, type, node_of_rank_[static_cast<std::size_t>(root)], topology_.GetLeaderComm());
+  }
+  scratch_->Publish();
+  if (rank_ != root) {
+    std::memcpy(buffer, shared, bytes);
+  }
+  // Nobody may overwrite the scratch window before every rank of the node has read it
+  scratch_->Publish();
+}
+
+void Communicator::HierarchicalReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op op,
+                                      int root) {
+  detail::CheckCommutative(op);
+  const std::size_t extent = detail::ContiguousExtent(type);
+  const std::size_t bytes = static_cast<std::size_t>(count) * extent;
+  const int node_size = topology_.GetNodeSize();
+  std::byte *shared = Scratch(static_cast<std::size_t>(node_size) * bytes);
+
+  // Every rank of the node writes its contribution into its own slot
+  const void *own = sendbuf == MPI_IN_PLACE ? recvbuf : sendbuf;
+  std::memcpy(shared + (static_cast<std::size_t>(topology_.GetNodeRank()) * bytes), own, bytes);
+  scratch_->Publish();
+
+  // Then the ranks of the node reduce disjoint element ranges of all slots into slot 0 in parallel
+  const auto range = ppc::util::BlockRange(count, node_size, topology_.GetNodeRank());
+  std::byte *target = shared + (static_cast<std::size_t>(range.begin) * extent);
+  for (int slot = 1; slot < node_size; slot++) {
+    MPI_Reduce_local(target + (static_cast<std::size_t>(slot) * bytes), target, static_cast<int>(range.Size()), type,
+                     op);
+  }
+  scratch_->Publish();
+
+  const int nodes = topology_.GetNumNodes();
+  if (topology_.IsLeader() && nodes > 1) {
+    MPI_Comm leaders = topology_.GetLeaderComm();
+    if (root < 0) {
+      FlatAllreduce(SelectFlatAlgorithm(Collective::kAllreduce, bytes, nodes), MPI_IN_PLACE, shared, count, type, op,
+                    leaders);
+    } else {
+      const int root_node = node_of_rank_[static_cast<std::size_t>(root)];
+      const bool root_leader = topology_.GetNodeIndex() == root_node;
+      FlatReduce(SelectFlatAlgorithm(Collective::kReduce, bytes, nodes), root_leader ? MPI_IN_PLACE : shared, shared,
+                 count, type, op, root_node, leaders);
+    }
+  }
+  scratch_->Publish();
+  if (root < 0 || rank_ == root) {
+    std::memcpy(recvbuf, shared, bytes);
+  }
+  scratch_->Publish();
+}
+
+void Communicator::HierarchicalGather(const void *sendbuf, int count, MPI_Datatype type, void *recvbuf, int root) {
+  const std::size_t block = static_cast<std::size_t>(count) * detail::ContiguousExtent(type);
+  const int node_size = topology_.GetNodeSize();
+  std::byte *shared = Scratch(static_cast<std::size_t>(node_size) * block);
+
+  const void *own =
+      sendbuf == MPI_IN_PLACE ? static_cast<std::byte *>(recvbuf) + (static_cast<std::size_t>(rank_) * block) : sendbuf;
+  std::memcpy(shared + (static_cast<std::size_t>(topology_.GetNodeRank()) * block), own, block);
+  scratch_->Publish();
+
+  const int root_node = node_of_rank_[static_cast<std::size_t>(root)];
+  // First rank of the root's node in node order, i.e. the leader of that node
+  const int root_node_begin = std::accumulate(node_sizes_.begin(), node_sizes_.begin() + root_node, 0);
+  const int root_leader = node_order_[static_cast<std::size_t>(root_node_begin)];
+
+  if (topology_.IsLeader()) {
+    // Blocks of all ranks in node order, complete on the root's leader only
+    std::vector<std::byte> gathered;
+    const bool on_root_node = topology_.GetNodeIndex() == root_node;
+    if (topology_.GetNumNodes() > 1) {
+      std::vector<int> counts(node_sizes_.size());
+      std::vector<int> displs(node_sizes_.size());
+      int displ = 0;
+      for (std::size_t node = 0; node < node_sizes_.size(); node++) {
+        counts[node] = node_sizes_[node] * count;
+        displs[node] = displ;
+        displ += counts[node];
+      }
+      if (on_root_node) {
+        gathered.resize(static_cast<std::size_t>(size_) * block);
+      }
+      MPI_Gatherv(shared, node_size * count, type, gathered.data(), counts.data(), displs.data(), type, root_node,
+                  topology_.GetLeaderComm());
+    } else {
+      gathered.assign(shared, shared + (static_cast<std::size_t>(size_) * block));
+    }
+    if (on_root_node) {
+      std::vector<std::byte> ordered;
+      std::byte *out = static_cast<std::byte *>(recvbuf);
+      if (rank_ != root) {
+        ordered.resize(static_cast<std::size_t>(size_) * block);
+        out = ordered.data();
+      }
+      for (std::size_t k = 0; k < node_order_.size(); k++) {
+        std::memcpy(out + (static_cast<std::size_t>(node_order_[k]) * block), gathered.data() + (k * block), block);
+      }
+      if (rank_ != root) {
+        MPI_Send(ordered.data(), size_ * count, type, root, kHierarchicalGatherTag, comm_);
+      }
+    }
+  } else if (rank_ == root) {
+    MPI_Recv(recvbuf, size_ * count, type, root_leader, kHierarchicalGatherTag, comm_, MPI_STATUS_IGNORE);
+  }
+  scratch_->Publish();
+}
+
+}  // namespace ppc::mpi_coll
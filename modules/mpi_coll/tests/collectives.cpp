@@ -0,0 +1,269 @@
+#include "mpi_coll/include/collectives.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "mpi_coll/include/algorithms.hpp"
+#include "runners/include/runners.hpp"
+
+const auto *const kMpiCollEnvironment = ::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());
+
+namespace {
+
+using ppc::mpi_coll::Algorithm;
+using ppc::mpi_coll::Collective;
+
+int GetRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetSize() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+int64_t Value(int rank, int64_t i) {
+  return (static_cast<int64_t>(rank) * 1000003) + i;
+}
+
+std::vector<int64_t> Contribution(int rank, int count) {
+  std::vector<int64_t> data(static_cast<std::size_t>(count));
+  for (int i = 0; i < count; i++) {
+    data[static_cast<std::size_t>(i)] = Value(rank, i);
+  }
+  return data;
+}
+
+int64_t SumOverRanks(int64_t i) {
+  int64_t sum = 0;
+  for (int rank = 0; rank < GetSize(); rank++) {
+    sum += Value(rank, i);
+  }
+  return sum;
+}
+
+// 70000 int64 values span several 64 KiB ring segments and Rabenseifner windows
+const std::vector<int> kCounts = {1, 3, 1000, 70000};
+
+class CollectiveTest : public ::testing::TestWithParam<std::tuple<Collective, Algorithm>> {
+ protected:
+  ppc::mpi_coll::Communicator comm{MPI_COMM_WORLD};  // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+std::string ParamName(const ::testing::TestParamInfo<CollectiveTest::ParamType> &info) {
+  static constexpr std::array<const char *, 4> kNames = {"Bcast", "Reduce", "Allreduce", "Gather"};
+  return std::string(kNames.at(static_cast<std::size_t>(std::get<0>(info.param)))) + "_" +
+         std::string(ppc::mpi_coll::AlgorithmToString(std::get<1>(info.param)));
+}
+
+std::vector<std::tuple<Collective, Algorithm>> SupportedCombinations() {
+  std::vector<std::tuple<Collective, Algorithm>> combinations;
+  for (auto collective : {Collective::kBcast, Collective::kReduce, Collective::kAllreduce, Collective::kGather}) {
+    for (auto algorithm : {Algorithm::kAuto, Algorithm::kVendor, Algorithm::kBinomial, Algorithm::kRing,
+                           Algorithm::kRecursiveDoubling, Algorithm::kRabenseifner, Algorithm::kHierarchical}) {
+      if (ppc::mpi_coll::Supports(collective, algorithm)) {
+        combinations.emplace_back(collective, algorithm);
+      }
+    }
+  }
+  return combinations;
+}
+
+}  // namespace
+
+TEST_P(CollectiveTest, MatchesReference) {
+  const auto [collective, algorithm] = GetParam();
+  const int rank = GetRank();
+  const int size = GetSize();
+  for (int count : kCounts) {
+    for (int root = 0; root < size; root++) {
+      auto data = Contribution(rank, count);
+      std::vector<int64_t> result(static_cast<std::size_t>(count) * (collective == Collective::kGather ? size : 1));
+      switch (collective) {
+        case Collective::kBcast:
+          comm.Bcast(data.data(), count, MPI_INT64_T, root, algorithm);
+          for (int i = 0; i < count; i++) {
+            ASSERT_EQ(data[static_cast<std::size_t>(i)], Value(root, i));
+          }
+          break;
+        case Collective::kReduce:
+          comm.Reduce(data.data(), result.data(), count, MPI_INT64_T, MPI_SUM, root, algorithm);
+          for (int i = 0; rank == root && i < count; i++) {
+            ASSERT_EQ(result[static_cast<std::size_t>(i)], SumOverRanks(i));
+          }
+          break;
+        case Collective::kAllreduce:
+          comm.Allreduce(data.data(), result.data(), count, MPI_INT64_T, MPI_SUM, algorithm);
+          for (int i = 0; i < count; i++) {
+            ASSERT_EQ(result[static_cast<std::size_t>(i)], SumOverRanks(i));
+          }
+          break;
+        case Collective::kGather:
+          comm.Gather(data.data(), count, MPI_INT64_T, result.data(), root, algorithm);
+          for (int r = 0; rank == root && r < size; r++) {
+            for (int i = 0; i < count; i++) {
+              ASSERT_EQ(result[(static_cast<std::size_t>(r) * count) + i], Value(r, i));
+            }
+          }
+          break;
+      }
+    }
+  }
+}
+
+TEST_P(CollectiveTest, InPlace) {
+  const auto [collective, algorithm] = GetParam();
+  const int rank = GetRank();
+  const int size = GetSize();
+  const int count = 1000;
+  const int root = size - 1;
+  switch (collective) {
+    case Collective::kBcast:
+      GTEST_SKIP() << "Broadcast has no send buffer";
+    case Collective::kReduce: {
+      auto data = Contribution(rank, count);
+      comm.Reduce(rank == root ? MPI_IN_PLACE : data.data(), data.data(), count, MPI_INT64_T, MPI_SUM, root,
+                  algorithm);
+      for (int i = 0; rank == root && i < count; i++) {
+        ASSERT_EQ(data[static_cast<std::size_t>(i)], SumOverRanks(i));
+      }
+      break;
+    }
+    case Collective::kAllreduce: {
+      auto data = Contribution(rank, count);
+      comm.Allreduce(MPI_IN_PLACE, data.data(), count, MPI_INT64_T, MPI_SUM, algorithm);
+      for (int i = 0; i < count; i++) {
+        ASSERT_EQ(data[static_cast<std::size_t>(i)], SumOverRanks(i));
+      }
+      break;
+    }
+    case Collective::kGather: {
+      auto data = Contribution(rank, count);
+      std::vector<int64_t> result(static_cast<std::size_t>(count) * size);
+      if (rank == root) {
+        std::copy(data.begin(), data.end(), result.begin() + (static_cast<std::ptrdiff_t>(root) * count));
+      }
+      comm.Gather(rank == root ? MPI_IN_PLACE : data.data(), count, MPI_INT64_T, result.data(), root, algorithm);
+      for (int r = 0; rank == root && r < size; r++) {
+        ASSERT_EQ(result[static_cast<std::size_t>(r) * count], Value(r, 0));
+      }
+      break;
+    }
+  }
+}
+
+TEST_P(CollectiveTest, DoubleMaxReduction) {
+  const auto [collective, algorithm] = GetParam();
+  if (collective != Collective::kAllreduce) {
+    GTEST_SKIP() << "Reduction-only check";
+  }
+  const int rank = GetRank();
+  std::vector<double> data(100);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<double>((rank * 37 + static_cast<int>(i) * 11) % 101);
+  }
+  std::vector<double> expected(data.size());
+  MPI_Allreduce(data.data(), expected.data(), static_cast<int>(data.size()), MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  comm.Allreduce(MPI_IN_PLACE, data.data(), static_cast<int>(data.size()), MPI_DOUBLE, MPI_MAX, algorithm);
+  EXPECT_EQ(data, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(All, CollectiveTest, ::testing::ValuesIn(SupportedCombinations()), ParamName);
+
+namespace {
+
+void Subtract(void *in, void *inout, int *len, MPI_Datatype * /*type*/) {
+  auto *a = static_cast<int *>(in);
+  auto *b = static_cast<int *>(inout);
+  for (int i = 0; i < *len; i++) {
+    b[i] = a[i] - b[i];
+  }
+}
+
+}  // namespace
+
+TEST(MpiCollTest, NonCommutativeOperationFallsBackToVendor) {
+  MPI_Op subtract = MPI_OP_NULL;
+  MPI_Op_create(&Subtract, 0, &subtract);
+  ppc::mpi_coll::Communicator comm(MPI_COMM_WORLD);
+  EXPECT_EQ(comm.Select(Collective::kAllreduce, 8, false), Algorithm::kVendor);
+  const int value = GetRank() + 1;
+  int result = 0;
+  int expected = 0;
+  comm.Allreduce(&value, &result, 1, MPI_INT, subtract);
+  MPI_Allreduce(&value, &expected, 1, MPI_INT, subtract, MPI_COMM_WORLD);
+  EXPECT_EQ(result, expected);
+  EXPECT_THROW(ppc::mpi_coll::RecursiveDoublingAllreduce(&value, &result, 1, MPI_INT, subtract, MPI_COMM_WORLD),
+               std::invalid_argument);
+  MPI_Op_free(&subtract);
+}
+
+TEST(MpiCollTest, UnsupportedAlgorithmThrows) {
+  ppc::mpi_coll::Communicator comm(MPI_COMM_WORLD);
+  int value = 0;
+  EXPECT_THROW(comm.Bcast(&value, 1, MPI_INT, 0, Algorithm::kRecursiveDoubling), std::invalid_argument);
+  EXPECT_FALSE(ppc::mpi_coll::Supports(Collective::kGather, Algorithm::kRing));
+}
+
+TEST(MpiCollTest, SizeBasedSelection) {
+  using ppc::mpi_coll::SelectFlatAlgorithm;
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kBcast, 8, 16), Algorithm::kBinomial);
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kBcast, std::size_t{1} << 24, 16), Algorithm::kRing);
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kAllreduce, 8, 16), Algorithm::kRecursiveDoubling);
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kAllreduce, std::size_t{1} << 20, 16), Algorithm::kRabenseifner);
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kAllreduce, std::size_t{1} << 26, 16), Algorithm::kRing);
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kReduce, std::size_t{1} << 20, 16, false), Algorithm::kVendor);
+  EXPECT_EQ(SelectFlatAlgorithm(Collective::kGather, 8, 1), Algorithm::kVendor);
+}
+
+TEST(MpiCollTest, RejectsNonContiguousTypes) {
+  MPI_Datatype strided = MPI_DATATYPE_NULL;
+  MPI_Type_vector(2, 1, 2, MPI_INT, &strided);
+  MPI_Type_commit(&strided);
+  std::vector<int> data(4, 1);
+  EXPECT_THROW(ppc::mpi_coll::RingAllreduce(MPI_IN_PLACE, data.data(), 1, strided, MPI_SUM, MPI_COMM_WORLD),
+               std::invalid_argument);
+  // Every entry point checks the datatype, including the broadcast and calls without elements
+  EXPECT_THROW(ppc::mpi_coll::BinomialBcast(data.data(), 1, strided, 0, MPI_COMM_WORLD), std::invalid_argument);
+  EXPECT_THROW(ppc::mpi_coll::BinomialGather(data.data(), 0, strided, data.data(), 0, MPI_COMM_WORLD),
+               std::invalid_argument);
+  ppc::mpi_coll::Communicator comm(MPI_COMM_WORLD);
+  EXPECT_THROW(comm.Bcast(data.data(), 1, strided, 0, Algorithm::kBinomial), std::invalid_argument);
+  EXPECT_THROW(comm.Bcast(data.data(), 0, strided, 0, Algorithm::kHierarchical), std::invalid_argument);
+  // kAuto falls back to the vendor broadcast, which copies only the strided elements
+  data = GetRank() == 0 ? std::vector<int>{5, 6, 7, 8} : std::vector<int>{0, 0, 0, 0};
+  comm.Bcast(data.data(), 1, strided, 0);
+  const std::vector<int> expected = GetRank() == 0 ? std::vector<int>{5, 6, 7, 8} : std::vector<int>{5, 0, 7, 0};
+  EXPECT_EQ(data, expected);
+  MPI_Type_free(&strided);
+}
+
+TEST(MpiCollTest, CollectivesDoNotMatchReceivesOfTheCaller) {
+  ppc::mpi_coll::Communicator comm(MPI_COMM_WORLD);
+  int comparison = MPI_UNEQUAL;
+  MPI_Comm_compare(comm.Get(), MPI_COMM_WORLD, &comparison);
+  EXPECT_EQ(comparison, MPI_CONGRUENT);
+  // A wildcard receive posted on the caller's communicator must not take a message of the broadcast
+  int received = -1;
+  MPI_Request request = MPI_REQUEST_NULL;
+  MPI_Irecv(&received, 1, MPI_INT, MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &request);
+  std::vector<int> data(64, GetRank() == 0 ? 7 : 0);
+  comm.Bcast(data.data(), 64, MPI_INT, 0, Algorithm::kBinomial);
+  EXPECT_EQ(data, std::vector<int>(64, 7));
+  const int own = 100 + GetRank();
+  MPI_Send(&own, 1, MPI_INT, GetRank(), 0, MPI_COMM_WORLD);
+  MPI_Wait(&request, MPI_STATUS_IGNORE);
+  EXPECT_EQ(received, own);
+}
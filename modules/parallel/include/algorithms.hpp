@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "parallel/include/execution_policy.hpp"
+#include "parallel/include/sort.hpp"
+#include "task/include/task.hpp"
+
+namespace ppc::parallel {
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator It, typename Fn>
+/// @brief Calls @p fn(element) for every element of [@p first, @p last) in parallel.
+void ForEach(const ExecutionPolicy<kBackend> &policy, It first, It last, const Fn &fn) {
+  ParallelForRange(policy, 0, last - first, [&](int64_t b, int64_t e) { std::for_each(first + b, first + e, fn); });
+}
+
+template <ppc::task::TypeOfTask kBackend, typename T, typename Reduce, typename Map>
+/// @brief Reduces map(i) over [@p begin, @p end) with a deterministic combination order.
+/// @param init Initial value, combined first.
+/// @param reduce Associative function combining two values.
+/// @param map Function producing the value of index i.
+/// @return The same value under every policy with the same grain: the combination order depends only on the grain
+///         and the number of elements.
+T TransformReduce(const ExecutionPolicy<kBackend> &policy, int64_t begin, int64_t end, T init, const Reduce &reduce,
+                  const Map &map) {
+  const int64_t n = end - begin;
+  const Blocks blocks = MakeBlocks(policy, n);
+  std::vector<T> partial(static_cast<std::size_t>(blocks.count));
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    const int64_t b = begin + blocks.Begin(block);
+    const int64_t e = begin + blocks.End(block, n);
+    T acc = map(b);
+    for (int64_t i = b + 1; i < e; i++) {
+      acc = reduce(std::move(acc), map(i));
+    }
+    partial[static_cast<std::size_t>(block)] = std::move(acc);
+  });
+  for (auto &value : partial) {
+    init = reduce(std::move(init), std::move(value));
+  }
+  return init;
+}
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator It, typename T, typename Op = std::plus<>>
+/// @brief Reduces [@p first, @p last) starting from @p init; see TransformReduce() for the ordering guarantee.
+T Reduce(const ExecutionPolicy<kBackend> &policy, It first, It last, T init, const Op &op = {}) {
+  return TransformReduce(policy, 0, last - first, std::move(init), op,
+                         [&](int64_t i) -> T { return static_cast<T>(first[i]); });
+}
+
+namespace detail {
+
+template <ppc::task::TypeOfTask kBackend, typename InIt, typename OutIt, typename T, typename Op>
+void BlockScan(const ExecutionPolicy<kBackend> &policy, InIt first, InIt last, OutIt d_first, const T *init,
+               const Op &op, bool inclusive) {
+  const int64_t n = last - first;
+  const Blocks blocks = MakeBlocks(policy, n);
+  if (blocks.count == 0) {
+    return;
+  }
+  // Pass 1: total of every block
+  std::vector<T> sums(static_cast<std::size_t>(blocks.count));
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    const int64_t e = blocks.End(block, n);
+    T acc = first[blocks.Begin(block)];
+    for (int64_t i = blocks.Begin(block) + 1; i < e; i++) {
+      acc = op(std::move(acc), first[i]);
+    }
+    sums[static_cast<std::size_t>(block)] = std::move(acc);
+  });
+  // Carry into every block; the first block has none unless an initial value is given
+  std::vector<T> carry(static_cast<std::size_t>(blocks.count));
+  for (std::size_t block = 0; block < carry.size(); block++) {
+    if (block > 0) {
+      carry[block] = (block == 1 && init == nullptr) ? sums[0] : op(carry[block - 1], sums[block - 1]);
+    } else if (init != nullptr) {
+      carry[0] = *init;
+    }
+  }
+  // Pass 2: scan every block from its carry; each element is read before its output is written
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    const int64_t b = blocks.Begin(block);
+    const int64_t e = blocks.End(block, n);
+    const bool has_carry = block > 0 || init != nullptr;
+    T acc = has_carry ? carry[static_cast<std::size_t>(block)] : T{};
+    for (int64_t i = b; i < e; i++) {
+      T value = first[i];
+      if (inclusive) {
+        acc = (i == b && !has_carry) ? std::move(value) : op(std::move(acc), std::move(value));
+        d_first[i] = acc;
+      } else {
+        d_first[i] = acc;
+        acc = op(std::move(acc), std::move(value));
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator InIt, std::random_access_iterator OutIt,
+          typename Op = std::plus<>>
+/// @brief Parallel inclusive prefix scan: d_first[i] = first[0] op ... op first[i]. May run in place.
+/// @return Iterator past the last written element.
+OutIt InclusiveScan(const ExecutionPolicy<kBackend> &policy, InIt first, InIt last, OutIt d_first,
+                    const Op &op = {}) {
+  using T = std::iter_value_t<InIt>;
+  detail::BlockScan<kBackend, InIt, OutIt, T>(policy, first, last, d_first, nullptr, op, true);
+  return d_first + (last - first);
+}
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator InIt, std::random_access_iterator OutIt,
+          typename T, typename Op = std::plus<>>
+/// @brief Parallel exclusive prefix scan: d_first[i] = init op first[0] op ... op first[i - 1]. May run in place.
+/// @return Iterator past the last written element.
+OutIt ExclusiveScan(const ExecutionPolicy<kBackend> &policy, InIt first, InIt last, OutIt d_first, T init,
+                    const Op &op = {}) {
+  detail::BlockScan<kBackend, InIt, OutIt, T>(policy, first, last, d_first, &init, op, false);
+  return d_first + (last - first);
+}
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator It, typename Compare = std::less<>>
+/// @brief Parallel merge sort: blocks are sorted concurrently, then merged with MergeRuns().
+/// @details Like std::sort the order of equivalent elements is not preserved; see StableSort() and, for integer
+///          keys, RadixSort() in sort.hpp.
+void Sort(const ExecutionPolicy<kBackend> &policy, It first, It last, const Compare &comp = {}) {
+  const int64_t n = last - first;
+  const Blocks blocks = MakeBlocks(policy, n);
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    std::sort(first + blocks.Begin(block), first + blocks.End(block, n), comp);
+  });
+  std::vector<int64_t> bounds;
+  for (int64_t block = 0; block <= blocks.count; block++) {
+    bounds.push_back(std::min(blocks.Begin(block), n));
+  }
+  MergeRuns(policy, first, last, std::move(bounds), comp);
+}
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator It, typename Pred>
+/// @brief Parallel stable partition: elements satisfying @p pred move to the front, keeping their relative order.
+/// @details Counts matches per block, scans the counts and scatters through a temporary buffer.
+/// @return Iterator to the first element of the second group.
+It Partition(const ExecutionPolicy<kBackend> &policy, It first, It last, const Pred &pred) {
+  using T = std::iter_value_t<It>;
+  const int64_t n = last - first;
+  const Blocks blocks = MakeBlocks(policy, n);
+  std::vector<int64_t> matches(static_cast<std::size_t>(blocks.count));
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    matches[static_cast<std::size_t>(block)] =
+        std::count_if(first + blocks.Begin(block), first + blocks.End(block, n), pred);
+  });
+  std::vector<int64_t> true_offset(static_cast<std::size_t>(blocks.count));
+  int64_t total_true = 0;
+  for (std::size_t block = 0; block < matches.size(); block++) {
+    true_offset[block] = total_true;
+    total_true += matches[block];
+  }
+  std::vector<T> buffer(static_cast<std::size_t>(n));
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    const int64_t b = blocks.Begin(block);
+    int64_t t = true_offset[static_cast<std::size_t>(block)];
+    // Non-matching elements of the preceding blocks: b - (matches before this block)
+    int64_t f = total_true + (b - t);
+    for (int64_t i = b; i < blocks.End(block, n); i++) {
+      auto &slot = buffer[static_cast<std::size_t>(pred(first[i]) ? t++ : f++)];
+      slot = std::move(first[i]);
+    }
+  });
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    std::move(buffer.begin() + blocks.Begin(block), buffer.begin() + blocks.End(block, n), first + blocks.Begin(block));
+  });
+  return first + total_true;
+}
+
+}  // namespace ppc::parallel
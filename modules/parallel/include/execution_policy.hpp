@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "task/include/task.hpp"
+#include "thread_pool/include/thread_pool.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::parallel {
+
+/// @brief Number of blocks per thread for kernels that size their work by the thread count (e.g. GEMM tiles).
+inline constexpr int64_t kBlocksPerThread = 4;
+
+/// @brief Number of blocks used when no grain size is given.
+/// @details Fixed rather than derived from the thread count, so the default decomposition (and with it the
+///          combination order of reductions and scans) depends only on the number of elements. 256 blocks leave
+///          room for load balancing on machines with up to a few dozen cores.
+inline constexpr int64_t kDefaultNumBlocks = 256;
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Compile-time execution policy selecting the threading backend of an algorithm.
+/// @details The backend is part of the type, so every algorithm is fully specialized for it and the inner loops
+///          contain no runtime dispatch. Supported backends are kSEQ, kOMP, kTBB and kSTL (the latter runs on
+///          ppc::thread_pool::ThreadPool::Instance()).
+/// @tparam kBackend Backend of the policy.
+struct ExecutionPolicy {
+  static_assert(kBackend == ppc::task::TypeOfTask::kSEQ || kBackend == ppc::task::TypeOfTask::kOMP ||
+                    kBackend == ppc::task::TypeOfTask::kTBB || kBackend == ppc::task::TypeOfTask::kSTL,
+                "ExecutionPolicy supports the seq, omp, tbb and stl backends");
+
+  /// @brief Backend selected by this policy.
+  static constexpr ppc::task::TypeOfTask kType = kBackend;
+
+  /// @brief Number of elements processed as one block; 0 splits the range into kDefaultNumBlocks blocks.
+  /// @details The block decomposition depends only on the grain and the number of elements, never on the backend
+  ///          or the thread count, so reductions and scans combine partial results in the same order under every
+  ///          policy.
+  int64_t grain = 0;
+};
+
+using SeqPolicy = ExecutionPolicy<ppc::task::TypeOfTask::kSEQ>;
+using OmpPolicy = ExecutionPolicy<ppc::task::TypeOfTask::kOMP>;
+using TbbPolicy = ExecutionPolicy<ppc::task::TypeOfTask::kTBB>;
+using StlPolicy = ExecutionPolicy<ppc::task::TypeOfTask::kSTL>;
+
+inline constexpr SeqPolicy kSeq{};
+inline constexpr OmpPolicy kOmp{};
+inline constexpr TbbPolicy kTbb{};
+inline constexpr StlPolicy kStl{};
+
+#ifdef PPC_GENERIC_BACKEND
+/// @brief Backend of the generic implementation being compiled.
+/// @details CMake builds the sources under <task>/generic/src once per backend (see setup_generic_implementation in
+///          cmake/functions.cmake) and sets PPC_GENERIC_BACKEND accordingly. A source instantiates its kernel with
+///          `template class MyTask<ppc::parallel::kGenericBackend>;`. The value differs between the per-backend
+///          libraries, so the constant has internal linkage rather than being an inline variable.
+static constexpr ppc::task::TypeOfTask kGenericBackend = ppc::task::TypeOfTask::PPC_GENERIC_BACKEND;
+#endif
+
+/// @brief Contiguous block decomposition of [0, count) shared by all algorithms.
+struct Blocks {
+  int64_t count = 0;
+  int64_t size = 1;
+
+  /// @brief Returns the first index of block @p block.
+  [[nodiscard]] int64_t Begin(int64_t block) const {
+    return block * size;
+  }
+  /// @brief Returns the index past the end of block @p block.
+  [[nodiscard]] int64_t End(int64_t block, int64_t n) const {
+    return std::min(n, (block + 1) * size);
+  }
+};
+
+template <ppc::task::TypeOfTask kBackend>
+/// @brief Splits @p n elements into blocks according to the grain of @p policy.
+Blocks MakeBlocks(const ExecutionPolicy<kBackend> &policy, int64_t n) {
+  if (n <= 0) {
+    return {};
+  }
+  int64_t size = policy.grain;
+  if (size <= 0) {
+    size = (n + kDefaultNumBlocks - 1) / kDefaultNumBlocks;
+  }
+  return {.count = (n + size - 1) / size, .size = size};
+}
+
+template <ppc::task::TypeOfTask kBackend, typename Body>
+/// @brief Calls @p body(block) for every block index in [0, @p num_blocks) using the policy's backend.
+void ForEachBlock(const ExecutionPolicy<kBackend> & /*policy*/, int64_t num_blocks, const Body &body) {
+  using ppc::task::TypeOfTask;
+  if constexpr (kBackend == TypeOfTask::kOMP) {
+#pragma omp parallel for schedule(dynamic, 1) num_threads(ppc::util::GetNumThreads()) default(none) \
+    shared(body, num_blocks)
+    for (int64_t block = 0; block < num_blocks; block++) {
+      body(block);
+    }
+  } else if constexpr (kBackend == TypeOfTask::kTBB) {
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_blocks, 1), [&](const tbb::blocked_range<int64_t> &r) {
+      for (int64_t block = r.begin(); block < r.end(); block++) {
+        body(block);
+      }
+    });
+  } else if constexpr (kBackend == TypeOfTask::kSTL) {
+    ppc::thread_pool::ThreadPool::Instance().ParallelFor(0, num_blocks, body, 1);
+  } else {
+    for (int64_t block = 0; block < num_blocks; block++) {
+      body(block);
+    }
+  }
+}
+
+template <ppc::task::TypeOfTask kBackend, typename Body>
+/// @brief Calls @p body(b, e) for sub-ranges covering [@p begin, @p end) in parallel.
+void ParallelForRange(const ExecutionPolicy<kBackend> &policy, int64_t begin, int64_t end, const Body &body) {
+  const Blocks blocks = MakeBlocks(policy, end - begin);
+  ForEachBlock(policy, blocks.count,
+               [&](int64_t block) { body(begin + blocks.Begin(block), begin + blocks.End(block, end - begin)); });
+}
+
+template <ppc::task::TypeOfTask kBackend, typename Body>
+/// @brief Calls @p body(i) for every i in [@p begin, @p end) in parallel.
+void ParallelFor(const ExecutionPolicy<kBackend> &policy, int64_t begin, int64_t end, const Body &body) {
+  ParallelForRange(policy, begin, end, [&](int64_t b, int64_t e) {
+    for (int64_t i = b; i < e; i++) {
+      body(i);
+    }
+  });
+}
+
+}  // namespace ppc::parallel
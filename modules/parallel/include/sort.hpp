@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+
+namespace ppc::parallel {
+
+namespace detail {
+
+template <typename It1, typename It2, typename Compare>
+/// Returns how many of the first @p diagonal elements of the stable merge of a and b come from a (merge path:
+/// binary search along an anti-diagonal of the merge grid).
+int64_t MergePathSplit(It1 a, int64_t a_size, It2 b, int64_t b_size, int64_t diagonal, const Compare &comp) {
+  int64_t low = std::max<int64_t>(0, diagonal - b_size);
+  int64_t high = std::min(diagonal, a_size);
+  while (low < high) {
+    const int64_t mid = low + ((high - low) / 2);
+    // Equal keys are taken from a first, so a[mid] is in the prefix unless b[diagonal - mid - 1] is less
+    if (comp(b[diagonal - mid - 1], a[mid])) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return low;
+}
+
+}  // namespace detail
+
+template <ppc::task::TypeOfTask kBackend, typename It1, typename It2, std::random_access_iterator OutIt,
+          typename Compare = std::less<>>
+/// @brief Parallel std::merge: stable merge of two sorted ranges into @p d_first.
+/// @details The output is cut into MakeBlocks() blocks and the inputs of every block are found by binary search
+///          (merge path), so all blocks are merged independently and take equally long however the keys interleave.
+///          Unlike pairwise merging of whole runs, the last merge of a sort is as parallel as the first.
+/// @tparam It1 Random-access iterator; unconstrained so that std::move_iterator, which C++20 only counts as an
+///         input iterator, can be passed. Same for @p It2.
+/// @return Iterator past the last written element.
+OutIt Merge(const ExecutionPolicy<kBackend> &policy, It1 first1, It1 last1, It2 first2, It2 last2, OutIt d_first,
+            const Compare &comp = {}) {
+  const int64_t a_size = last1 - first1;
+  const int64_t b_size = last2 - first2;
+  const int64_t n = a_size + b_size;
+  const Blocks blocks = MakeBlocks(policy, n);
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    const int64_t begin = blocks.Begin(block);
+    const int64_t end = blocks.End(block, n);
+    const int64_t a_begin = detail::MergePathSplit(first1, a_size, first2, b_size, begin, comp);
+    const int64_t a_end = detail::MergePathSplit(first1, a_size, first2, b_size, end, comp);
+    std::merge(first1 + a_begin, first1 + a_end, first2 + (begin - a_begin), first2 + (end - a_end), d_first + begin,
+               comp);
+  });
+  return d_first + n;
+}
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator It, typename Compare = std::less<>>
+/// @brief Merges consecutive sorted runs of [@p first, @p last) into one sorted range, stably.
+/// @details Neighbouring runs are merged pairwise with Merge() in log2(runs) rounds, alternating between the range
+///          and a temporary buffer.
+/// @param bounds Begin of every run followed by the range size, e.g. the receive displacements of an
+///        MPI_Alltoallv of sorted pieces.
+/// @throws std::invalid_argument if @p bounds does not increase from 0 to the range size.
+void MergeRuns(const ExecutionPolicy<kBackend> &policy, It first, It last, std::vector<int64_t> bounds,
+               const Compare &comp = {}) {
+  using T = std::iter_value_t<It>;
+  const int64_t n = last - first;
+  if (bounds.empty() || bounds.front() != 0 || bounds.back() != n || !std::ranges::is_sorted(bounds)) {
+    throw std::invalid_argument("MergeRuns: run bounds must increase from 0 to the range size");
+  }
+  if (bounds.size() <= 2) {
+    return;
+  }
+  std::vector<T> buffer(static_cast<std::size_t>(n));
+  auto merge_round = [&](auto src, auto dst) {
+    std::vector<int64_t> merged{0};
+    const std::size_t runs = bounds.size() - 1;
+    for (std::size_t run = 0; run < runs; run += 2) {
+      // The last run of an odd count has no partner and is only moved
+      const int64_t middle = bounds[run + 1];
+      const int64_t end = run + 2 <= runs ? bounds[run + 2] : middle;
+      Merge(policy, std::make_move_iterator(src + bounds[run]), std::make_move_iterator(src + middle),
+            std::make_move_iterator(src + middle), std::make_move_iterator(src + end), dst + bounds[run], comp);
+      merged.push_back(end);
+    }
+    bounds = std::move(merged);
+  };
+  bool in_buffer = false;
+  while (bounds.size() > 2) {
+    if (in_buffer) {
+      merge_round(buffer.begin(), first);
+    } else {
+      merge_round(first, buffer.begin());
+    }
+    in_buffer = !in_buffer;
+  }
+  if (in_buffer) {
+    ParallelForRange(policy, 0, n, [&](int64_t begin, int64_t end) {
+      std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+    });
+  }
+}
+
+template <ppc::task::TypeOfTask kBackend, std::random_access_iterator It, typename Compare = std::less<>>
+/// @brief Parallel std::stable_sort: blocks are sorted concurrently, then merged with MergeRuns().
+void StableSort(const ExecutionPolicy<kBackend> &policy, It first, It last, const Compare &comp = {}) {
+  const int64_t n = last - first;
+  const Blocks blocks = MakeBlocks(policy, n);
+  ForEachBlock(policy, blocks.count, [&](int64_t block) {
+    std::stable_sort(first + blocks.Begin(block), first + blocks.End(block, n), comp);
+  });
+  std::vector<int64_t> bounds;
+  for (int64_t block = 0; block <= blocks.count; block++) {
+    bounds.push_back(std::min(blocks.Begin(block), n));
+  }
+  MergeRuns(policy, first, last, std::move(bounds), comp);
+}
+
+/// @brief Integer key types accepted by RadixSort().
+template <typename T>
+concept RadixKey = std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool>;
+
+template <ppc::task::TypeOfTask kBackend, std::contiguous_iterator It>
+  requires RadixKey<std::iter_value_t<It>>
+/// @brief Parallel LSD radix sort of integer keys, one byte per pass.
+/// @details Every pass counts the digits of each MakeBlocks() block, turns the counts into per-block write offsets
+///          (digit-major, block-minor, which keeps the sort stable) and scatters the blocks in parallel into a
+///          buffer. Passes in which all keys share the digit are skipped, so small keys in a wide type cost only
+///          the passes their values need. Signed keys get their sign bit flipped before and after sorting, which
+///          orders them as unsigned numbers in vectorizable loops instead of a branch per digit.
+void RadixSort(const ExecutionPolicy<kBackend> &policy, It first, It last) {
+  using T = std::iter_value_t<It>;
+  using U = std::make_unsigned_t<T>;
+  constexpr int kDigitBits = 8;
+  constexpr std::size_t kRadix = std::size_t{1} << kDigitBits;
+  constexpr int kKeyBits = static_cast<int>(sizeof(U)) * CHAR_BIT;
+  const int64_t n = last - first;
+  if (n < 2) {
+    return;
+  }
+  // The signed and unsigned variants of an integer type may alias each other
+  U *keys = reinterpret_cast<U *>(std::to_address(first));
+  auto flip_sign = [&] {
+    if constexpr (std::is_signed_v<T>) {
+      constexpr auto kSignBit = static_cast<U>(U{1} << (kKeyBits - 1));
+      ParallelForRange(policy, 0, n, [&](int64_t begin, int64_t end) {
+#pragma omp simd
+        for (int64_t i = begin; i < end; i++) {
+          keys[i] ^= kSignBit;
+        }
+      });
+    }
+  };
+  flip_sign();
+
+  const Blocks blocks = MakeBlocks(policy, n);
+  std::vector<std::array<int64_t, kRadix>> offsets(static_cast<std::size_t>(blocks.count));
+  std::vector<U> buffer(static_cast<std::size_t>(n));
+  U *src = keys;
+  U *dst = buffer.data();
+  for (int shift = 0; shift < kKeyBits; shift += kDigitBits) {
+    auto digit = [shift](U key) { return static_cast<std::size_t>((key >> shift) & (kRadix - 1)); };
+    ForEachBlock(policy, blocks.count, [&](int64_t block) {
+      auto &counts = offsets[static_cast<std::size_t>(block)];
+      counts.fill(0);
+      for (int64_t i = blocks.Begin(block); i < blocks.End(block, n); i++) {
+        counts[digit(src[i])]++;
+      }
+    });
+    int64_t offset = 0;
+    bool uniform = false;
+    for (std::size_t d = 0; d < kRadix && !uniform; d++) {
+      const int64_t digit_begin = offset;
+      for (auto &counts : offsets) {
+        const int64_t count = counts[d];
+        counts[d] = offset;
+        offset += count;
+      }
+      uniform = offset - digit_begin == n;
+    }
+    if (uniform) {
+      continue;
+    }
+    ForEachBlock(policy, blocks.count, [&](int64_t block) {
+      auto &next = offsets[static_cast<std::size_t>(block)];
+      for (int64_t i = blocks.Begin(block); i < blocks.End(block, n); i++) {
+        dst[next[digit(src[i])]++] = src[i];
+      }
+    });
+    std::swap(src, dst);
+  }
+  if (src != keys) {
+    ParallelForRange(policy, 0, n,
+                     [&](int64_t begin, int64_t end) { std::copy(src + begin, src + end, keys + begin); });
+  }
+  flip_sign();
+}
+
+}  // namespace ppc::parallel
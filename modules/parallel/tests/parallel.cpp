@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "parallel/include/algorithms.hpp"
+#include "parallel/include/execution_policy.hpp"
+
+namespace {
+
+std::vector<int64_t> RandomValues(std::size_t n, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+  std::vector<int64_t> values(n);
+  for (auto &v : values) {
+    v = dist(gen);
+  }
+  return values;
+}
+
+template <typename Policy>
+class ParallelAlgorithmsTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<ppc::parallel::SeqPolicy, ppc::parallel::OmpPolicy, ppc::parallel::TbbPolicy,
+                                  ppc::parallel::StlPolicy>;
+TYPED_TEST_SUITE(ParallelAlgorithmsTest, Policies);
+
+// Sizes around block boundaries, with automatic and explicit grains
+const std::vector<std::size_t> kSizes = {0, 1, 7, 64, 1000, 4099};
+const std::vector<int64_t> kGrains = {0, 1, 3, 256};
+
+}  // namespace
+
+TYPED_TEST(ParallelAlgorithmsTest, ParallelForVisitsEveryIndexOnce) {
+  for (int64_t grain : kGrains) {
+    std::vector<int> visits(1000, 0);
+    ppc::parallel::ParallelFor(TypeParam{.grain = grain}, 0, 1000, [&](int64_t i) { visits[i]++; });
+    EXPECT_TRUE(std::ranges::all_of(visits, [](int v) { return v == 1; }));
+  }
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, ForEachAppliesFunction) {
+  std::vector<int> values(513, 2);
+  ppc::parallel::ForEach(TypeParam{}, values.begin(), values.end(), [](int &v) { v *= 3; });
+  EXPECT_TRUE(std::ranges::all_of(values, [](int v) { return v == 6; }));
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, ReduceMatchesSeqPolicy) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      const auto values = RandomValues(n, 1);
+      const auto expected = std::accumulate(values.begin(), values.end(), int64_t{5});
+      EXPECT_EQ(ppc::parallel::Reduce(TypeParam{.grain = grain}, values.begin(), values.end(), int64_t{5}), expected);
+    }
+  }
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, ReduceKeepsOrderOfNonCommutativeOp) {
+  std::vector<std::string> letters;
+  for (char c = 'a'; c <= 'z'; c++) {
+    letters.emplace_back(1, c);
+  }
+  const auto text = ppc::parallel::Reduce(TypeParam{.grain = 3}, letters.begin(), letters.end(), std::string{">"});
+  EXPECT_EQ(text, ">abcdefghijklmnopqrstuvwxyz");
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, FloatingPointReduceIsBitwiseEqualToSeq) {
+  std::vector<double> values(10007);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = 1.0 / static_cast<double>(i + 1);
+  }
+  for (int64_t grain : {int64_t{0}, int64_t{100}}) {
+    const ppc::parallel::SeqPolicy seq{.grain = grain};
+    EXPECT_EQ(ppc::parallel::Reduce(TypeParam{.grain = grain}, values.begin(), values.end(), 0.0),
+              ppc::parallel::Reduce(seq, values.begin(), values.end(), 0.0));
+  }
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, InclusiveScanMatchesStd) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      const auto values = RandomValues(n, 2);
+      std::vector<int64_t> expected(n);
+      std::inclusive_scan(values.begin(), values.end(), expected.begin());
+      std::vector<int64_t> result(n);
+      ppc::parallel::InclusiveScan(TypeParam{.grain = grain}, values.begin(), values.end(), result.begin());
+      EXPECT_EQ(result, expected);
+    }
+  }
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, ExclusiveScanInPlaceMatchesStd) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      auto values = RandomValues(n, 3);
+      std::vector<int64_t> expected(n);
+      std::exclusive_scan(values.begin(), values.end(), expected.begin(), int64_t{10});
+      ppc::parallel::ExclusiveScan(TypeParam{.grain = grain}, values.begin(), values.end(), values.begin(),
+                                   int64_t{10});
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, ScanWithCustomOp) {
+  std::vector<int64_t> values = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+  std::vector<int64_t> result(values.size());
+  const auto max = [](int64_t a, int64_t b) { return std::max(a, b); };
+  ppc::parallel::InclusiveScan(TypeParam{.grain = 3}, values.begin(), values.end(), result.begin(), max);
+  EXPECT_EQ(result, (std::vector<int64_t>{3, 3, 4, 4, 5, 9, 9, 9, 9, 9}));
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, SortMatchesStd) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      auto values = RandomValues(n, 4);
+      auto expected = values;
+      std::ranges::sort(expected);
+      ppc::parallel::Sort(TypeParam{.grain = grain}, values.begin(), values.end());
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, SortWithComparator) {
+  auto values = RandomValues(999, 5);
+  ppc::parallel::Sort(TypeParam{.grain = 50}, values.begin(), values.end(), std::greater<>());
+  EXPECT_TRUE(std::ranges::is_sorted(values, std::greater<>()));
+}
+
+TYPED_TEST(ParallelAlgorithmsTest, PartitionIsStableAndMatchesStd) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      auto values = RandomValues(n, 6);
+      auto expected = values;
+      const auto is_even = [](int64_t v) { return v % 2 == 0; };
+      const auto expected_point = std::stable_partition(expected.begin(), expected.end(), is_even);
+      const auto point = ppc::parallel::Partition(TypeParam{.grain = grain}, values.begin(), values.end(), is_even);
+      EXPECT_EQ(values, expected);
+      EXPECT_EQ(point - values.begin(), expected_point - expected.begin());
+    }
+  }
+}
+
+TEST(ParallelBlocksTest, GrainDefinesBlocks) {
+  const auto blocks = ppc::parallel::MakeBlocks(ppc::parallel::OmpPolicy{.grain = 10}, 95);
+  EXPECT_EQ(blocks.count, 10);
+  EXPECT_EQ(blocks.Begin(9), 90);
+  EXPECT_EQ(blocks.End(9, 95), 95);
+  EXPECT_EQ(ppc::parallel::MakeBlocks(ppc::parallel::kSeq, 0).count, 0);
+  EXPECT_EQ(ppc::parallel::MakeBlocks(ppc::parallel::kSeq, 100).count, 100);
+  EXPECT_EQ(ppc::parallel::MakeBlocks(ppc::parallel::kSeq, 10240).count, ppc::parallel::kDefaultNumBlocks);
+}
+
+TEST(ParallelBlocksTest, DefaultGrainDoesNotDependOnBackend) {
+  for (int64_t n : {int64_t{1}, int64_t{255}, int64_t{257}, int64_t{10007}}) {
+    const auto seq = ppc::parallel::MakeBlocks(ppc::parallel::kSeq, n);
+    const auto omp = ppc::parallel::MakeBlocks(ppc::parallel::kOmp, n);
+    EXPECT_EQ(seq.count, omp.count);
+    EXPECT_EQ(seq.size, omp.size);
+  }
+}
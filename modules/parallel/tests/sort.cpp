@@ -0,0 +1,130 @@
+#include "parallel/include/sort.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "parallel/include/execution_policy.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> RandomKeys(std::size_t n, uint32_t seed, T low = std::numeric_limits<T>::min(),
+                          T high = std::numeric_limits<T>::max()) {
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int64_t> dist(low, high);
+  std::vector<T> keys(n);
+  for (auto &key : keys) {
+    key = static_cast<T>(dist(gen));
+  }
+  return keys;
+}
+
+template <typename Policy>
+class ParallelSortTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<ppc::parallel::SeqPolicy, ppc::parallel::OmpPolicy, ppc::parallel::TbbPolicy,
+                                  ppc::parallel::StlPolicy>;
+TYPED_TEST_SUITE(ParallelSortTest, Policies);
+
+const std::vector<std::size_t> kSizes = {0, 1, 2, 7, 64, 1000, 4099};
+const std::vector<int64_t> kGrains = {0, 1, 3, 256};
+
+}  // namespace
+
+TYPED_TEST(ParallelSortTest, MergeMatchesStdForAnyInterleaving) {
+  for (int64_t grain : kGrains) {
+    // All of a before b, all of b before a, and interleaved with duplicates
+    for (const auto &[a_low, b_low] : {std::pair(0, 1000), std::pair(1000, 0), std::pair(0, 0)}) {
+      auto a = RandomKeys<int>(301, 1, a_low, a_low + 999);
+      auto b = RandomKeys<int>(97, 2, b_low, b_low + 999);
+      std::ranges::sort(a);
+      std::ranges::sort(b);
+      std::vector<int> expected(a.size() + b.size());
+      std::vector<int> merged(expected.size());
+      std::ranges::merge(a, b, expected.begin());
+      const auto end = ppc::parallel::Merge(TypeParam{.grain = grain}, a.begin(), a.end(), b.begin(), b.end(),
+                                            merged.begin());
+      EXPECT_EQ(end, merged.end());
+      EXPECT_EQ(merged, expected);
+    }
+  }
+}
+
+TYPED_TEST(ParallelSortTest, StableSortKeepsOrderOfEqualKeys) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      // (key, original position) sorted by key only
+      const auto keys = RandomKeys<int>(n, 3, 0, 20);
+      std::vector<std::pair<int, std::size_t>> values;
+      for (std::size_t i = 0; i < n; i++) {
+        values.emplace_back(keys[i], i);
+      }
+      auto expected = values;
+      auto by_key = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+      std::ranges::stable_sort(expected, by_key);
+      ppc::parallel::StableSort(TypeParam{.grain = grain}, values.begin(), values.end(), by_key);
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+TYPED_TEST(ParallelSortTest, MergeRunsOfUnequalLength) {
+  std::vector<int> values;
+  std::vector<int64_t> bounds = {0};
+  for (int run = 0; run < 5; run++) {
+    auto keys = RandomKeys<int>(static_cast<std::size_t>(run * run * 10), 4 + run, -50, 50);
+    std::ranges::sort(keys, std::greater<>());
+    values.insert(values.end(), keys.begin(), keys.end());
+    bounds.push_back(static_cast<int64_t>(values.size()));
+  }
+  auto expected = values;
+  std::ranges::sort(expected, std::greater<>());
+  ppc::parallel::MergeRuns(TypeParam{.grain = 16}, values.begin(), values.end(), bounds, std::greater<>());
+  EXPECT_EQ(values, expected);
+  EXPECT_THROW(ppc::parallel::MergeRuns(TypeParam{}, values.begin(), values.end(), {0, 5}), std::invalid_argument);
+}
+
+TYPED_TEST(ParallelSortTest, RadixSortMatchesStd) {
+  for (std::size_t n : kSizes) {
+    for (int64_t grain : kGrains) {
+      auto signed_keys = RandomKeys<int32_t>(n, 5);
+      auto unsigned_keys = RandomKeys<uint64_t>(n, 6);
+      auto expected_signed = signed_keys;
+      auto expected_unsigned = unsigned_keys;
+      std::ranges::sort(expected_signed);
+      std::ranges::sort(expected_unsigned);
+      ppc::parallel::RadixSort(TypeParam{.grain = grain}, signed_keys.begin(), signed_keys.end());
+      ppc::parallel::RadixSort(TypeParam{.grain = grain}, unsigned_keys.begin(), unsigned_keys.end());
+      EXPECT_EQ(signed_keys, expected_signed);
+      EXPECT_EQ(unsigned_keys, expected_unsigned);
+    }
+  }
+}
+
+TYPED_TEST(ParallelSortTest, RadixSortNarrowAndSmallKeys) {
+  // Small values in a wide type skip the passes of the upper bytes; 8- and 16-bit keys take one or two passes
+  auto small = RandomKeys<int64_t>(5000, 7, -300, 300);
+  auto bytes = RandomKeys<int8_t>(5000, 8);
+  auto shorts = RandomKeys<uint16_t>(5000, 9);
+  auto expected_small = small;
+  auto expected_bytes = bytes;
+  auto expected_shorts = shorts;
+  std::ranges::sort(expected_small);
+  std::ranges::sort(expected_bytes);
+  std::ranges::sort(expected_shorts);
+  ppc::parallel::RadixSort(TypeParam{}, small.begin(), small.end());
+  ppc::parallel::RadixSort(TypeParam{}, bytes.begin(), bytes.end());
+  ppc::parallel::RadixSort(TypeParam{}, shorts.begin(), shorts.end());
+  EXPECT_EQ(small, expected_small);
+  EXPECT_EQ(bytes, expected_bytes);
+  EXPECT_EQ(shorts, expected_shorts);
+}
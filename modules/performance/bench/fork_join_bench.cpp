@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+#include <omp.h>
+
+#include <algorithm>
+#include <barrier>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/parallel_reduce.h"
+#include "oneapi/tbb/partitioner.h"
+#include "oneapi/tbb/task_arena.h"
+#include "performance/include/microbench.hpp"
+#include "runners/include/runners.hpp"
+#include "task/include/task.hpp"
+#include "thread_pool/include/thread_pool.hpp"
+#include "util/include/util.hpp"
+
+// Cost of the synchronization primitives every backend pays per parallel step:
+//   region   - start and join an empty team
+//   barrier  - one barrier inside an already running team
+//   reduce   - reduce one scalar contributed by every thread
+//   for      - parallel loop over kLoopIterations empty iterations
+// Thread backends are swept over GetBenchThreadCounts(PPC_NUM_THREADS) and should be run with one MPI process;
+// the MPI backend uses all processes of the job.
+
+namespace {
+
+using ppc::performance::BenchCompilerBarrier;
+using ppc::performance::MeasureAverage;
+using ppc::task::TypeOfTask;
+
+constexpr uint64_t kRepetitions = 2000;
+constexpr uint64_t kLoopRepetitions = 200;
+constexpr int64_t kLoopIterations = int64_t{1} << 16;
+constexpr std::string_view kSuite = "fork_join";
+
+bool IsRoot() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank == 0;
+}
+
+void Report(TypeOfTask backend, std::string_view operation, int threads, double seconds) {
+  if (IsRoot()) {
+    ppc::performance::PrintBenchResult(kSuite, ppc::task::TypeOfTaskToString(backend), operation, threads, seconds);
+  }
+}
+
+void Report(std::string_view backend, std::string_view operation, int threads, double seconds) {
+  if (IsRoot()) {
+    ppc::performance::PrintBenchResult(kSuite, backend, operation, threads, seconds);
+  }
+}
+
+std::vector<int> ThreadCounts() {
+  return ppc::performance::GetBenchThreadCounts(ppc::util::GetNumThreads());
+}
+
+void EmptyLoop(int64_t begin, int64_t end) {
+  for (int64_t i = begin; i < end; i++) {
+    BenchCompilerBarrier();
+  }
+}
+
+/// Runs body(thread_id) on @p num_threads freshly created threads, the caller being thread 0.
+void RunTeam(int num_threads, const std::function<void(int)> &body) {
+  std::vector<std::thread> threads;
+  threads.reserve(static_cast<std::size_t>(num_threads - 1));
+  for (int tid = 1; tid < num_threads; tid++) {
+    threads.emplace_back(body, tid);
+  }
+  body(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+TEST(ForkJoinBench, SEQ) {
+  Report(TypeOfTask::kSEQ, "region", 1, MeasureAverage(kRepetitions, [] { BenchCompilerBarrier(); }));
+  int64_t sum = 0;
+  Report(TypeOfTask::kSEQ, "reduce", 1, MeasureAverage(kRepetitions, [&] {
+    sum += 1;
+    BenchCompilerBarrier();
+  }));
+  Report(TypeOfTask::kSEQ, "for", 1, MeasureAverage(kLoopRepetitions, [] { EmptyLoop(0, kLoopIterations); }));
+  EXPECT_GT(sum, 0);
+}
+
+TEST(ForkJoinBench, OMP) {
+  for (int n : ThreadCounts()) {
+    Report(TypeOfTask::kOMP, "region", n, MeasureAverage(kRepetitions, [n] {
+#pragma omp parallel num_threads(n)
+      BenchCompilerBarrier();
+    }));
+
+    double barrier_sec = 0.0;
+#pragma omp parallel num_threads(n) default(none) shared(barrier_sec)
+    {
+#pragma omp barrier
+      const double begin = omp_get_wtime();
+      for (uint64_t i = 0; i < kRepetitions; i++) {
+#pragma omp barrier
+      }
+#pragma omp master
+      barrier_sec = (omp_get_wtime() - begin) / static_cast<double>(kRepetitions);
+    }
+    Report(TypeOfTask::kOMP, "barrier", n, barrier_sec);
+
+    int sum = 0;
+    Report(TypeOfTask::kOMP, "reduce", n, MeasureAverage(kRepetitions, [n, &sum] {
+      int local = 0;
+#pragma omp parallel num_threads(n) default(none) reduction(+ : local)
+      local += 1;
+      sum += local;
+    }));
+    EXPECT_GT(sum, 0);
+
+    Report(TypeOfTask::kOMP, "for", n, MeasureAverage(kLoopRepetitions, [n] {
+#pragma omp parallel for num_threads(n) schedule(static)
+      for (int64_t i = 0; i < kLoopIterations; i++) {
+        BenchCompilerBarrier();
+      }
+    }));
+  }
+}
+
+TEST(ForkJoinBench, TBB) {
+  // TBB has no team barrier: tasks of one parallel_for are not guaranteed to run concurrently
+  for (int n : ThreadCounts()) {
+    tbb::task_arena arena(n);
+    arena.execute([n] {
+      Report(TypeOfTask::kTBB, "region", n, MeasureAverage(kRepetitions, [n] {
+        tbb::parallel_for(0, n, [](int /*i*/) { BenchCompilerBarrier(); }, tbb::static_partitioner{});
+      }));
+
+      int64_t sum = 0;
+      Report(TypeOfTask::kTBB, "reduce", n, MeasureAverage(kRepetitions, [n, &sum] {
+        sum += tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), int64_t{0},
+            [](const tbb::blocked_range<int> &r, int64_t value) { return value + static_cast<int64_t>(r.size()); },
+            std::plus<>(), tbb::static_partitioner{});
+      }));
+      EXPECT_GT(sum, 0);
+
+      Report(TypeOfTask::kTBB, "for", n, MeasureAverage(kLoopRepetitions, [] {
+        tbb::parallel_for(tbb::blocked_range<int64_t>(0, kLoopIterations),
+                          [](const tbb::blocked_range<int64_t> &r) { EmptyLoop(r.begin(), r.end()); });
+      }));
+    });
+  }
+}
+
+TEST(ForkJoinBench, STL) {
+  for (int n : ThreadCounts()) {
+    Report(TypeOfTask::kSTL, "region", n,
+           MeasureAverage(kRepetitions / 10, [n] { RunTeam(n, [](int /*tid*/) { BenchCompilerBarrier(); }); }));
+
+    double barrier_sec = 0.0;
+    std::barrier sync(n);
+    RunTeam(n, [&](int tid) {
+      sync.arrive_and_wait();
+      const double sec = MeasureAverage(kRepetitions, [&] { sync.arrive_and_wait(); });
+      if (tid == 0) {
+        barrier_sec = sec;
+      }
+    });
+    Report(TypeOfTask::kSTL, "barrier", n, barrier_sec);
+
+    int64_t sum = 0;
+    Report(TypeOfTask::kSTL, "reduce", n, MeasureAverage(kRepetitions / 10, [n, &sum] {
+      std::vector<int64_t> partial(static_cast<std::size_t>(n));
+      RunTeam(n, [&partial](int tid) { partial[static_cast<std::size_t>(tid)] = 1; });
+      sum += std::accumulate(partial.begin(), partial.end(), int64_t{0});
+    }));
+    EXPECT_GT(sum, 0);
+
+    Report(TypeOfTask::kSTL, "for", n, MeasureAverage(kLoopRepetitions, [n] {
+      RunTeam(n, [n](int tid) {
+        const int64_t chunk = (kLoopIterations + n - 1) / n;
+        EmptyLoop(tid * chunk, std::min(kLoopIterations, (tid + 1) * chunk));
+      });
+    }));
+  }
+}
+
+TEST(ForkJoinBench, ThreadPool) {
+  // Same as TBB: pool tasks are not guaranteed to run concurrently, so there is no barrier
+  for (int n : ThreadCounts()) {
+    ppc::thread_pool::ThreadPool pool(n);
+    Report("stl_pool", "region", n, MeasureAverage(kRepetitions, [n, &pool] {
+      pool.ParallelFor(0, n, [](int64_t /*i*/) { BenchCompilerBarrier(); }, 1);
+    }));
+
+    int64_t sum = 0;
+    Report("stl_pool", "reduce", n, MeasureAverage(kRepetitions, [n, &pool, &sum] {
+      sum += pool.ParallelReduce(
+          0, n, int64_t{0}, [](int64_t b, int64_t e) { return e - b; }, std::plus<>(), 1);
+    }));
+    EXPECT_GT(sum, 0);
+
+    Report("stl_pool", "for", n, MeasureAverage(kLoopRepetitions, [&pool] {
+      pool.ParallelForRange(0, kLoopIterations, [](int64_t b, int64_t e) { EmptyLoop(b, e); });
+    }));
+  }
+}
+
+TEST(ForkJoinBench, MPI) {
+  // Processes are started once per job, so there is no region measurement for MPI
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  Report(TypeOfTask::kMPI, "barrier", size, MeasureAverage(kRepetitions, [] { MPI_Barrier(MPI_COMM_WORLD); }));
+
+  int sum = 0;
+  Report(TypeOfTask::kMPI, "reduce", size, MeasureAverage(kRepetitions, [&sum] {
+    int local = 1;
+    int global = 0;
+    MPI_Allreduce(&local, &global, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    sum += global;
+  }));
+  EXPECT_GT(sum, 0);
+
+  Report(TypeOfTask::kMPI, "for", size, MeasureAverage(kLoopRepetitions, [rank, size] {
+    const int64_t chunk = (kLoopIterations + size - 1) / size;
+    EmptyLoop(rank * chunk, std::min(kLoopIterations, (rank + 1) * chunk));
+    MPI_Barrier(MPI_COMM_WORLD);
+  }));
+}
+
+int main(int argc, char **argv) {
+  return ppc::runners::Init(argc, argv);
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "performance/include/microbench.hpp"
+#include "runners/include/runners.hpp"
+
+// Latency and bandwidth of the MPI transport for messages of 1 B to 64 MiB (powers of four):
+//   pingpong   - half round trip between two ranks
+//   bibw       - both ranks send and receive one message at the same time
+//   bcast      - broadcast from rank 0 over all ranks
+//   allreduce  - sum of unsigned chars over all ranks
+//   alltoall   - every rank sends a block of the given size to every rank (capped at kAlltoallBytesLimit in total)
+// Point-to-point pairs are reported for two ranks on one node ("intra_node", shared-memory transport) and for two
+// ranks on different nodes ("inter_node", network), whichever exist in the job; collectives run on all ranks
+// ("world"). Operation names are <benchmark>_<bytes>, the thread column holds the number of processes involved.
+
+namespace {
+
+constexpr std::string_view kSuite = "mpi";
+constexpr std::size_t kMaxBytes = std::size_t{64} << 20;
+constexpr std::size_t kBytesPerSizeBudget = std::size_t{256} << 20;
+constexpr std::size_t kAlltoallBytesLimit = std::size_t{256} << 20;
+constexpr int kPingTag = 1;
+constexpr int kPongTag = 2;
+
+int Rank(MPI_Comm comm = MPI_COMM_WORLD) {
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  return rank;
+}
+
+int Size(MPI_Comm comm = MPI_COMM_WORLD) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  return size;
+}
+
+std::vector<std::size_t> MessageSizes() {
+  std::vector<std::size_t> sizes;
+  for (std::size_t bytes = 1; bytes <= kMaxBytes; bytes *= 4) {
+    sizes.push_back(bytes);
+  }
+  return sizes;
+}
+
+/// Fewer repetitions for bigger messages, so every size moves about the same amount of data.
+uint64_t Repetitions(std::size_t bytes) {
+  return std::clamp<uint64_t>(kBytesPerSizeBudget / bytes, 3, 1000);
+}
+
+void Report(std::string_view scope, std::string_view benchmark, std::size_t bytes, int processes, double seconds) {
+  ppc::performance::PrintBenchResult(kSuite, scope, std::string(benchmark) + "_" + std::to_string(bytes), processes,
+                                     seconds);
+}
+
+/// Partner of rank 0 for the point-to-point benchmarks.
+struct Pair {
+  std::string_view scope;
+  int partner = -1;
+};
+
+/// Finds one partner of rank 0 on the same node and one on another node; -1 where there is none.
+std::array<Pair, 2> FindPairs() {
+  MPI_Comm node = MPI_COMM_NULL;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, Rank(), MPI_INFO_NULL, &node);
+  // The node ranks follow the world ranks, so rank 0's node is the one whose first rank is 0
+  int first_rank = Rank();
+  MPI_Bcast(&first_rank, 1, MPI_INT, 0, node);
+  const bool on_zero_node = first_rank == 0;
+  MPI_Comm_free(&node);
+
+  std::array<int, 2> candidates = {Size(), Size()};
+  if (Rank() != 0) {
+    candidates[on_zero_node ? 0 : 1] = Rank();
+  }
+  MPI_Allreduce(MPI_IN_PLACE, candidates.data(), 2, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  return {Pair{.scope = "intra_node", .partner = candidates[0] < Size() ? candidates[0] : -1},
+          Pair{.scope = "inter_node", .partner = candidates[1] < Size() ? candidates[1] : -1}};
+}
+
+/// Runs @p exchange(peer) on rank 0 and on @p partner and reports the average time measured on rank 0.
+template <typename Exchange>
+void MeasurePair(const Pair &pair, std::string_view benchmark, std::size_t bytes, double divisor,
+                 const Exchange &exchange) {
+  const int rank = Rank();
+  double sec = 0.0;
+  if (rank == 0) {
+    sec = ppc::performance::MeasureAverage(Repetitions(bytes), [&] { exchange(pair.partner, true); });
+    Report(pair.scope, benchmark, bytes, 2, sec / divisor);
+  } else if (rank == pair.partner) {
+    (void)ppc::performance::MeasureAverage(Repetitions(bytes), [&] { exchange(0, false); });
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+}  // namespace
+
+TEST(MpiBench, PingPong) {
+  std::vector<char> buffer(kMaxBytes);
+  for (const auto &pair : FindPairs()) {
+    if (pair.partner < 0) {
+      continue;
+    }
+    for (std::size_t bytes : MessageSizes()) {
+      const int count = static_cast<int>(bytes);
+      MeasurePair(pair, "pingpong", bytes, 2.0, [&](int peer, bool initiator) {
+        if (initiator) {
+          MPI_Send(buffer.data(), count, MPI_BYTE, peer, kPingTag, MPI_COMM_WORLD);
+          MPI_Recv(buffer.data(), count, MPI_BYTE, peer, kPongTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        } else {
+          MPI_Recv(buffer.data(), count, MPI_BYTE, peer, kPingTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+          MPI_Send(buffer.data(), count, MPI_BYTE, peer, kPongTag, MPI_COMM_WORLD);
+        }
+      });
+    }
+  }
+}
+
+TEST(MpiBench, BidirectionalBandwidth) {
+  std::vector<char> send(kMaxBytes);
+  std::vector<char> recv(kMaxBytes);
+  for (const auto &pair : FindPairs()) {
+    if (pair.partner < 0) {
+      continue;
+    }
+    for (std::size_t bytes : MessageSizes()) {
+      const int count = static_cast<int>(bytes);
+      MeasurePair(pair, "bibw", bytes, 1.0, [&](int peer, bool /*initiator*/) {
+        std::array<MPI_Request, 2> requests{};
+        MPI_Irecv(recv.data(), count, MPI_BYTE, peer, kPingTag, MPI_COMM_WORLD, requests.data());
+        MPI_Isend(send.data(), count, MPI_BYTE, peer, kPingTag, MPI_COMM_WORLD, &requests[1]);
+        MPI_Waitall(2, requests.data(), MPI_STATUSES_IGNORE);
+      });
+    }
+  }
+}
+
+TEST(MpiBench, Bcast) {
+  std::vector<char> buffer(kMaxBytes);
+  for (std::size_t bytes : MessageSizes()) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double sec = ppc::performance::MeasureAverage(
+        Repetitions(bytes), [&] { MPI_Bcast(buffer.data(), static_cast<int>(bytes), MPI_BYTE, 0, MPI_COMM_WORLD); });
+    double max_sec = 0.0;
+    MPI_Reduce(&sec, &max_sec, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (Rank() == 0) {
+      Report("world", "bcast", bytes, Size(), max_sec);
+    }
+  }
+}
+
+TEST(MpiBench, Allreduce) {
+  std::vector<unsigned char> send(kMaxBytes, 1);
+  std::vector<unsigned char> recv(kMaxBytes);
+  for (std::size_t bytes : MessageSizes()) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double sec = ppc::performance::MeasureAverage(Repetitions(bytes), [&] {
+      MPI_Allreduce(send.data(), recv.data(), static_cast<int>(bytes), MPI_UNSIGNED_CHAR, MPI_SUM, MPI_COMM_WORLD);
+    });
+    double max_sec = 0.0;
+    MPI_Reduce(&sec, &max_sec, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (Rank() == 0) {
+      Report("world", "allreduce", bytes, Size(), max_sec);
+    }
+  }
+}
+
+TEST(MpiBench, Alltoall) {
+  const auto size = static_cast<std::size_t>(Size());
+  for (std::size_t bytes : MessageSizes()) {
+    if (bytes * size > kAlltoallBytesLimit) {
+      break;
+    }
+    std::vector<char> send(bytes * size);
+    std::vector<char> recv(bytes * size);
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double sec = ppc::performance::MeasureAverage(Repetitions(bytes * size), [&] {
+      MPI_Alltoall(send.data(), static_cast<int>(bytes), MPI_BYTE, recv.data(), static_cast<int>(bytes), MPI_BYTE,
+                   MPI_COMM_WORLD);
+    });
+    double max_sec = 0.0;
+    MPI_Reduce(&sec, &max_sec, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (Rank() == 0) {
+      Report("world", "alltoall", bytes, Size(), max_sec);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  return ppc::runners::Init(argc, argv);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace ppc::performance {
+
+/// @brief Returns the thread counts swept by microbenchmarks.
+/// @details Powers of two below @p max_threads followed by @p max_threads itself, e.g. 1, 2, 4, 6 for 6.
+inline std::vector<int> GetBenchThreadCounts(int max_threads) {
+  std::vector<int> counts;
+  for (int n = 1; n < max_threads; n *= 2) {
+    counts.push_back(n);
+  }
+  counts.push_back(max_threads > 0 ? max_threads : 1);
+  return counts;
+}
+
+/// @brief Keeps an otherwise empty benchmark body from being optimized away.
+inline void BenchCompilerBarrier() {
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+/// @brief Measures the average wall time of one call of @p fn.
+/// @details One warm-up call is made first so that thread creation of lazily started runtimes is not measured.
+/// @param repetitions Number of measured calls.
+/// @return Average time of one call in seconds.
+template <typename Fn>
+double MeasureAverage(uint64_t repetitions, const Fn &fn) {
+  fn();
+  const auto begin = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < repetitions; i++) {
+    fn();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+  return elapsed.count() / static_cast<double>(repetitions);
+}
+
+/// @brief Prints one microbenchmark result line in the `<id>:<type>:<value>` format of the perf tests.
+/// @details Format: `<suite>/<backend>/<operation>/<threads>:bench:<seconds per operation>`.
+///          scripts/create_perf_table.py collects the `bench` lines into bench_results.csv, apart from the task
+///          performance tables.
+inline void PrintBenchResult(std::string_view suite, std::string_view backend, std::string_view operation,
+                             int threads, double seconds) {
+  std::ostringstream os;
+  os << suite << '/' << backend << '/' << operation << '/' << threads << ":bench:" << std::fixed
+     << std::setprecision(12) << seconds;
+  std::cout << os.str() << '\n';
+}
+
+}  // namespace ppc::performance
@@ -25,11 +25,23 @@ struct PerfAttr {
   /// @cond
   std::function<double()> current_timer = DefaultTimer;
   /// @endcond
+  /// @brief Number of work items processed by one run (e.g. batch size); throughput is reported if non-zero.
+  uint64_t items_per_run = 0;
+  /// @brief Name of the reported throughput, e.g. "gflops" with items_per_run set to the flops of one run.
+  std::string throughput_name = "items_per_sec";
+  /// @brief Factor from items per second to the reported unit, e.g. 1e-9 for GFLOP/s or GB/s.
+  double throughput_scale = 1.0;
 };
 
 struct PerfResults {
   /// @brief Measured execution time in seconds.
   double time_sec = 0.0;
+  /// @brief Processed work items per second, 0 if PerfAttr::items_per_run was not set.
+  double items_per_sec = 0.0;
+  /// @brief items_per_sec in the unit of PerfAttr::throughput_name.
+  double throughput = 0.0;
+  /// @brief Copy of PerfAttr::throughput_name.
+  std::string throughput_name = "items_per_sec";
   enum class TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone };
   TypeOfRunning type_of_running = TypeOfRunning::kNone;
   constexpr static double kMaxTime = 10.0;
@@ -87,6 +99,10 @@ class Perf {
     if (time_secs < max_time) {
       perf_res_str << std::fixed << std::setprecision(10) << time_secs;
       std::cout << test_id << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+      if (perf_results_.items_per_sec > 0.0) {
+        std::cout << test_id << ":" << type_test_name << ":" << perf_results_.throughput_name << ":" << std::fixed
+                  << std::setprecision(4) << perf_results_.throughput << '\n';
+      }
     } else {
       std::stringstream err_msg;
       err_msg << '\n' << "Task execute time need to be: ";
@@ -113,6 +129,11 @@ class Perf {
     }
     auto end = perf_attr.current_timer();
     perf_results.time_sec = (end - begin) / static_cast<double>(perf_attr.num_running);
+    if (perf_attr.items_per_run > 0 && perf_results.time_sec > 0.0) {
+      perf_results.items_per_sec = static_cast<double>(perf_attr.items_per_run) / perf_results.time_sec;
+      perf_results.throughput = perf_results.items_per_sec * perf_attr.throughput_scale;
+      perf_results.throughput_name = perf_attr.throughput_name;
+    }
   }
 };
 
@@ -8,10 +8,12 @@
 #include <memory>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <thread>
 #include <vector>
 
+#include "performance/include/microbench.hpp"
 #include "performance/include/performance.hpp"
 #include "task/include/task.hpp"
 #include "util/include/util.hpp"
@@ -80,6 +82,52 @@ TEST(PerfTests, CheckPerfPipeline) {
   EXPECT_EQ(test_task->GetOutput(), in.size());
 }
 
+TEST(PerfTests, ReportsItemsPerSecond) {
+  std::vector<uint32_t> in(2000, 1);
+  auto test_task = std::make_shared<ppc::test::TestPerfTask<std::vector<uint32_t>, uint32_t>>(in);
+  Perf<std::vector<uint32_t>, uint32_t> perf_analyzer(test_task);
+
+  PerfAttr perf_attr;
+  perf_attr.items_per_run = in.size();
+  double fake_time = 0.0;
+  perf_attr.current_timer = [&] {
+    fake_time += 1.0;
+    return fake_time;
+  };
+  perf_analyzer.TaskRun(perf_attr);
+
+  const auto results = perf_analyzer.GetPerfResults();
+  EXPECT_GT(results.time_sec, 0.0);
+  EXPECT_DOUBLE_EQ(results.items_per_sec, static_cast<double>(in.size()) / results.time_sec);
+  EXPECT_NO_THROW(perf_analyzer.PrintPerfStatistic("reports_items_per_second"));
+}
+
+TEST(PerfTests, ReportsScaledThroughputUnit) {
+  std::vector<uint32_t> in(2000, 1);
+  auto test_task = std::make_shared<ppc::test::TestPerfTask<std::vector<uint32_t>, uint32_t>>(in);
+  Perf<std::vector<uint32_t>, uint32_t> perf_analyzer(test_task);
+
+  PerfAttr perf_attr;
+  perf_attr.items_per_run = 4'000'000'000;
+  perf_attr.throughput_name = "gflops";
+  perf_attr.throughput_scale = 1e-9;
+  double fake_time = 0.0;
+  perf_attr.current_timer = [&] {
+    fake_time += 2.0;
+    return fake_time;
+  };
+  perf_analyzer.PipelineRun(perf_attr);
+
+  const auto results = perf_analyzer.GetPerfResults();
+  EXPECT_EQ(results.throughput_name, "gflops");
+  EXPECT_DOUBLE_EQ(results.throughput, results.items_per_sec * 1e-9);
+  testing::internal::CaptureStdout();
+  perf_analyzer.PrintPerfStatistic("reports_gflops");
+  const std::string output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("reports_gflops:pipeline:gflops:"), std::string::npos);
+  EXPECT_EQ(output.find("items_per_sec"), std::string::npos);
+}
+
 TEST(PerfTests, CheckPerfPipelineFloat) {
   std::vector<float> in(2000, 1);
 
@@ -387,6 +435,13 @@ TEST(PerfTest, GetStringParamNameTest) {
   EXPECT_EQ(GetStringParamName(PerfResults::TypeOfRunning::kNone), "none");
 }
 
+TEST(PerfTest, BenchThreadCountsArePowersOfTwoEndingWithLimit) {
+  EXPECT_EQ(ppc::performance::GetBenchThreadCounts(1), (std::vector<int>{1}));
+  EXPECT_EQ(ppc::performance::GetBenchThreadCounts(8), (std::vector<int>{1, 2, 4, 8}));
+  EXPECT_EQ(ppc::performance::GetBenchThreadCounts(6), (std::vector<int>{1, 2, 4, 6}));
+  EXPECT_EQ(ppc::performance::GetBenchThreadCounts(0), (std::vector<int>{1}));
+}
+
 TEST(TaskTest, DestructorInvalidPipelineOrderTerminatesPartialPipeline) {
   {
     struct BadTask : Task<int, int> {
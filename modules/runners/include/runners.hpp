@@ -36,6 +36,17 @@ class WorkerTestFailurePrinter : public ::testing::EmptyTestEventListener {
   std::shared_ptr<::testing::TestEventListener> base_;
 };
 
+/// @brief GTest environment that makes MPI available to test binaries started with SimpleInit().
+/// @details Initializes MPI (as a singleton process unless launched with mpirun) when nobody did so before and
+///          finalizes it at process exit. Register it from every test file that calls MPI:
+///          `::testing::AddGlobalTestEnvironment(new ppc::runners::MpiEnvironment());`. Tests using it must not
+///          assume a particular number of processes.
+class MpiEnvironment : public ::testing::Environment {
+ public:
+  /// @brief Initializes MPI if it is not initialized yet.
+  void SetUp() override;
+};
+
 /// @brief Initializes the testing environment (e.g., MPI, logging).
 /// @param argc Argument count.
 /// @param argv Argument vector.
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ppc::runners {
+
+/// @brief Factor between the cooperative cancellation deadline and the hard abort of the whole job.
+inline constexpr double kWatchdogAbortFactor = 10.0;
+
+/// @brief Background thread that enforces a deadline on a running task.
+/// @details When @p cancel_after_sec elapses the watchdog calls the cancel callback (typically
+///          CancellationToken::RequestCancel()) and prints a diagnostic report. If the task is still running at
+///          @p abort_after_sec, the report is printed again and the process exits immediately with std::_Exit;
+///          the MPI launcher then terminates the other ranks, so a hung rank cannot block the allocation. The
+///          watchdog thread never calls MPI itself.
+///          Destroying the watchdog disarms it.
+class Watchdog {
+ public:
+  /// @brief Returns a one-line description of the watched task (stage, progress, ...).
+  using ReportCallback = std::function<std::string()>;
+
+  /// @brief Starts the watchdog thread.
+  /// @param cancel_after_sec Seconds until cooperative cancellation is requested; non-positive disables it.
+  /// @param abort_after_sec Seconds until the job is aborted; non-positive disables it.
+  /// @param on_cancel Callback invoked once the cancellation deadline passes.
+  /// @param report Callback producing the diagnostic line printed on timeouts.
+  Watchdog(double cancel_after_sec, double abort_after_sec, std::function<void()> on_cancel, ReportCallback report);
+
+  Watchdog(const Watchdog &) = delete;
+  Watchdog &operator=(const Watchdog &) = delete;
+
+  /// @brief Disarms the watchdog and joins its thread.
+  ~Watchdog();
+
+  /// @brief Checks whether the cancellation deadline has passed.
+  [[nodiscard]] bool Tripped() const;
+
+  /// @brief Checks whether watchdogs are disabled with PPC_IGNORE_TEST_TIME_LIMIT.
+  static bool IsDisabled();
+
+ private:
+  void Loop(double cancel_after_sec, double abort_after_sec);
+  void PrintReport(const std::string &event) const;
+
+  std::function<void()> on_cancel_;
+  ReportCallback report_;
+  int rank_ = -1;
+  std::atomic<bool> tripped_{false};
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopped_ = false;
+  std::thread thread_;
+};
+
+}  // namespace ppc::runners
@@ -71,6 +71,27 @@ void WorkerTestFailurePrinter::PrintProcessRank() {
   std::cerr << std::format(" [  PROCESS {}  ] ", rank);
 }
 
+void MpiEnvironment::SetUp() {
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (initialized != 0) {
+    return;
+  }
+  const int init_res = MPI_Init(nullptr, nullptr);
+  if (init_res != MPI_SUCCESS) {
+    throw std::runtime_error(std::format("MPI_Init failed with code {}", init_res));
+  }
+  // Not finalized in TearDown(): with --gtest_repeat the environment is set up again, and MPI cannot be
+  // re-initialized once finalized
+  std::atexit([] {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized == 0) {
+      MPI_Finalize();
+    }
+  });
+}
+
 namespace {
 int RunAllTests() {
   auto status = RUN_ALL_TESTS();
@@ -0,0 +1,109 @@
+#include "runners/include/watchdog.hpp"
+
+#include <mpi.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <libenvpp/detail/get.hpp>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace ppc::runners {
+
+namespace {
+
+bool IsMpiActive() {
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  return initialized != 0 && finalized == 0;
+}
+
+}  // namespace
+
+Watchdog::Watchdog(double cancel_after_sec, double abort_after_sec, std::function<void()> on_cancel,
+                   ReportCallback report)
+    : on_cancel_(std::move(on_cancel)), report_(std::move(report)) {
+  // The rank is queried here because MPI may only be called from the main thread
+  if (IsMpiActive()) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+  }
+  if (!IsDisabled() && (cancel_after_sec > 0.0 || abort_after_sec > 0.0)) {
+    thread_ = std::thread([this, cancel_after_sec, abort_after_sec]() { Loop(cancel_after_sec, abort_after_sec); });
+  }
+}
+
+Watchdog::~Watchdog() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+bool Watchdog::Tripped() const {
+  return tripped_.load();
+}
+
+bool Watchdog::IsDisabled() {
+  const auto ignore = env::get<int>("PPC_IGNORE_TEST_TIME_LIMIT");
+  return ignore.has_value() && ignore.value() != 0;
+}
+
+void Watchdog::Loop(double cancel_after_sec, double abort_after_sec) {
+  const auto start = std::chrono::steady_clock::now();
+  auto deadline_of = [start](double sec) {
+    return start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(sec));
+  };
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (cancel_after_sec > 0.0) {
+    if (cv_.wait_until(lock, deadline_of(cancel_after_sec), [this]() { return stopped_; })) {
+      return;
+    }
+    tripped_.store(true);
+    lock.unlock();
+    if (on_cancel_) {
+      on_cancel_();
+    }
+    PrintReport("deadline of " + std::to_string(cancel_after_sec) + " s exceeded, cancellation requested");
+    lock.lock();
+  }
+  if (abort_after_sec <= 0.0) {
+    return;
+  }
+  if (cv_.wait_until(lock, deadline_of(abort_after_sec), [this]() { return stopped_; })) {
+    return;
+  }
+  lock.unlock();
+  PrintReport("task did not stop within " + std::to_string(abort_after_sec) + " s, aborting");
+  // MPI_Abort is not an option here: MPI is initialized thread-single, so only the main thread may call it, and
+  // that thread is the one that hangs. A rank that exits without MPI_Finalize makes the launcher terminate the
+  // whole job, including ranks blocked in collectives waiting for this one.
+  std::fflush(nullptr);
+  std::_Exit(EXIT_FAILURE);
+}
+
+void Watchdog::PrintReport(const std::string &event) const {
+  std::ostringstream os;
+  os << "[  WATCHDOG  ] ";
+  if (rank_ >= 0) {
+    os << "[  PROCESS " << rank_ << "  ] ";
+  }
+  os << event;
+  if (report_) {
+    os << ": " << report_();
+  }
+  std::cerr << os.str() << '\n' << std::flush;
+}
+
+}  // namespace ppc::runners
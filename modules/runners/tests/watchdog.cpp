@@ -0,0 +1,88 @@
+#include "runners/include/watchdog.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "task/include/task.hpp"
+
+namespace {
+
+class SpinningTask : public ppc::task::Task<int, int> {
+ public:
+  explicit SpinningTask(int in) {
+    this->GetInput() = in;
+  }
+
+ private:
+  bool ValidationImpl() override {
+    return true;
+  }
+  bool PreProcessingImpl() override {
+    return true;
+  }
+  bool RunImpl() override {
+    // Loops "forever" unless cancelled; the iteration limit only guards the test against hanging
+    for (int i = 0; i < this->GetInput(); i++) {
+      if (IsCancelled()) {
+        return false;
+      }
+      ReportProgress(static_cast<double>(i) / this->GetInput());
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    this->GetOutput() = this->GetInput();
+    return true;
+  }
+  bool PostProcessingImpl() override {
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST(WatchdogTests, CancelsRunawayTask) {
+  auto task = std::make_shared<SpinningTask>(100000);
+  task->GetStateOfTesting() = ppc::task::StateOfTesting::kPerf;
+  std::atomic<bool> reported{false};
+  ppc::runners::Watchdog watchdog(
+      0.05, 0.0, [task]() { task->GetCancellationToken().RequestCancel(); },
+      [task, &reported]() {
+    reported.store(true);
+    return ppc::task::DescribeTask(*task);
+  });
+  EXPECT_TRUE(task->Validation());
+  EXPECT_TRUE(task->PreProcessing());
+  EXPECT_FALSE(task->Run());
+  EXPECT_TRUE(task->PostProcessing());
+  EXPECT_TRUE(watchdog.Tripped());
+  EXPECT_TRUE(reported.load());
+  EXPECT_EQ(task->GetOutput(), 0);
+}
+
+TEST(WatchdogTests, DoesNotTripBeforeDeadline) {
+  auto task = std::make_shared<SpinningTask>(5);
+  {
+    ppc::runners::Watchdog watchdog(
+        60.0, 0.0, [task]() { task->GetCancellationToken().RequestCancel(); }, []() { return std::string{}; });
+    EXPECT_TRUE(ppc::task::RunPipeline(*task));
+    EXPECT_FALSE(watchdog.Tripped());
+  }
+  EXPECT_FALSE(task->GetCancellationToken().IsCancelled());
+  EXPECT_EQ(task->GetOutput(), 5);
+}
+
+TEST(WatchdogTests, ResetClearsCancellation) {
+  auto task = std::make_shared<SpinningTask>(3);
+  task->GetCancellationToken().RequestCancel();
+  EXPECT_FALSE(ppc::task::RunPipeline(*task));
+  EXPECT_EQ(task->GetStageName(), "done");
+  task->Reset(3);
+  EXPECT_EQ(task->GetStageName(), "none");
+  EXPECT_FALSE(task->GetCancellationToken().IsCancelled());
+  EXPECT_TRUE(ppc::task::RunPipeline(*task));
+  EXPECT_DOUBLE_EQ(task->GetProgress(), 2.0 / 3.0);
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "task/include/task.hpp"
+
+namespace ppc::task {
+
+/// @brief Single worker thread executing submitted jobs in FIFO order.
+class SerialLane {
+ public:
+  SerialLane() : worker_([this]() { Loop(); }) {}
+
+  SerialLane(const SerialLane &) = delete;
+  SerialLane &operator=(const SerialLane &) = delete;
+
+  /// @brief Finishes every queued job and joins the worker thread.
+  ~SerialLane() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+  }
+
+  /// @brief Queues a job for execution after all previously posted jobs.
+  void Post(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(std::move(job));
+    }
+    cv_.notify_all();
+  }
+
+  /// @brief Blocks until the queue is empty and no job is running.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return jobs_.empty() && !busy_; });
+  }
+
+ private:
+  void Loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty()) {
+        return;
+      }
+      auto job = std::move(jobs_.front());
+      jobs_.pop_front();
+      busy_ = true;
+      lock.unlock();
+      job();
+      lock.lock();
+      busy_ = false;
+      cv_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> jobs_;
+  bool busy_ = false;
+  bool stopping_ = false;
+  std::thread worker_;
+};
+
+/// @brief Shared executor that overlaps the input stages of one task with the compute stages of another.
+/// @details Validation and PreProcessing of a submitted task run on the load lane, Run and PostProcessing on the
+///          compute lane. Both lanes keep submission order, so PreProcessing of task N+1 (input loading) executes
+///          while task N is in Run. Tasks of any input/output type can share one executor. The time a task waits
+///          for the compute lane does not count towards its kFunc time limit.
+/// @note The overlap applies to thread backends only. kMPI and kALL tasks are rejected: their stages would make
+///       MPI calls from two threads at once, while the runners initialize MPI for the main thread only.
+class PipelineExecutor {
+ public:
+  /// @brief Schedules the full pipeline of @p task.
+  /// @param task Task to execute; it is kept alive until its pipeline finishes.
+  /// @return Future holding the combined result of all stages or the first exception thrown by a stage.
+  /// @throws std::invalid_argument If @p task is a kMPI or kALL task.
+  template <typename InType, typename OutType>
+  std::future<bool> Submit(TaskPtr<InType, OutType> task) {
+    if (task->GetDynamicTypeOfTask() == TypeOfTask::kMPI || task->GetDynamicTypeOfTask() == TypeOfTask::kALL) {
+      throw std::invalid_argument("PipelineExecutor: MPI tasks must run their pipeline on the main thread");
+    }
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto result = promise->get_future();
+    load_lane_.Post([this, task = std::move(task), promise]() mutable {
+      bool loaded = false;
+      try {
+        loaded = task->Validation();
+        loaded = task->PreProcessing() && loaded;
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+        return;
+      }
+      const auto queued = std::chrono::steady_clock::now();
+      compute_lane_.Post([task = std::move(task), promise, loaded, queued]() {
+        try {
+          task->ExcludeFromTimeLimit(std::chrono::steady_clock::now() - queued);
+          bool ok = task->Run() && loaded;
+          ok = task->PostProcessing() && ok;
+          promise->set_value(ok);
+        } catch (...) {
+          promise->set_exception(std::current_exception());
+        }
+      });
+    });
+    return result;
+  }
+
+  /// @brief Blocks until every submitted task has finished.
+  void WaitAll() {
+    load_lane_.Wait();
+    compute_lane_.Wait();
+  }
+
+ private:
+  // Declaration order matters: the compute lane must outlive the load lane that posts into it
+  SerialLane compute_lane_;
+  SerialLane load_lane_;
+};
+
+/// @brief Runs the whole pipeline of a task on a background thread.
+/// @note Intended for thread backends: the runners initialize MPI for the main thread only.
+/// @param task Task to execute.
+/// @return Future holding the result of RunPipeline().
+template <typename InType, typename OutType>
+std::future<bool> RunAsync(TaskPtr<InType, OutType> task) {
+  return std::async(std::launch::async, [task = std::move(task)]() { return RunPipeline(*task); });
+}
+
+/// @brief Schedules a task on a shared PipelineExecutor.
+/// @param task Task to execute.
+/// @param executor Executor whose lanes are shared with other tasks.
+/// @return Future holding the combined result of all stages.
+template <typename InType, typename OutType>
+std::future<bool> RunAsync(TaskPtr<InType, OutType> task, PipelineExecutor &executor) {
+  return executor.Submit(std::move(task));
+}
+
+}  // namespace ppc::task
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <omp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/task_arena.h"
+#include "task/include/task.hpp"
+#include "thread_pool/include/thread_pool.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::task {
+
+template <typename TaskType, typename InType, typename OutType, TypeOfTask kBackend>
+/// @brief Runs an element task over a whole batch of small inputs in one pipeline pass.
+/// @details The batch is parallelized across its elements with the backend @p kBackend, while every element
+///          is processed by a reused TaskType instance owned by the worker (see Task::Reset), so per-element
+///          cost is reduced to the element's own work. TaskType should therefore be a sequential
+///          implementation. Only the thread backends are supported: batching does not distribute elements
+///          across MPI ranks.
+/// @tparam TaskType Element task type derived from Task<InType, OutType>.
+/// @tparam InType Element input type.
+/// @tparam OutType Element output type.
+/// @tparam kBackend Technology used to distribute batch elements among threads.
+class BatchTask : public Task<std::span<const InType>, std::vector<OutType>> {
+  static_assert(kBackend == TypeOfTask::kSEQ || kBackend == TypeOfTask::kOMP || kBackend == TypeOfTask::kTBB ||
+                    kBackend == TypeOfTask::kSTL,
+                "BatchTask supports the seq, omp, tbb and stl backends");
+
+ public:
+  static constexpr TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+
+  explicit BatchTask(const std::span<const InType> &in) {
+    this->SetTypeOfTask(GetStaticTypeOfTask());
+    this->GetInput() = in;
+  }
+
+  /// @brief Returns the number of elements in the current batch.
+  [[nodiscard]] std::size_t GetBatchSize() {
+    return this->GetInput().size();
+  }
+
+ protected:
+  bool ValidationImpl() override {
+    return !this->GetInput().empty();
+  }
+
+  bool PreProcessingImpl() override {
+    this->GetOutput().resize(this->GetInput().size());
+    if (workers_.size() != static_cast<std::size_t>(NumWorkers())) {
+      workers_.clear();
+      workers_.resize(static_cast<std::size_t>(NumWorkers()));
+    }
+    errors_.assign(workers_.size(), nullptr);
+    return true;
+  }
+
+  bool RunImpl() override {
+    failed_.store(false);
+    const auto count = static_cast<int64_t>(this->GetInput().size());
+    [[maybe_unused]] const int num_workers = NumWorkers();
+    if constexpr (kBackend == TypeOfTask::kOMP) {
+#pragma omp parallel for schedule(dynamic) num_threads(num_workers) default(none) shared(count)
+      for (int64_t i = 0; i < count; i++) {
+        ProcessElement(static_cast<std::size_t>(omp_get_thread_num()), static_cast<std::size_t>(i));
+      }
+    } else if constexpr (kBackend == TypeOfTask::kTBB) {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, count), [&](const tbb::blocked_range<int64_t> &r) {
+        const auto slot = static_cast<std::size_t>(tbb::this_task_arena::current_thread_index());
+        for (int64_t i = r.begin(); i < r.end(); i++) {
+          ProcessElement(slot, static_cast<std::size_t>(i));
+        }
+      });
+    } else if constexpr (kBackend == TypeOfTask::kSTL) {
+      // One range per worker slot, so a slot's task is never used by two pool threads at once
+      ppc::thread_pool::ThreadPool::Instance().ParallelFor(
+          0, num_workers,
+          [this, num_workers, count](int64_t worker) {
+        for (int64_t i = worker; i < count; i += num_workers) {
+          ProcessElement(static_cast<std::size_t>(worker), static_cast<std::size_t>(i));
+        }
+      },
+          1);
+    } else {
+      for (int64_t i = 0; i < count; i++) {
+        ProcessElement(0, static_cast<std::size_t>(i));
+      }
+    }
+    for (const auto &error : errors_) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+    return !failed_.load();
+  }
+
+  bool PostProcessingImpl() override {
+    return this->GetOutput().size() == this->GetInput().size();
+  }
+
+ private:
+  static int NumWorkers() {
+    if (kBackend == TypeOfTask::kTBB) {
+      // One slot per arena thread: current_thread_index() is below max_concurrency()
+      return tbb::this_task_arena::max_concurrency();
+    }
+    if (kBackend == TypeOfTask::kSTL) {
+      return ppc::thread_pool::ThreadPool::Instance().GetNumThreads();
+    }
+    if (kBackend == TypeOfTask::kOMP) {
+      return std::max(1, ppc::util::GetNumThreads());
+    }
+    return 1;
+  }
+
+  void ProcessElement(std::size_t slot, std::size_t index) {
+    if (errors_[slot]) {
+      return;
+    }
+    try {
+      const InType &in = this->GetInput()[index];
+      auto &worker = workers_[slot];
+      if (!worker) {
+        worker = std::make_unique<TaskType>(in);
+        // The batch measures its own time limit; element tasks must not check it per element
+        worker->GetStateOfTesting() = StateOfTesting::kPerf;
+      } else {
+        worker->Reset(in);
+      }
+      if (!RunPipeline(*worker)) {
+        failed_.store(true);
+      }
+      this->GetOutput()[index] = std::move(worker->GetOutput());
+    } catch (...) {
+      errors_[slot] = std::current_exception();
+      // The task is left in the exception stage and cannot be reset; the next run builds a new one
+      workers_[slot].reset();
+    }
+  }
+
+  std::vector<std::unique_ptr<TaskType>> workers_;
+  std::vector<std::exception_ptr> errors_;
+  std::atomic<bool> failed_{false};
+};
+
+}  // namespace ppc::task
@@ -3,6 +3,7 @@
 #include <omp.h>
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
@@ -98,6 +99,30 @@ inline std::string GetStringTaskType(TypeOfTask type_of_task, const std::string
 
 enum class StateOfTesting : uint8_t { kFunc, kPerf };
 
+/// @brief Flag used to ask a running task to stop early.
+/// @details The flag is set from another thread (e.g. a watchdog) and polled by the task's RunImpl().
+class CancellationToken {
+ public:
+  /// @brief Requests cancellation of the task.
+  void RequestCancel() noexcept {
+    cancelled_.store(true, std::memory_order_relaxed);
+  }
+
+  /// @brief Checks whether cancellation was requested.
+  /// @return True if RequestCancel() was called since the last Reset().
+  [[nodiscard]] bool IsCancelled() const noexcept {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Clears a pending cancellation request.
+  void Reset() noexcept {
+    cancelled_.store(false, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<bool> cancelled_{false};
+};
+
 template <typename InType, typename OutType>
 /// @brief Base abstract class representing a generic task with a defined pipeline.
 /// @tparam InType Input data type.
@@ -107,13 +132,13 @@ class Task {
   /// @brief Validates input data and task attributes before execution.
   /// @return True if validation is successful.
   virtual bool Validation() final {
-    if (stage_ == PipelineStage::kNone || stage_ == PipelineStage::kDone) {
+    if (IsResettable()) {
       stage_ = PipelineStage::kValidation;
     } else {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Validation should be called before preprocessing");
     }
-    return ValidationImpl();
+    return RunStage([this] { return ValidationImpl(); });
   }
 
   /// @brief Performs preprocessing on the input data.
@@ -125,10 +150,12 @@ class Task {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Preprocessing should be called after validation");
     }
-    if (state_of_testing_ == StateOfTesting::kFunc) {
-      InternalTimeTest();
-    }
-    return PreProcessingImpl();
+    return RunStage([this] {
+      if (state_of_testing_ == StateOfTesting::kFunc) {
+        InternalTimeTest();
+      }
+      return PreProcessingImpl();
+    });
   }
 
   /// @brief Executes the main logic of the task.
@@ -140,7 +167,7 @@ class Task {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Run should be called after preprocessing");
     }
-    return RunImpl();
+    return RunStage([this] { return RunImpl(); });
   }
 
   /// @brief Performs postprocessing on the output data.
@@ -152,10 +179,93 @@ class Task {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Postprocessing should be called after run");
     }
-    if (state_of_testing_ == StateOfTesting::kFunc) {
-      InternalTimeTest();
+    return RunStage([this] {
+      if (state_of_testing_ == StateOfTesting::kFunc) {
+        InternalTimeTest();
+      }
+      return PostProcessingImpl();
+    });
+  }
+
+  /// @brief Returns the task to its initial state with a new input so that it can be run again.
+  /// @details The input is copy-assigned and the output is cleared in place, so containers keep their
+  ///          capacity and a reused task does not reallocate its buffers.
+  /// @param input New input data.
+  /// @throws std::runtime_error If the pipeline has been started but not finished.
+  virtual void Reset(const InType &input) final {
+    BeginReset();
+    input_ = input;
+    FinishReset();
+  }
+
+  /// @brief Returns the task to its initial state, taking ownership of a new input.
+  /// @param input New input data.
+  /// @throws std::runtime_error If the pipeline has been started but not finished.
+  virtual void Reset(InType &&input) final {
+    BeginReset();
+    input_ = std::move(input);
+    FinishReset();
+  }
+
+  /// @brief Checks whether Reset() can be called in the current pipeline stage.
+  /// @return True if the task has not been started, was skipped or has completed the whole pipeline.
+  [[nodiscard]] bool IsResettable() const {
+    return stage_ == PipelineStage::kNone || stage_ == PipelineStage::kSkipped || stage_ == PipelineStage::kDone;
+  }
+
+  /// @brief Marks a task that will not be run, e.g. because a task it depends on failed.
+  /// @details A skipped task can be destroyed without a pipeline error, or Reset() and run later.
+  /// @throws std::runtime_error If the pipeline has been started but not finished.
+  void Skip() {
+    if (!IsResettable()) {
+      stage_ = PipelineStage::kException;
+      throw std::runtime_error("Skip should be called before validation or after postprocessing");
     }
-    return PostProcessingImpl();
+    stage_ = PipelineStage::kSkipped;
+  }
+
+  /// @brief Excludes @p waited from the kFunc time limit, e.g. the time the task spent queued between two stages.
+  void ExcludeFromTimeLimit(std::chrono::nanoseconds waited) {
+    tmp_time_point_ += std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(waited);
+  }
+
+  /// @brief Checks whether the task has completed the whole pipeline.
+  [[nodiscard]] bool IsDone() const {
+    return stage_ == PipelineStage::kDone;
+  }
+
+  /// @brief Returns the token that can be used to cancel the task from another thread.
+  /// @return Reference to the task's cancellation token.
+  CancellationToken &GetCancellationToken() {
+    return cancellation_token_;
+  }
+
+  /// @brief Returns the name of the current pipeline stage; safe to call from another thread.
+  /// @return One of "none", "validation", "preprocessing", "run", "done", "skipped" or "exception".
+  [[nodiscard]] std::string GetStageName() const {
+    switch (stage_.load()) {
+      case PipelineStage::kNone:
+        return "none";
+      case PipelineStage::kValidation:
+        return "validation";
+      case PipelineStage::kPreProcessing:
+        return "preprocessing";
+      case PipelineStage::kRun:
+        return "run";
+      case PipelineStage::kDone:
+        return "done";
+      case PipelineStage::kSkipped:
+        return "skipped";
+      case PipelineStage::kException:
+        return "exception";
+    }
+    return "unknown";
+  }
+
+  /// @brief Returns the progress of the current run as reported by the task; safe to call from another thread.
+  /// @return Fraction of work done in [0, 1].
+  [[nodiscard]] double GetProgress() const {
+    return progress_.load(std::memory_order_relaxed);
   }
 
   /// @brief Returns the current testing mode.
@@ -203,7 +313,7 @@ class Task {
   /// @brief Destructor. Verifies that the pipeline was executed in the correct order.
   /// @note Terminates the program if the pipeline order is incorrect or incomplete.
   virtual ~Task() {
-    if (stage_ != PipelineStage::kDone && stage_ != PipelineStage::kException) {
+    if (stage_ != PipelineStage::kDone && stage_ != PipelineStage::kSkipped && stage_ != PipelineStage::kException) {
       ppc::util::DestructorFailureFlag::Set();
     }
 #if _OPENMP >= 201811
@@ -238,6 +348,22 @@ class Task {
     }
   }
 
+  /// @brief Checks whether cancellation was requested; long-running RunImpl() code should poll it.
+  /// @return True if the task should stop as soon as possible.
+  [[nodiscard]] bool IsCancelled() const {
+    return cancellation_token_.IsCancelled();
+  }
+
+  /// @brief Publishes the progress of RunImpl() for diagnostics (e.g. the watchdog report).
+  /// @param fraction Fraction of work done in [0, 1].
+  void ReportProgress(double fraction) {
+    progress_.store(fraction, std::memory_order_relaxed);
+  }
+
+  /// @brief User-defined hook called by Reset() after the new input is set.
+  /// @details Override it to clear internal buffers without releasing their memory.
+  virtual void ResetImpl() {}
+
   /// @brief User-defined validation logic.
   /// @return True if validation is successful.
   virtual bool ValidationImpl() = 0;
@@ -255,20 +381,47 @@ class Task {
   virtual bool PostProcessingImpl() = 0;
 
  private:
+  /// Runs the body of a pipeline stage; if it throws, the task is left in the exception stage.
+  template <typename Body>
+  bool RunStage(const Body &body) {
+    try {
+      return body();
+    } catch (...) {
+      stage_ = PipelineStage::kException;
+      throw;
+    }
+  }
+
+  void BeginReset() {
+    if (!IsResettable()) {
+      stage_ = PipelineStage::kException;
+      throw std::runtime_error("Reset should be called before validation or after postprocessing");
+    }
+  }
+
+  void FinishReset() {
+    if constexpr (requires(OutType &out) { out.clear(); }) {
+      output_.clear();
+    } else {
+      output_ = OutType{};
+    }
+    cancellation_token_.Reset();
+    progress_.store(0.0, std::memory_order_relaxed);
+    ResetImpl();
+    stage_ = PipelineStage::kNone;
+  }
+
+  enum class PipelineStage : uint8_t { kNone, kValidation, kPreProcessing, kRun, kDone, kSkipped, kException };
+
   InType input_{};
   OutType output_{};
   StateOfTesting state_of_testing_ = StateOfTesting::kFunc;
   TypeOfTask type_of_task_ = TypeOfTask::kUnknown;
   StatusOfTask status_of_task_ = StatusOfTask::kEnabled;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
-  enum class PipelineStage : uint8_t {
-    kNone,
-    kValidation,
-    kPreProcessing,
-    kRun,
-    kDone,
-    kException
-  } stage_ = PipelineStage::kNone;
+  CancellationToken cancellation_token_;
+  std::atomic<double> progress_{0.0};
+  std::atomic<PipelineStage> stage_{PipelineStage::kNone};
 };
 
 /// @brief Smart pointer alias for Task.
@@ -277,6 +430,29 @@ class Task {
 template <typename InType, typename OutType>
 using TaskPtr = std::shared_ptr<Task<InType, OutType>>;
 
+/// @brief Describes the state of a task, e.g. for timeout diagnostics; safe to call while the task runs.
+/// @param task Task to describe.
+/// @return String with the task type, current pipeline stage and reported progress.
+template <typename InType, typename OutType>
+std::string DescribeTask(const Task<InType, OutType> &task) {
+  return "(" + TypeOfTaskToString(task.GetDynamicTypeOfTask()) + ") in stage " + task.GetStageName() +
+         ", progress " + std::to_string(static_cast<int>(task.GetProgress() * 100.0)) + "%";
+}
+
+/// @brief Runs every pipeline stage of a task in order.
+/// @details All four stages are executed even if an earlier one reports failure, the same way the test
+///          harness drives tasks, so the task always finishes in a state that allows Reset().
+/// @param task Task to execute.
+/// @return True if every stage succeeded.
+template <typename InType, typename OutType>
+bool RunPipeline(Task<InType, OutType> &task) {
+  bool ok = task.Validation();
+  ok = task.PreProcessing() && ok;
+  ok = task.Run() && ok;
+  ok = task.PostProcessing() && ok;
+  return ok;
+}
+
 /// @brief Constructs and returns a shared pointer to a task with the given input.
 /// @tparam TaskType Type of the task to create.
 /// @tparam InType Type of the input.
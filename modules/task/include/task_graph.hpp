@@ -0,0 +1,218 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "oneapi/tbb/task_group.h"
+#include "task/include/task.hpp"
+
+namespace ppc::task {
+
+template <typename InType, typename OutType>
+/// @brief Typed reference to a node of a TaskGraph.
+/// @tparam InType Input type of the node's task.
+/// @tparam OutType Output type of the node's task.
+struct TaskNode {
+  std::size_t id = 0;
+};
+
+/// @brief Directed acyclic graph of tasks whose outputs are forwarded to the inputs of the following tasks.
+/// @details A plain edge moves the output of a finished task into the input of its successor. If a task has several
+///          successors the output is copied for all but the last of them. A node fed by a plain edge has no other
+///          inputs; a node with several inputs uses merge edges instead, which fold each producer's output into its
+///          input in the order the edges were added. Ready nodes are executed on the TBB work-stealing scheduler, so
+///          independent branches run concurrently. If a task fails, every task that depends on it is skipped
+///          (Task::Skip()) instead of running on an incomplete input.
+/// @note Only thread backends can be graph nodes. kMPI and kALL tasks are rejected: their pipelines would make MPI
+///       calls from TBB worker threads, and independent nodes could start their collectives in a different order on
+///       each rank.
+class TaskGraph {
+ public:
+  /// @brief Adds a task to the graph.
+  /// @param task Task to execute; its current input is used if the node has no incoming edge.
+  /// @return Typed handle used to connect the node.
+  /// @throws std::invalid_argument If @p task is a kMPI or kALL task.
+  template <typename InType, typename OutType>
+  TaskNode<InType, OutType> AddNode(TaskPtr<InType, OutType> task) {
+    if (task->GetDynamicTypeOfTask() == TypeOfTask::kMPI || task->GetDynamicTypeOfTask() == TypeOfTask::kALL) {
+      throw std::invalid_argument("TaskGraph: MPI tasks must run their pipeline on the main thread");
+    }
+    auto node = std::make_unique<Node>();
+    node->run = [task]() { return RunPipeline(*task); };
+    node->skip_task = [task]() { task->Skip(); };
+    node->task = task;
+    nodes_.push_back(std::move(node));
+    return TaskNode<InType, OutType>{nodes_.size() - 1};
+  }
+
+  /// @brief Adds an edge that feeds the output of @p from into the input of @p to.
+  /// @throws std::invalid_argument If a node is unknown, the edge is a self-loop or @p to already has an input.
+  template <typename InType, typename MidType, typename OutType>
+  void Connect(TaskNode<InType, MidType> from, TaskNode<MidType, OutType> to) {
+    if (from.id >= nodes_.size() || to.id >= nodes_.size() || from.id == to.id) {
+      throw std::invalid_argument("Invalid task graph edge");
+    }
+    Node &target = *nodes_[to.id];
+    if (target.num_predecessors != 0) {
+      throw std::invalid_argument("Task graph node already has an input edge");
+    }
+    target.num_predecessors = 1;
+    target.has_plain_input = true;
+    Node &source = *nodes_[from.id];
+    source.successors.push_back(to.id);
+    source.forwards.emplace_back([&source, &target](bool may_move) {
+      auto &producer = *std::static_pointer_cast<Task<InType, MidType>>(source.task);
+      auto &consumer = *std::static_pointer_cast<Task<MidType, OutType>>(target.task);
+      if (may_move) {
+        consumer.GetInput() = std::move(producer.GetOutput());
+      } else {
+        consumer.GetInput() = producer.GetOutput();
+      }
+    });
+  }
+
+  /// @brief Adds an edge that folds the output of @p from into the input of @p to.
+  /// @details A node may have any number of merge edges. Before the node runs, @p merge is called as
+  ///          `merge(output_of_from, input_of_to)` for each of them, in the order they were added, on top of the
+  ///          input the task was created with.
+  /// @throws std::invalid_argument If a node is unknown, the edge is a self-loop or @p to has a plain input edge.
+  template <typename InType, typename MidType, typename ToInType, typename OutType, typename Merge>
+  void Connect(TaskNode<InType, MidType> from, TaskNode<ToInType, OutType> to, Merge merge) {
+    if (from.id >= nodes_.size() || to.id >= nodes_.size() || from.id == to.id) {
+      throw std::invalid_argument("Invalid task graph edge");
+    }
+    Node &target = *nodes_[to.id];
+    if (target.has_plain_input) {
+      throw std::invalid_argument("Task graph node already has an input edge");
+    }
+    target.num_predecessors++;
+    Node &source = *nodes_[from.id];
+    source.successors.push_back(to.id);
+    source.is_merged = true;
+    target.merges.emplace_back([&source, &target, merge = std::move(merge)]() {
+      auto &producer = *std::static_pointer_cast<Task<InType, MidType>>(source.task);
+      auto &consumer = *std::static_pointer_cast<Task<ToInType, OutType>>(target.task);
+      merge(std::as_const(producer.GetOutput()), consumer.GetInput());
+    });
+  }
+
+  /// @brief Executes every task of the graph once, respecting the edges.
+  /// @return True if every task pipeline succeeded; false if a task failed and its dependents were skipped.
+  /// @throws std::runtime_error If the graph contains a cycle; rethrows the first exception thrown by a task once
+  ///         the rest of the graph has finished or been skipped.
+  bool Run() {
+    CheckAcyclic();
+    ok_.store(true);
+    first_error_ = nullptr;
+    for (auto &node : nodes_) {
+      node->pending.store(node->num_predecessors);
+      node->skip.store(false);
+    }
+    tbb::task_group group;
+    for (std::size_t id = 0; id < nodes_.size(); id++) {
+      if (nodes_[id]->num_predecessors == 0) {
+        group.run([this, &group, id]() { Execute(group, id); });
+      }
+    }
+    group.wait();
+    if (first_error_) {
+      std::rethrow_exception(first_error_);
+    }
+    return ok_.load();
+  }
+
+  /// @brief Returns the number of nodes in the graph.
+  [[nodiscard]] std::size_t Size() const {
+    return nodes_.size();
+  }
+
+ private:
+  struct Node {
+    std::function<bool()> run;
+    std::shared_ptr<void> task;
+    std::vector<std::size_t> successors;
+    std::vector<std::function<void(bool)>> forwards;
+    std::vector<std::function<void()>> merges;
+    std::function<void()> skip_task;
+    std::size_t num_predecessors = 0;
+    bool has_plain_input = false;
+    bool is_merged = false;
+    std::atomic<std::size_t> pending{0};
+    std::atomic<bool> skip{false};
+  };
+
+  void Execute(tbb::task_group &group, std::size_t id) {
+    Node &node = *nodes_[id];
+    bool succeeded = false;
+    if (node.skip.load()) {
+      node.skip_task();
+    } else {
+      try {
+        for (const auto &merge : node.merges) {
+          merge();
+        }
+        succeeded = node.run();
+      } catch (...) {
+        const std::scoped_lock lock(error_mutex_);
+        if (!first_error_) {
+          first_error_ = std::current_exception();
+        }
+      }
+      if (!succeeded) {
+        ok_.store(false);
+      }
+    }
+    if (succeeded) {
+      for (std::size_t i = 0; i < node.forwards.size(); i++) {
+        node.forwards[i](!node.is_merged && i + 1 == node.forwards.size());
+      }
+    }
+    for (std::size_t next : node.successors) {
+      if (!succeeded) {
+        nodes_[next]->skip.store(true);
+      }
+      if (nodes_[next]->pending.fetch_sub(1) == 1) {
+        group.run([this, &group, next]() { Execute(group, next); });
+      }
+    }
+  }
+
+  void CheckAcyclic() const {
+    std::vector<std::size_t> in_degree(nodes_.size());
+    std::vector<std::size_t> ready;
+    for (std::size_t id = 0; id < nodes_.size(); id++) {
+      in_degree[id] = nodes_[id]->num_predecessors;
+      if (in_degree[id] == 0) {
+        ready.push_back(id);
+      }
+    }
+    std::size_t visited = 0;
+    while (!ready.empty()) {
+      const std::size_t id = ready.back();
+      ready.pop_back();
+      visited++;
+      for (std::size_t next : nodes_[id]->successors) {
+        if (--in_degree[next] == 0) {
+          ready.push_back(next);
+        }
+      }
+    }
+    if (visited != nodes_.size()) {
+      throw std::runtime_error("Task graph contains a cycle");
+    }
+  }
+
+  std::vector<std::unique_ptr<Node>> nodes_;
+  std::atomic<bool> ok_{true};
+  std::mutex error_mutex_;
+  std::exception_ptr first_error_;
+};
+
+}  // namespace ppc::task
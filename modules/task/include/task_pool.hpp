@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "task/include/task.hpp"
+
+namespace ppc::task {
+
+template <typename InType, typename OutType>
+/// @brief Thread-safe pool of finished task objects keyed by their concrete type.
+/// @details Acquire() hands out a pooled instance reset to the new input (or creates one through TaskGetter
+///          if the pool is empty), Release() returns a finished task. In a steady state no task object and
+///          no internal buffer is reallocated between requests.
+/// @tparam InType Input data type.
+/// @tparam OutType Output data type.
+class TaskPool {
+ public:
+  /// @brief Returns a task of type @p TaskType ready to be validated with input @p in.
+  /// @tparam TaskType Concrete task type.
+  /// @param in Input to pass to the task.
+  /// @return Shared pointer to a reused or newly created task.
+  template <typename TaskType>
+  std::shared_ptr<TaskType> Acquire(const InType &in) {
+    auto task = Take<TaskType>();
+    if (!task) {
+      return TaskGetter<TaskType, InType>(in);
+    }
+    task->Reset(in);
+    return task;
+  }
+
+  /// @brief Returns a task of type @p TaskType that takes ownership of the input @p in, so large inputs are
+  ///        moved instead of copied into a pooled task.
+  template <typename TaskType>
+  std::shared_ptr<TaskType> Acquire(InType &&in) {
+    auto task = Take<TaskType>();
+    if (!task) {
+      return std::make_shared<TaskType>(std::move(in));
+    }
+    task->Reset(std::move(in));
+    return task;
+  }
+
+  /// @brief Returns a task that has finished its pipeline back to the pool.
+  /// @param task Task to store for reuse.
+  /// @throws std::runtime_error If the task has not completed the pipeline.
+  void Release(TaskPtr<InType, OutType> task) {
+    if (!task) {
+      return;
+    }
+    if (!task->IsDone()) {
+      throw std::runtime_error("Only tasks that completed the pipeline can be returned to the pool");
+    }
+    const auto &task_ref = *task;
+    const std::type_index key(typeid(task_ref));
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_tasks_[key].push_back(std::move(task));
+  }
+
+  /// @brief Returns the number of pooled tasks of type @p TaskType.
+  template <typename TaskType>
+  [[nodiscard]] std::size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = free_tasks_.find(std::type_index(typeid(TaskType)));
+    return it == free_tasks_.end() ? 0 : it->second.size();
+  }
+
+  /// @brief Destroys every pooled task.
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_tasks_.clear();
+  }
+
+ private:
+  /// Removes a pooled task of type TaskType, or returns null if there is none.
+  template <typename TaskType>
+  std::shared_ptr<TaskType> Take() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = free_tasks_.find(std::type_index(typeid(TaskType)));
+    if (it == free_tasks_.end() || it->second.empty()) {
+      return nullptr;
+    }
+    auto task = std::static_pointer_cast<TaskType>(std::move(it->second.back()));
+    it->second.pop_back();
+    return task;
+  }
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::type_index, std::vector<TaskPtr<InType, OutType>>> free_tasks_;
+};
+
+}  // namespace ppc::task
@@ -1,13 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <libenvpp/env.hpp>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <system_error>
@@ -16,7 +19,11 @@
 #include <vector>
 
 #include "runners/include/runners.hpp"
+#include "task/include/async_pipeline.hpp"
+#include "task/include/batch_task.hpp"
 #include "task/include/task.hpp"
+#include "task/include/task_graph.hpp"
+#include "task/include/task_pool.hpp"
 #include "util/include/util.hpp"
 
 using ppc::task::StateOfTesting;
@@ -346,6 +353,525 @@ TEST(TaskTest, PostProcessingThrowsIfCalledBeforeRun) {
   EXPECT_THROW(task->PostProcessing(), std::runtime_error);
 }
 
+TEST(TaskTest, ResetAllowsRerunWithNewInput) {
+  std::vector<int32_t> in(20, 1);
+  ppc::test::TestTask<std::vector<int32_t>, int32_t> test_task(in);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ASSERT_EQ(test_task.GetOutput(), 20);
+
+  test_task.Reset(std::vector<int32_t>(10, 2));
+  EXPECT_EQ(test_task.GetOutput(), 0);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  EXPECT_EQ(test_task.GetOutput(), 20);
+}
+
+TEST(TaskTest, ResetKeepsInputCapacity) {
+  std::vector<int32_t> in(100, 1);
+  ppc::test::TestTask<std::vector<int32_t>, int32_t> test_task(in);
+  test_task.Validation();
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  const auto *old_data = test_task.GetInput().data();
+
+  const std::vector<int32_t> next(50, 1);
+  test_task.Reset(next);
+  EXPECT_EQ(test_task.GetInput().data(), old_data);
+  EXPECT_EQ(test_task.GetInput().size(), 50U);
+  test_task.Validation();
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+}
+
+TEST(TaskTest, ResetClearsContainerOutputInPlace) {
+  struct VectorTask : Task<int, std::vector<int>> {
+    explicit VectorTask(int in) {
+      this->GetInput() = in;
+    }
+    bool ValidationImpl() override {
+      return this->GetOutput().empty();
+    }
+    bool PreProcessingImpl() override {
+      return true;
+    }
+    bool RunImpl() override {
+      this->GetOutput().assign(static_cast<std::size_t>(this->GetInput()), 1);
+      return true;
+    }
+    bool PostProcessingImpl() override {
+      return true;
+    }
+  } task(64);
+  task.Validation();
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  const auto capacity = task.GetOutput().capacity();
+
+  task.Reset(8);
+  EXPECT_TRUE(task.GetOutput().empty());
+  EXPECT_EQ(task.GetOutput().capacity(), capacity);
+  EXPECT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  EXPECT_EQ(task.GetOutput().size(), 8U);
+}
+
+TEST(TaskTest, ResetThrowsInTheMiddleOfPipeline) {
+  auto task = std::make_shared<DummyTask>();
+  task->Validation();
+  EXPECT_FALSE(task->IsResettable());
+  EXPECT_THROW(task->Reset(1), std::runtime_error);
+}
+
+TEST(TaskTest, ThrowingStageLeavesTaskInExceptionStage) {
+  {
+    struct ThrowingTask : Task<int, int> {
+      bool ValidationImpl() override {
+        return true;
+      }
+      bool PreProcessingImpl() override {
+        return true;
+      }
+      bool RunImpl() override {
+        throw std::runtime_error("run failed");
+      }
+      bool PostProcessingImpl() override {
+        return true;
+      }
+    } task;
+    task.Validation();
+    task.PreProcessing();
+    EXPECT_THROW(task.Run(), std::runtime_error);
+    EXPECT_EQ(task.GetStageName(), "exception");
+    EXPECT_FALSE(task.IsResettable());
+  }
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+TEST(TaskTest, TaskPoolReusesReleasedTasks) {
+  ppc::task::TaskPool<std::vector<int32_t>, int32_t> pool;
+  using PoolTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+
+  auto first = pool.Acquire<PoolTask>(std::vector<int32_t>(20, 1));
+  first->Validation();
+  first->PreProcessing();
+  first->Run();
+  first->PostProcessing();
+  const auto *raw = first.get();
+  pool.Release(std::move(first));
+  EXPECT_EQ(pool.Size<PoolTask>(), 1U);
+
+  auto second = pool.Acquire<PoolTask>(std::vector<int32_t>(5, 3));
+  EXPECT_EQ(second.get(), raw);
+  EXPECT_EQ(pool.Size<PoolTask>(), 0U);
+  second->Validation();
+  second->PreProcessing();
+  second->Run();
+  second->PostProcessing();
+  EXPECT_EQ(second->GetOutput(), 15);
+}
+
+TEST(TaskTest, TaskPoolRejectsUnfinishedTasks) {
+  ppc::task::TaskPool<int, int> pool;
+  auto task = std::make_shared<DummyTask>();
+  EXPECT_THROW(pool.Release(task), std::runtime_error);
+  task->Validation();
+  EXPECT_THROW(pool.Release(task), std::runtime_error);
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  EXPECT_EQ(pool.Size<DummyTask>(), 0U);
+}
+
+TEST(TaskTest, TaskPoolMovesRvalueInputs) {
+  ppc::task::TaskPool<std::vector<int32_t>, int32_t> pool;
+  using PoolTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  auto task = pool.Acquire<PoolTask>(std::vector<int32_t>(4, 1));
+  task->Validation();
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  pool.Release(std::move(task));
+
+  std::vector<int32_t> input(1000, 2);
+  const auto *data = input.data();
+  auto reused = pool.Acquire<PoolTask>(std::move(input));
+  EXPECT_EQ(reused->GetInput().data(), data);
+  EXPECT_TRUE(ppc::task::RunPipeline(*reused));
+  EXPECT_EQ(reused->GetOutput(), 2000);
+}
+
+namespace {
+
+template <TypeOfTask kBackend>
+void CheckBatchSums() {
+  using ElementTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  using Batch = ppc::task::BatchTask<ElementTask, std::vector<int32_t>, int32_t, kBackend>;
+
+  std::vector<std::vector<int32_t>> inputs;
+  for (int32_t i = 1; i <= 37; i++) {
+    inputs.emplace_back(static_cast<std::size_t>(i), i);
+  }
+  const std::span<const std::vector<int32_t>> batch_input(inputs);
+  Batch batch(batch_input);
+  EXPECT_EQ(batch.GetDynamicTypeOfTask(), kBackend);
+  ASSERT_TRUE(batch.Validation());
+  ASSERT_TRUE(batch.PreProcessing());
+  ASSERT_TRUE(batch.Run());
+  ASSERT_TRUE(batch.PostProcessing());
+  ASSERT_EQ(batch.GetOutput().size(), inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); i++) {
+    const auto n = static_cast<int32_t>(i + 1);
+    EXPECT_EQ(batch.GetOutput()[i], n * n);
+  }
+
+  // The same batch object processes the next batch with the already created element tasks
+  std::vector<std::vector<int32_t>> next(5, std::vector<int32_t>(3, 1));
+  batch.Reset(std::span<const std::vector<int32_t>>(next));
+  ASSERT_TRUE(batch.Validation());
+  batch.PreProcessing();
+  batch.Run();
+  batch.PostProcessing();
+  EXPECT_EQ(batch.GetOutput(), std::vector<int32_t>(5, 3));
+}
+
+}  // namespace
+
+TEST(BatchTaskTest, ProcessesEveryElementSeq) {
+  CheckBatchSums<TypeOfTask::kSEQ>();
+}
+
+TEST(BatchTaskTest, ProcessesEveryElementOmp) {
+  CheckBatchSums<TypeOfTask::kOMP>();
+}
+
+TEST(BatchTaskTest, ProcessesEveryElementTbb) {
+  CheckBatchSums<TypeOfTask::kTBB>();
+}
+
+TEST(BatchTaskTest, ProcessesEveryElementStl) {
+  CheckBatchSums<TypeOfTask::kSTL>();
+}
+
+TEST(BatchTaskTest, FailsIfAnyElementIsInvalid) {
+  using ElementTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  std::vector<std::vector<int32_t>> inputs = {{1, 2}, {}, {3}};
+  const std::span<const std::vector<int32_t>> batch_input(inputs);
+  ppc::task::BatchTask<ElementTask, std::vector<int32_t>, int32_t, TypeOfTask::kSEQ> batch(batch_input);
+  ASSERT_TRUE(batch.Validation());
+  batch.PreProcessing();
+  EXPECT_FALSE(batch.Run());
+  batch.PostProcessing();
+}
+
+namespace {
+
+class ThrowingElementTask : public ppc::test::TestTask<std::vector<int32_t>, int32_t> {
+ public:
+  explicit ThrowingElementTask(const std::vector<int32_t> &in) : TestTask(in) {}
+
+  bool RunImpl() override {
+    if (GetInput().front() < 0) {
+      throw std::runtime_error("negative element");
+    }
+    return TestTask::RunImpl();
+  }
+};
+
+}  // namespace
+
+TEST(BatchTaskTest, ThrowingElementLeavesBatchInExceptionStage) {
+  std::vector<std::vector<int32_t>> inputs = {{1}, {-1}, {2}};
+  {
+    ppc::task::BatchTask<ThrowingElementTask, std::vector<int32_t>, int32_t, TypeOfTask::kSEQ> batch(
+        std::span<const std::vector<int32_t>>{inputs});
+    ASSERT_TRUE(batch.Validation());
+    ASSERT_TRUE(batch.PreProcessing());
+    EXPECT_THROW(batch.Run(), std::runtime_error);
+    EXPECT_EQ(batch.GetStageName(), "exception");
+    EXPECT_FALSE(batch.IsResettable());
+  }
+  // Neither the batch nor its failed worker is destroyed in the middle of a pipeline
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+TEST(AsyncTaskTest, RunAsyncReturnsPipelineResult) {
+  ppc::task::TaskPtr<std::vector<int32_t>, int32_t> task =
+      std::make_shared<ppc::test::TestTask<std::vector<int32_t>, int32_t>>(std::vector<int32_t>(10, 2));
+  auto result = ppc::task::RunAsync(task);
+  EXPECT_TRUE(result.get());
+  EXPECT_EQ(task->GetOutput(), 20);
+}
+
+TEST(AsyncTaskTest, RunAsyncReportsInvalidInput) {
+  ppc::task::TaskPtr<std::vector<int32_t>, int32_t> task =
+      std::make_shared<ppc::test::TestTask<std::vector<int32_t>, int32_t>>(std::vector<int32_t>{});
+  EXPECT_FALSE(ppc::task::RunAsync(task).get());
+}
+
+namespace {
+
+struct OverlapState {
+  std::atomic<bool> second_preprocessed{false};
+  std::atomic<bool> overlapped{false};
+};
+
+class OverlapTask : public Task<int, int> {
+ public:
+  OverlapTask(int id, OverlapState &state) : id_(id), state_(state) {
+    this->GetInput() = id;
+  }
+
+ private:
+  bool ValidationImpl() override {
+    return true;
+  }
+  bool PreProcessingImpl() override {
+    if (id_ == 1) {
+      state_.second_preprocessed.store(true);
+    }
+    return true;
+  }
+  bool RunImpl() override {
+    if (id_ == 0) {
+      // The first task keeps running until the second one has loaded its input
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+      while (!state_.second_preprocessed.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+      }
+      state_.overlapped.store(state_.second_preprocessed.load());
+    }
+    this->GetOutput() = this->GetInput() + 1;
+    return true;
+  }
+  bool PostProcessingImpl() override {
+    return true;
+  }
+
+  int id_;
+  OverlapState &state_;
+};
+
+}  // namespace
+
+TEST(AsyncTaskTest, PipelineExecutorOverlapsPreProcessingWithRun) {
+  OverlapState state;
+  ppc::task::PipelineExecutor executor;
+  ppc::task::TaskPtr<int, int> first = std::make_shared<OverlapTask>(0, state);
+  ppc::task::TaskPtr<int, int> second = std::make_shared<OverlapTask>(1, state);
+  auto first_result = ppc::task::RunAsync(first, executor);
+  auto second_result = ppc::task::RunAsync(second, executor);
+  EXPECT_TRUE(first_result.get());
+  EXPECT_TRUE(second_result.get());
+  executor.WaitAll();
+  EXPECT_TRUE(state.overlapped.load());
+  EXPECT_EQ(first->GetOutput(), 1);
+  EXPECT_EQ(second->GetOutput(), 2);
+}
+
+TEST(AsyncTaskTest, PipelineExecutorPropagatesStageExceptions) {
+  ppc::task::PipelineExecutor executor;
+  auto task = std::make_shared<DummyTask>();
+  task->Validation();
+  // Validation was already called, so the executor hits a pipeline order error
+  auto result = executor.Submit(ppc::task::TaskPtr<int, int>(task));
+  EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(AsyncTaskTest, PipelineExecutorRejectsMpiTasks) {
+  ppc::task::PipelineExecutor executor;
+  for (const auto type : {TypeOfTask::kMPI, TypeOfTask::kALL}) {
+    auto task = std::make_shared<DummyTask>();
+    task->SetTypeOfTask(type);
+    EXPECT_THROW((void)executor.Submit(ppc::task::TaskPtr<int, int>(task)), std::invalid_argument);
+    EXPECT_TRUE(ppc::task::RunPipeline(*task));
+  }
+}
+
+namespace {
+
+class SleepTask : public DummyTask {
+ public:
+  bool RunImpl() override {
+    std::this_thread::sleep_for(std::chrono::duration<double>(0.6 * ppc::util::GetTaskMaxTime()));
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST(AsyncTaskTest, PipelineExecutorDoesNotCountQueueingTowardsTimeLimit) {
+  ppc::task::PipelineExecutor executor;
+  // The second task is preprocessed right away but waits for the first one's Run; only its own stages count
+  auto first = executor.Submit(ppc::task::TaskPtr<int, int>(std::make_shared<SleepTask>()));
+  auto second = executor.Submit(ppc::task::TaskPtr<int, int>(std::make_shared<SleepTask>()));
+  EXPECT_TRUE(first.get());
+  EXPECT_NO_THROW(EXPECT_TRUE(second.get()));
+}
+
+namespace {
+
+class FillTask : public Task<int, std::vector<int>> {
+ public:
+  explicit FillTask(int in) {
+    this->GetInput() = in;
+  }
+
+ private:
+  bool ValidationImpl() override {
+    return this->GetInput() > 0;
+  }
+  bool PreProcessingImpl() override {
+    return true;
+  }
+  bool RunImpl() override {
+    this->GetOutput().assign(static_cast<std::size_t>(this->GetInput()), 1);
+    return true;
+  }
+  bool PostProcessingImpl() override {
+    return true;
+  }
+};
+
+class ScaleTask : public Task<std::vector<int>, std::vector<int>> {
+ public:
+  explicit ScaleTask(int factor) : factor_(factor) {}
+  const int *input_data_at_run = nullptr;
+
+ private:
+  bool ValidationImpl() override {
+    return !this->GetInput().empty();
+  }
+  bool PreProcessingImpl() override {
+    return true;
+  }
+  bool RunImpl() override {
+    input_data_at_run = this->GetInput().data();
+    this->GetOutput() = std::move(this->GetInput());
+    for (auto &v : this->GetOutput()) {
+      v *= factor_;
+    }
+    return true;
+  }
+  bool PostProcessingImpl() override {
+    return true;
+  }
+
+  int factor_;
+};
+
+}  // namespace
+
+TEST(TaskGraphTest, ForwardsOutputsAlongEdges) {
+  ppc::task::TaskGraph graph;
+  auto fill = std::make_shared<FillTask>(1000);
+  auto left = std::make_shared<ScaleTask>(2);
+  auto right = std::make_shared<ScaleTask>(3);
+  auto tail = std::make_shared<ScaleTask>(5);
+
+  auto fill_node = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(fill));
+  auto left_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(left));
+  auto right_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(right));
+  auto tail_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(tail));
+  graph.Connect(fill_node, left_node);
+  graph.Connect(fill_node, right_node);
+  graph.Connect(left_node, tail_node);
+
+  ASSERT_TRUE(graph.Run());
+  EXPECT_EQ(left->GetOutput(), std::vector<int>());
+  EXPECT_EQ(right->GetOutput(), std::vector<int>(1000, 3));
+  EXPECT_EQ(tail->GetOutput(), std::vector<int>(1000, 10));
+  // The single-consumer edge moves the buffer instead of copying it
+  EXPECT_EQ(tail->input_data_at_run, left->input_data_at_run);
+}
+
+TEST(TaskGraphTest, RejectsSecondInputEdge) {
+  ppc::task::TaskGraph graph;
+  auto a = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(std::make_shared<FillTask>(1)));
+  auto b = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(std::make_shared<FillTask>(1)));
+  auto c = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(std::make_shared<ScaleTask>(1)));
+  graph.Connect(a, c);
+  EXPECT_THROW(graph.Connect(b, c), std::invalid_argument);
+  EXPECT_TRUE(graph.Run());
+}
+
+TEST(TaskGraphTest, ReportsFailedNode) {
+  ppc::task::TaskGraph graph;
+  auto fill = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(std::make_shared<FillTask>(0)));
+  auto scale = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(std::make_shared<ScaleTask>(1)));
+  graph.Connect(fill, scale);
+  EXPECT_FALSE(graph.Run());
+}
+
+TEST(TaskGraphTest, SkipsSuccessorsOfFailedNode) {
+  ppc::task::TaskGraph graph;
+  auto fill = std::make_shared<FillTask>(0);
+  auto scale = std::make_shared<ScaleTask>(2);
+  auto tail = std::make_shared<ScaleTask>(3);
+  auto other = std::make_shared<FillTask>(4);
+  scale->GetInput() = {7};
+
+  auto fill_node = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(fill));
+  auto scale_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(scale));
+  auto tail_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(tail));
+  graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(other));
+  graph.Connect(fill_node, scale_node);
+  graph.Connect(scale_node, tail_node);
+
+  EXPECT_FALSE(graph.Run());
+  EXPECT_EQ(scale->GetStageName(), "skipped");
+  EXPECT_EQ(tail->GetStageName(), "skipped");
+  EXPECT_EQ(scale->GetInput(), std::vector<int>{7});
+  EXPECT_TRUE(scale->GetOutput().empty());
+  EXPECT_EQ(other->GetOutput(), std::vector<int>(4, 1));
+}
+
+TEST(TaskGraphTest, MergesSeveralInputs) {
+  ppc::task::TaskGraph graph;
+  auto first = std::make_shared<FillTask>(2);
+  auto second = std::make_shared<FillTask>(3);
+  auto copy = std::make_shared<ScaleTask>(1);
+  auto merged = std::make_shared<ScaleTask>(5);
+  merged->GetInput() = {0};
+  auto append = [](const std::vector<int> &out, std::vector<int> &in) { in.insert(in.end(), out.begin(), out.end()); };
+
+  auto first_node = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(first));
+  auto second_node = graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(second));
+  auto copy_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(copy));
+  auto merged_node = graph.AddNode(ppc::task::TaskPtr<std::vector<int>, std::vector<int>>(merged));
+  graph.Connect(second_node, copy_node);
+  graph.Connect(second_node, merged_node, append);
+  graph.Connect(first_node, merged_node, append);
+  EXPECT_THROW(graph.Connect(first_node, copy_node, append), std::invalid_argument);
+  EXPECT_THROW(graph.Connect(first_node, merged_node), std::invalid_argument);
+
+  ASSERT_TRUE(graph.Run());
+  EXPECT_EQ(merged->GetOutput(), (std::vector<int>{0, 5, 5, 5, 5, 5}));
+  // A producer read by a merge edge keeps its output
+  EXPECT_EQ(second->GetOutput(), std::vector<int>(3, 1));
+  EXPECT_EQ(copy->GetOutput(), std::vector<int>(3, 1));
+}
+
+TEST(TaskGraphTest, RejectsMpiTasks) {
+  ppc::task::TaskGraph graph;
+  for (const auto type : {TypeOfTask::kMPI, TypeOfTask::kALL}) {
+    auto task = std::make_shared<FillTask>(1);
+    task->SetTypeOfTask(type);
+    EXPECT_THROW((void)graph.AddNode(ppc::task::TaskPtr<int, std::vector<int>>(task)), std::invalid_argument);
+    EXPECT_TRUE(ppc::task::RunPipeline(*task));
+  }
+  EXPECT_EQ(graph.Size(), 0U);
+}
+
 int main(int argc, char **argv) {
   return ppc::runners::SimpleInit(argc, argv);
 }
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ppc::thread_pool {
+
+/// @brief Shared state of one ParallelFor call.
+/// @details Holds the type-erased loop body and the number of iterations that still have to be executed.
+struct RangeJob {
+  void (*invoke)(const void *body, int64_t begin, int64_t end) = nullptr;
+  const void *body = nullptr;
+  int64_t grain = 1;
+  std::atomic<int64_t> remaining{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+};
+
+/// @brief Contiguous piece of a RangeJob that can be executed or split further by a thief.
+struct RangeTask {
+  RangeJob *job = nullptr;
+  int64_t begin = 0;
+  int64_t end = 0;
+};
+
+/// @brief Persistent work-stealing thread pool for std::thread based implementations.
+/// @details Every worker owns a deque of range tasks: it pushes and pops at the back, idle workers steal from the
+///          front of other deques. A range taken from a deque is split in halves until it is not larger than the
+///          grain size, so stolen work is always the biggest available piece. The thread calling ParallelFor()
+///          takes part in the computation until the whole range is done, so a pool of N threads keeps N-1
+///          background workers. Idle workers spin for a short time and then park on a condition variable.
+class ThreadPool {
+ public:
+  /// @brief Creates a pool with @p num_threads participating threads (including the calling thread).
+  explicit ThreadPool(int num_threads);
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// @brief Stops and joins all workers.
+  ~ThreadPool();
+
+  /// @brief Returns the process-wide pool sized with ppc::util::GetNumThreads() on first use.
+  static ThreadPool &Instance();
+
+  /// @brief Returns the number of threads taking part in parallel loops, including the caller.
+  [[nodiscard]] int GetNumThreads() const {
+    return static_cast<int>(workers_.size()) + 1;
+  }
+
+  /// @brief Calls @p body(begin, end) for sub-ranges covering [@p begin, @p end) in parallel.
+  /// @param grain Largest sub-range executed without further splitting; 0 selects an automatic value.
+  /// @throws Rethrows the first exception thrown by @p body.
+  template <typename Body>
+  void ParallelForRange(int64_t begin, int64_t end, const Body &body, int64_t grain = 0) {
+    if (end <= begin) {
+      return;
+    }
+    RangeJob job;
+    job.invoke = [](const void *fn, int64_t b, int64_t e) { (*static_cast<const Body *>(fn))(b, e); };
+    job.body = &body;
+    job.grain = grain > 0 ? grain : AutoGrain(end - begin);
+    Execute(job, begin, end);
+  }
+
+  /// @brief Calls @p body(i) for every i in [@p begin, @p end) in parallel.
+  /// @param grain Largest number of iterations executed as one piece; 0 selects an automatic value.
+  template <typename Body>
+  void ParallelFor(int64_t begin, int64_t end, const Body &body, int64_t grain = 0) {
+    ParallelForRange(
+        begin, end,
+        [&body](int64_t b, int64_t e) {
+      for (int64_t i = b; i < e; i++) {
+        body(i);
+      }
+    },
+        grain);
+  }
+
+  /// @brief Reduces [@p begin, @p end) in parallel with a deterministic combination order.
+  /// @param identity Neutral element of @p reduce.
+  /// @param map Function computing the partial result of a sub-range: T(int64_t begin, int64_t end).
+  /// @param reduce Associative function combining two partial results.
+  /// @param grain Size of the blocks whose partial results are combined; 0 selects an automatic value.
+  /// @return Reduction of all partial results in increasing index order.
+  template <typename T, typename Map, typename Reduce>
+  T ParallelReduce(int64_t begin, int64_t end, T identity, const Map &map, const Reduce &reduce, int64_t grain = 0) {
+    if (end <= begin) {
+      return identity;
+    }
+    const int64_t block = grain > 0 ? grain : AutoGrain(end - begin);
+    const int64_t num_blocks = (end - begin + block - 1) / block;
+    // Wrapped so that std::vector<bool> packing cannot make writes to neighbouring blocks race
+    struct Partial {
+      T value;
+    };
+    std::vector<Partial> partial(static_cast<std::size_t>(num_blocks), Partial{identity});
+    ParallelFor(
+        0, num_blocks,
+        [&](int64_t i) {
+      const int64_t b = begin + (i * block);
+      partial[static_cast<std::size_t>(i)].value = map(b, std::min(end, b + block));
+    },
+        1);
+    T result = identity;
+    for (auto &p : partial) {
+      result = reduce(result, p.value);
+    }
+    return result;
+  }
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<RangeTask> tasks;
+  };
+
+  [[nodiscard]] int64_t AutoGrain(int64_t count) const;
+  void Execute(RangeJob &job, int64_t begin, int64_t end);
+  void Push(std::size_t slot, const RangeTask &task);
+  bool PopLocal(std::size_t slot, RangeTask &task);
+  bool Steal(std::size_t thief, RangeTask &task);
+  bool FindTask(std::size_t slot, RangeTask &task);
+  void RunTask(std::size_t slot, RangeTask task);
+  void WorkerLoop(std::size_t slot);
+  [[nodiscard]] std::size_t CurrentSlot() const;
+
+  // Slots [0, workers_.size()) belong to workers, the last slot is shared by external callers
+  std::vector<std::unique_ptr<Worker>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<bool> stopping_{false};
+  std::atomic<uint64_t> epoch_{0};
+  std::atomic<int> sleeping_{0};
+  std::mutex park_mutex_;
+  std::condition_variable park_cv_;
+};
+
+}  // namespace ppc::thread_pool
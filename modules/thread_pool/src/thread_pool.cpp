@@ -0,0 +1,176 @@
+#include "thread_pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "util/include/util.hpp"
+
+namespace ppc::thread_pool {
+
+namespace {
+
+/// Number of unsuccessful search rounds an idle worker spins before parking.
+constexpr int kSpinRounds = 64;
+
+struct ThreadSlot {
+  const ThreadPool *pool = nullptr;
+  std::size_t slot = 0;
+};
+
+thread_local ThreadSlot current_thread_slot;
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads) {
+  const auto num_workers = static_cast<std::size_t>(std::max(1, num_threads) - 1);
+  queues_.reserve(num_workers + 1);
+  for (std::size_t i = 0; i <= num_workers; i++) {
+    queues_.push_back(std::make_unique<Worker>());
+  }
+  workers_.reserve(num_workers);
+  for (std::size_t i = 0; i < num_workers; i++) {
+    workers_.emplace_back([this, i]() { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  stopping_.store(true);
+  {
+    std::lock_guard<std::mutex> lock(park_mutex_);
+    park_cv_.notify_all();
+  }
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ThreadPool &ThreadPool::Instance() {
+  static ThreadPool pool(ppc::util::GetNumThreads());
+  return pool;
+}
+
+int64_t ThreadPool::AutoGrain(int64_t count) const {
+  // Several pieces per thread leave room for stealing when iterations have different cost
+  return std::max<int64_t>(1, count / (static_cast<int64_t>(GetNumThreads()) * 8));
+}
+
+std::size_t ThreadPool::CurrentSlot() const {
+  if (current_thread_slot.pool == this) {
+    return current_thread_slot.slot;
+  }
+  return queues_.size() - 1;
+}
+
+void ThreadPool::Execute(RangeJob &job, int64_t begin, int64_t end) {
+  job.remaining.store(end - begin);
+  const std::size_t slot = CurrentSlot();
+  RunTask(slot, RangeTask{.job = &job, .begin = begin, .end = end});
+  // The caller helps with any available work until its own range is complete
+  while (job.remaining.load(std::memory_order_acquire) > 0) {
+    RangeTask task;
+    if (FindTask(slot, task)) {
+      RunTask(slot, task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  if (job.error) {
+    std::rethrow_exception(job.error);
+  }
+}
+
+void ThreadPool::Push(std::size_t slot, const RangeTask &task) {
+  {
+    std::lock_guard<std::mutex> lock(queues_[slot]->mutex);
+    queues_[slot]->tasks.push_back(task);
+  }
+  epoch_.fetch_add(1);
+  if (sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(park_mutex_);
+    park_cv_.notify_all();
+  }
+}
+
+bool ThreadPool::PopLocal(std::size_t slot, RangeTask &task) {
+  Worker &worker = *queues_[slot];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  if (worker.tasks.empty()) {
+    return false;
+  }
+  task = worker.tasks.back();
+  worker.tasks.pop_back();
+  return true;
+}
+
+bool ThreadPool::Steal(std::size_t thief, RangeTask &task) {
+  const std::size_t count = queues_.size();
+  for (std::size_t offset = 1; offset < count; offset++) {
+    Worker &victim = *queues_[(thief + offset) % count];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::FindTask(std::size_t slot, RangeTask &task) {
+  return PopLocal(slot, task) || Steal(slot, task);
+}
+
+void ThreadPool::RunTask(std::size_t slot, RangeTask task) {
+  RangeJob &job = *task.job;
+  while (task.end - task.begin > job.grain) {
+    const int64_t mid = task.begin + ((task.end - task.begin) / 2);
+    Push(slot, RangeTask{.job = &job, .begin = mid, .end = task.end});
+    task.end = mid;
+  }
+  if (!job.failed.load(std::memory_order_relaxed)) {
+    try {
+      job.invoke(job.body, task.begin, task.end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(job.error_mutex);
+      if (!job.error) {
+        job.error = std::current_exception();
+      }
+      job.failed.store(true, std::memory_order_relaxed);
+    }
+  }
+  // Last access to the job: the owner may return as soon as the counter reaches zero
+  job.remaining.fetch_sub(task.end - task.begin, std::memory_order_acq_rel);
+}
+
+void ThreadPool::WorkerLoop(std::size_t slot) {
+  current_thread_slot = ThreadSlot{.pool = this, .slot = slot};
+  RangeTask task;
+  while (!stopping_.load()) {
+    bool found = FindTask(slot, task);
+    for (int round = 0; !found && round < kSpinRounds; round++) {
+      std::this_thread::yield();
+      found = FindTask(slot, task);
+    }
+    if (found) {
+      RunTask(slot, task);
+      continue;
+    }
+    const uint64_t seen = epoch_.load();
+    if (FindTask(slot, task)) {
+      RunTask(slot, task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(park_mutex_);
+    sleeping_.fetch_add(1);
+    park_cv_.wait(lock, [this, seen]() { return stopping_.load() || epoch_.load() != seen; });
+    sleeping_.fetch_sub(1);
+  }
+}
+
+}  // namespace ppc::thread_pool
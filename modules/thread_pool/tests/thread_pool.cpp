@@ -0,0 +1,133 @@
+#include "thread_pool/include/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(ThreadPoolTests, ParallelForVisitsEveryIndexOnce) {
+  ppc::thread_pool::ThreadPool pool(4);
+  std::vector<std::atomic<int>> visits(10000);
+  pool.ParallelFor(0, static_cast<int64_t>(visits.size()), [&](int64_t i) { visits[static_cast<std::size_t>(i)]++; });
+  for (const auto &v : visits) {
+    EXPECT_EQ(v.load(), 1);
+  }
+}
+
+TEST(ThreadPoolTests, ParallelForRangeCoversRangeWithGrain) {
+  ppc::thread_pool::ThreadPool pool(3);
+  std::atomic<int64_t> total{0};
+  std::atomic<int64_t> largest{0};
+  pool.ParallelForRange(
+      5, 1005,
+      [&](int64_t b, int64_t e) {
+    total += e - b;
+    int64_t seen = largest.load();
+    while (e - b > seen && !largest.compare_exchange_weak(seen, e - b)) {
+    }
+  },
+      16);
+  EXPECT_EQ(total.load(), 1000);
+  EXPECT_LE(largest.load(), 16);
+}
+
+TEST(ThreadPoolTests, EmptyRangeDoesNothing) {
+  ppc::thread_pool::ThreadPool pool(2);
+  int calls = 0;
+  pool.ParallelFor(10, 10, [&](int64_t) { calls++; });
+  pool.ParallelFor(10, 3, [&](int64_t) { calls++; });
+  EXPECT_EQ(calls, 0);
+}
+
+TEST(ThreadPoolTests, SingleThreadPoolRunsOnCaller) {
+  ppc::thread_pool::ThreadPool pool(1);
+  EXPECT_EQ(pool.GetNumThreads(), 1);
+  int64_t sum = 0;
+  pool.ParallelFor(0, 100, [&](int64_t i) { sum += i; });
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(ThreadPoolTests, ParallelReduceMatchesSequentialSum) {
+  ppc::thread_pool::ThreadPool pool(4);
+  std::vector<int64_t> data(12345);
+  std::iota(data.begin(), data.end(), 1);
+  const auto sum = pool.ParallelReduce(
+      0, static_cast<int64_t>(data.size()), int64_t{0},
+      [&](int64_t b, int64_t e) {
+    return std::accumulate(data.begin() + b, data.begin() + e, int64_t{0});
+  },
+      [](int64_t a, int64_t b) { return a + b; });
+  EXPECT_EQ(sum, std::accumulate(data.begin(), data.end(), int64_t{0}));
+}
+
+TEST(ThreadPoolTests, ParallelReduceKeepsIndexOrder) {
+  ppc::thread_pool::ThreadPool pool(4);
+  const auto text = pool.ParallelReduce(
+      0, 26, std::string{}, [](int64_t b, int64_t e) {
+    std::string s;
+    for (int64_t i = b; i < e; i++) {
+      s.push_back(static_cast<char>('a' + i));
+    }
+    return s;
+  }, [](const std::string &a, const std::string &b) { return a + b; }, 3);
+  EXPECT_EQ(text, "abcdefghijklmnopqrstuvwxyz");
+}
+
+TEST(ThreadPoolTests, ParallelReduceSupportsBool) {
+  ppc::thread_pool::ThreadPool pool(4);
+  std::vector<int> data(10000, 1);
+  data[7777] = -1;
+  auto all_positive = [&](int64_t b, int64_t e) {
+    return std::all_of(data.begin() + b, data.begin() + e, [](int v) { return v > 0; });
+  };
+  auto both = [](bool a, bool b) { return a && b; };
+  EXPECT_FALSE(pool.ParallelReduce(0, static_cast<int64_t>(data.size()), true, all_positive, both, 1));
+  data[7777] = 1;
+  EXPECT_TRUE(pool.ParallelReduce(0, static_cast<int64_t>(data.size()), true, all_positive, both, 1));
+}
+
+TEST(ThreadPoolTests, RethrowsExceptionFromBody) {
+  ppc::thread_pool::ThreadPool pool(4);
+  EXPECT_THROW(pool.ParallelFor(0, 1000,
+                                [](int64_t i) {
+    if (i == 777) {
+      throw std::runtime_error("failure");
+    }
+  }),
+               std::runtime_error);
+  // The pool stays usable after a failed loop
+  std::atomic<int> count{0};
+  pool.ParallelFor(0, 100, [&](int64_t) { count++; });
+  EXPECT_EQ(count.load(), 100);
+}
+
+TEST(ThreadPoolTests, NestedParallelForCompletes) {
+  ppc::thread_pool::ThreadPool pool(4);
+  std::atomic<int> count{0};
+  pool.ParallelFor(
+      0, 8, [&](int64_t) { pool.ParallelFor(0, 50, [&](int64_t) { count++; }); }, 1);
+  EXPECT_EQ(count.load(), 400);
+}
+
+TEST(ThreadPoolTests, ReusedAcrossManyCalls) {
+  ppc::thread_pool::ThreadPool pool(4);
+  int64_t total = 0;
+  for (int iter = 0; iter < 200; iter++) {
+    std::atomic<int64_t> sum{0};
+    pool.ParallelFor(0, 64, [&](int64_t i) { sum += i; });
+    total += sum.load();
+  }
+  EXPECT_EQ(total, 200 * 2016);
+}
+
+TEST(ThreadPoolTests, InstanceIsSingleton) {
+  auto &pool = ppc::thread_pool::ThreadPool::Instance();
+  EXPECT_EQ(&pool, &ppc::thread_pool::ThreadPool::Instance());
+  EXPECT_GE(pool.GetNumThreads(), 1);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+#include <omp.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "performance/include/microbench.hpp"
+#include "runners/include/runners.hpp"
+#include "util/include/combinable.hpp"
+
+// Per-thread Combinable counters versus one shared std::atomic counter incremented by every thread.
+// Reported time is per increment of one thread, so an ideal (contention-free) counter stays flat across thread
+// counts. The sweep deliberately goes up to 64 threads regardless of the core count.
+
+namespace {
+
+using ppc::performance::BenchCompilerBarrier;
+
+constexpr int kMaxThreads = 64;
+constexpr int64_t kIncrementsPerThread = int64_t{1} << 18;
+constexpr std::string_view kSuite = "combinable";
+
+void Report(std::string_view backend, std::string_view variant, int threads, double seconds) {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  if (rank == 0) {
+    ppc::performance::PrintBenchResult(kSuite, backend, variant, threads,
+                                       seconds / static_cast<double>(kIncrementsPerThread));
+  }
+}
+
+/// Runs body(thread_id) on @p num_threads std::threads and returns the elapsed time in seconds.
+double TimeTeam(int num_threads, const std::function<void(int)> &body) {
+  const auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  threads.reserve(static_cast<std::size_t>(num_threads));
+  for (int tid = 0; tid < num_threads; tid++) {
+    threads.emplace_back(body, tid);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+  return elapsed.count();
+}
+
+}  // namespace
+
+TEST(CombinableBench, STL) {
+  for (int n : ppc::performance::GetBenchThreadCounts(kMaxThreads)) {
+    std::atomic<int64_t> shared(0);
+    Report("stl", "atomic", n, TimeTeam(n, [&shared](int /*tid*/) {
+      for (int64_t i = 0; i < kIncrementsPerThread; i++) {
+        shared.fetch_add(1, std::memory_order_relaxed);
+      }
+    }));
+    EXPECT_EQ(shared.load(), n * kIncrementsPerThread);
+
+    ppc::util::Combinable<int64_t> combinable;
+    Report("stl", "combinable", n, TimeTeam(n, [&combinable](int /*tid*/) {
+      int64_t &local = combinable.Local();
+      for (int64_t i = 0; i < kIncrementsPerThread; i++) {
+        local++;
+        BenchCompilerBarrier();
+      }
+    }));
+    EXPECT_EQ(combinable.Combine(std::plus<>()), n * kIncrementsPerThread);
+  }
+}
+
+TEST(CombinableBench, OMP) {
+  for (int n : ppc::performance::GetBenchThreadCounts(kMaxThreads)) {
+    std::atomic<int64_t> shared(0);
+    double begin = omp_get_wtime();
+#pragma omp parallel num_threads(n) default(none) shared(shared, kIncrementsPerThread)
+    for (int64_t i = 0; i < kIncrementsPerThread; i++) {
+      shared.fetch_add(1, std::memory_order_relaxed);
+    }
+    Report("omp", "atomic", n, omp_get_wtime() - begin);
+    EXPECT_EQ(shared.load(), n * kIncrementsPerThread);
+
+    ppc::util::Combinable<int64_t> combinable;
+    begin = omp_get_wtime();
+#pragma omp parallel num_threads(n) default(none) shared(combinable, kIncrementsPerThread)
+    {
+      int64_t &local = combinable.Local(static_cast<std::size_t>(omp_get_thread_num()));
+      for (int64_t i = 0; i < kIncrementsPerThread; i++) {
+        local++;
+        BenchCompilerBarrier();
+      }
+    }
+    Report("omp", "combinable", n, omp_get_wtime() - begin);
+    EXPECT_EQ(combinable.Combine(std::plus<>()), n * kIncrementsPerThread);
+  }
+}
+
+int main(int argc, char **argv) {
+  return ppc::runners::Init(argc, argv);
+}
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/partitioner.h"
+#include "oneapi/tbb/task_arena.h"
+#include "util/include/cache_line.hpp"
+#include "util/include/partition.hpp"
+#include "util/include/util.hpp"
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+
+namespace ppc::util {
+
+/// @brief Size of a transparent huge page on x86-64 / AArch64 Linux.
+inline constexpr std::size_t kHugePageSize = std::size_t{2} << 20U;
+
+/// @brief Selects how the pages of an AlignedBuffer are touched for the first time.
+/// @details On NUMA systems the first write to a page decides on which node it is placed, so the
+///          buffer should be initialized with the same thread partitioning that later reads it.
+enum class FirstTouch : uint8_t {
+  /// Initialize from the calling thread only
+  kSequential,
+  /// Static OpenMP schedule over ppc::util::GetNumThreads() threads
+  kOMP,
+  /// TBB static partitioner in an arena of ppc::util::GetNumThreads() workers (one contiguous block per worker)
+  kTBB,
+  /// Contiguous blocks over ppc::util::GetNumThreads() std::threads
+  kSTL
+};
+
+template <typename T>
+/// @brief Contiguous buffer with cache-line (or huge-page) alignment and parallel first-touch initialization.
+/// @details Buffers of at least kHugePageSize bytes are 2 MiB aligned and advised with MADV_HUGEPAGE on Linux.
+///          The element type is restricted to trivially copyable types, which covers the numeric inputs
+///          the buffer is meant for and lets every copy be done with plain memory moves.
+/// @tparam T Element type.
+class AlignedBuffer {
+  static_assert(std::is_trivially_copyable_v<T>, "AlignedBuffer requires a trivially copyable element type");
+
+ public:
+  AlignedBuffer() = default;
+
+  /// @brief Allocates @p size elements and initializes them with @p value.
+  /// @param size Number of elements.
+  /// @param value Initial value of every element.
+  /// @param first_touch Thread partitioning used for the initialization.
+  explicit AlignedBuffer(std::size_t size, const T &value = T{}, FirstTouch first_touch = FirstTouch::kOMP)
+      : first_touch_(first_touch) {
+    Allocate(size);
+    ParallelBlocks(size_, first_touch_,
+                   [&](std::size_t begin, std::size_t end) { std::fill(data_ + begin, data_ + end, value); });
+  }
+
+  AlignedBuffer(const AlignedBuffer &other) : first_touch_(other.first_touch_) {
+    Allocate(other.size_);
+    CopyFrom(other.data_);
+  }
+
+  AlignedBuffer(AlignedBuffer &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        alignment_(std::exchange(other.alignment_, kCacheLineSize)),
+        first_touch_(other.first_touch_) {}
+
+  /// @brief Copies the contents of @p other, reusing the existing allocation when it is large enough.
+  AlignedBuffer &operator=(const AlignedBuffer &other) {
+    if (this != &other) {
+      first_touch_ = other.first_touch_;
+      if (other.size_ > capacity_) {
+        Release();
+        Allocate(other.size_);
+      } else {
+        size_ = other.size_;
+      }
+      CopyFrom(other.data_);
+    }
+    return *this;
+  }
+
+  AlignedBuffer &operator=(AlignedBuffer &&other) noexcept {
+    if (this != &other) {
+      Release();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+      alignment_ = std::exchange(other.alignment_, kCacheLineSize);
+      first_touch_ = other.first_touch_;
+    }
+    return *this;
+  }
+
+  ~AlignedBuffer() {
+    Release();
+  }
+
+  /// @brief Changes the number of elements. New elements are value-initialized with the buffer's
+  ///        first-touch policy; the allocation is kept when shrinking.
+  void Resize(std::size_t size) {
+    if (size > capacity_) {
+      AlignedBuffer grown(size, T{}, first_touch_);
+      std::copy(data_, data_ + size_, grown.data_);
+      *this = std::move(grown);
+      return;
+    }
+    if (size > size_) {
+      const std::size_t old_size = size_;
+      ParallelBlocks(size - old_size, first_touch_, [&](std::size_t begin, std::size_t end) {
+        std::fill(data_ + old_size + begin, data_ + old_size + end, T{});
+      });
+    }
+    size_ = size;
+  }
+
+  /// @brief Sets the number of elements to zero without releasing memory.
+  void Clear() noexcept {
+    size_ = 0;
+  }
+
+  [[nodiscard]] T *Data() noexcept {
+    return data_;
+  }
+  [[nodiscard]] const T *Data() const noexcept {
+    return data_;
+  }
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return size_;
+  }
+  [[nodiscard]] std::size_t Capacity() const noexcept {
+    return capacity_;
+  }
+  [[nodiscard]] bool Empty() const noexcept {
+    return size_ == 0;
+  }
+  /// @brief Returns the alignment in bytes of the underlying allocation.
+  [[nodiscard]] std::size_t Alignment() const noexcept {
+    return alignment_;
+  }
+  [[nodiscard]] FirstTouch GetFirstTouch() const noexcept {
+    return first_touch_;
+  }
+
+  T &operator[](std::size_t i) noexcept {
+    return data_[i];
+  }
+  const T &operator[](std::size_t i) const noexcept {
+    return data_[i];
+  }
+
+  T *begin() noexcept {  // NOLINT(readability-identifier-naming)
+    return data_;
+  }
+  T *end() noexcept {  // NOLINT(readability-identifier-naming)
+    return data_ + size_;
+  }
+  [[nodiscard]] const T *begin() const noexcept {  // NOLINT(readability-identifier-naming)
+    return data_;
+  }
+  [[nodiscard]] const T *end() const noexcept {  // NOLINT(readability-identifier-naming)
+    return data_ + size_;
+  }
+
+  operator std::span<T>() noexcept {  // NOLINT(google-explicit-constructor)
+    return {data_, size_};
+  }
+  operator std::span<const T>() const noexcept {  // NOLINT(google-explicit-constructor)
+    return {data_, size_};
+  }
+
+  friend bool operator==(const AlignedBuffer &lhs, const AlignedBuffer &rhs) {
+    return std::ranges::equal(lhs, rhs);
+  }
+
+  /// @brief Splits [0, @p count) into the same contiguous blocks the selected backend uses and calls
+  ///        @p body(begin, end) for each of them, potentially in parallel.
+  template <typename Body>
+  static void ParallelBlocks(std::size_t count, FirstTouch first_touch, const Body &body) {
+    if (count == 0) {
+      return;
+    }
+    const int num_threads = std::max(1, ppc::util::GetNumThreads());
+    switch (first_touch) {
+      case FirstTouch::kOMP: {
+        const auto signed_count = static_cast<int64_t>(count);
+#pragma omp parallel num_threads(num_threads) default(none) shared(body, signed_count, num_threads)
+        {
+          const auto [begin, end] = BlockRange(signed_count, omp_get_num_threads(), omp_get_thread_num());
+          body(static_cast<std::size_t>(begin), static_cast<std::size_t>(end));
+        }
+        break;
+      }
+      case FirstTouch::kTBB: {
+        // The arena limits TBB to GetNumThreads() workers like the other backends
+        tbb::task_arena arena(num_threads);
+        arena.execute([&] {
+          tbb::parallel_for(
+              tbb::blocked_range<int>(0, num_threads, 1),
+              [&](const tbb::blocked_range<int> &r) {
+                for (int i = r.begin(); i < r.end(); i++) {
+                  const auto [begin, end] = BlockRange(static_cast<int64_t>(count), num_threads, i);
+                  body(static_cast<std::size_t>(begin), static_cast<std::size_t>(end));
+                }
+              },
+              tbb::static_partitioner{});
+        });
+        break;
+      }
+      case FirstTouch::kSTL: {
+        std::vector<std::thread> threads;
+        threads.reserve(static_cast<std::size_t>(num_threads));
+        for (int i = 0; i < num_threads; i++) {
+          const auto [begin, end] = BlockRange(static_cast<int64_t>(count), num_threads, i);
+          threads.emplace_back(
+              [&body, begin, end]() { body(static_cast<std::size_t>(begin), static_cast<std::size_t>(end)); });
+        }
+        for (auto &thread : threads) {
+          thread.join();
+        }
+        break;
+      }
+      case FirstTouch::kSequential:
+        body(0, count);
+        break;
+    }
+  }
+
+ private:
+  void Allocate(std::size_t size) {
+    size_ = size;
+    capacity_ = size;
+    if (size == 0) {
+      data_ = nullptr;
+      alignment_ = kCacheLineSize;
+      return;
+    }
+    const std::size_t bytes = size * sizeof(T);
+    alignment_ = bytes >= kHugePageSize ? kHugePageSize : std::max(kCacheLineSize, alignof(T));
+    const std::size_t padded = ((bytes + alignment_ - 1) / alignment_) * alignment_;
+    data_ = static_cast<T *>(::operator new(padded, std::align_val_t{alignment_}));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alignment_ == kHugePageSize) {
+      // Only a hint: failure (e.g. THP disabled) leaves regular pages in place
+      (void)madvise(static_cast<void *>(data_), padded, MADV_HUGEPAGE);
+    }
+#endif
+  }
+
+  void Release() noexcept {
+    if (data_ != nullptr) {
+      ::operator delete(static_cast<void *>(data_), std::align_val_t{alignment_});
+    }
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+  }
+
+  void CopyFrom(const T *src) {
+    ParallelBlocks(size_, first_touch_,
+                   [&](std::size_t begin, std::size_t end) { std::copy(src + begin, src + end, data_ + begin); });
+  }
+
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = 0;
+  std::size_t alignment_ = kCacheLineSize;
+  FirstTouch first_touch_ = FirstTouch::kOMP;
+};
+
+}  // namespace ppc::util
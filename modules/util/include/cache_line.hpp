@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ppc::util {
+
+/// @brief Size of a cache line assumed by the aligned containers and per-thread slots.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+}  // namespace ppc::util
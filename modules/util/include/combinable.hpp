@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+
+#include "util/include/cache_line.hpp"
+
+namespace ppc::util {
+
+/// @brief Returns a small index that is unique among the live threads of the process.
+/// @details Indices of finished threads are handed out again, so they stay in [0, number of live threads).
+std::size_t GetThreadIndex();
+
+template <typename T>
+/// @brief Per-thread values that are combined after a parallel section, similar to tbb::combinable.
+/// @details Every thread updates its own cache-line sized slot, so counting or summing from many threads causes
+///          neither contention nor false sharing. Unlike tbb::combinable it works with any threading backend:
+///          Local() finds the slot of the calling thread (std::thread, TBB, pool workers), Local(index) uses an
+///          explicit index such as omp_get_thread_num(). Slots are allocated lazily and never move, so references
+///          returned by Local() stay valid until Clear() or destruction. Combine() must not run concurrently with
+///          updates.
+/// @tparam T Value type; must be default constructible and copy assignable.
+class Combinable {
+ public:
+  /// @brief Creates a combinable whose slots start from a value-initialized T.
+  Combinable() = default;
+
+  /// @brief Creates a combinable whose slots start from @p identity.
+  explicit Combinable(const T &identity) : identity_(identity) {}
+
+  Combinable(const Combinable &) = delete;
+  Combinable &operator=(const Combinable &) = delete;
+
+  ~Combinable() {
+    for (auto &bucket : buckets_) {
+      delete[] bucket.load();
+    }
+  }
+
+  /// @brief Returns the slot of the calling thread.
+  T &Local() {
+    return Local(GetThreadIndex());
+  }
+
+  /// @brief Returns the slot with the given index.
+  /// @param index Slot index; must not be used by two threads at the same time.
+  T &Local(std::size_t index) {
+    Slot &slot = SlotAt(index);
+    if (!slot.used) {
+      slot.value = identity_;
+      slot.used = true;
+    }
+    return slot.value;
+  }
+
+  /// @brief Folds all used slots with @p op.
+  /// @details The fold starts from the first used slot, so the identity is not mixed in once per thread; it is
+  ///          only returned if no slot was used. Slots are visited in index order, so the result is deterministic
+  ///          for a fixed thread assignment.
+  template <typename BinaryOp>
+  [[nodiscard]] T Combine(BinaryOp op) const {
+    T result = identity_;
+    bool first = true;
+    CombineEach([&](const T &value) {
+      result = first ? value : op(result, value);
+      first = false;
+    });
+    return result;
+  }
+
+  /// @brief Calls @p fn for the value of every used slot in index order.
+  template <typename Fn>
+  void CombineEach(Fn fn) const {
+    for (std::size_t bucket = 0; bucket < kNumBuckets; bucket++) {
+      const Slot *slots = buckets_[bucket].load(std::memory_order_acquire);
+      if (slots == nullptr) {
+        continue;
+      }
+      for (std::size_t i = 0; i < BucketSize(bucket); i++) {
+        if (slots[i].used) {
+          fn(slots[i].value);
+        }
+      }
+    }
+  }
+
+  /// @brief Marks all slots unused, so the next Local() call starts from the identity again.
+  void Clear() {
+    for (std::size_t bucket = 0; bucket < kNumBuckets; bucket++) {
+      Slot *slots = buckets_[bucket].load(std::memory_order_acquire);
+      for (std::size_t i = 0; slots != nullptr && i < BucketSize(bucket); i++) {
+        slots[i].used = false;
+      }
+    }
+  }
+
+ private:
+  struct alignas(kCacheLineSize) Slot {
+    T value{};
+    bool used = false;
+  };
+
+  // Bucket b holds 2^b slots, so slot addresses never change while the table grows
+  static constexpr std::size_t kNumBuckets = 32;
+
+  static constexpr std::size_t BucketSize(std::size_t bucket) {
+    return std::size_t{1} << bucket;
+  }
+
+  Slot &SlotAt(std::size_t index) {
+    const std::size_t key = index + 1;
+    const auto bucket = static_cast<std::size_t>(std::bit_width(key)) - 1;
+    Slot *slots = buckets_[bucket].load(std::memory_order_acquire);
+    if (slots == nullptr) {
+      auto *fresh = new Slot[BucketSize(bucket)];
+      if (buckets_[bucket].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel)) {
+        slots = fresh;
+      } else {
+        delete[] fresh;
+      }
+    }
+    return slots[key - BucketSize(bucket)];
+  }
+
+  T identity_{};
+  std::array<std::atomic<Slot *>, kNumBuckets> buckets_{};
+};
+
+}  // namespace ppc::util
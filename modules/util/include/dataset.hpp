@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "util/include/mapped_file.hpp"
+
+namespace ppc::util {
+
+/// @brief Element type of a dataset.
+enum class DType : uint8_t { kInt8, kUInt8, kInt16, kUInt16, kInt32, kUInt32, kInt64, kUInt64, kFloat32, kFloat64 };
+
+/// @brief Returns the size of an element of @p dtype in bytes.
+std::size_t DTypeSize(DType dtype);
+
+/// @brief Element types a dataset can hold: the fixed-width integers, float and double.
+template <typename T>
+concept DatasetElement =
+    std::same_as<T, int8_t> || std::same_as<T, uint8_t> || std::same_as<T, int16_t> || std::same_as<T, uint16_t> ||
+    std::same_as<T, int32_t> || std::same_as<T, uint32_t> || std::same_as<T, int64_t> || std::same_as<T, uint64_t> ||
+    std::same_as<T, float> || std::same_as<T, double>;
+
+namespace detail {
+
+template <DatasetElement T>
+consteval DType DTypeOf() {
+  if constexpr (std::same_as<T, int8_t>) {
+    return DType::kInt8;
+  } else if constexpr (std::same_as<T, uint8_t>) {
+    return DType::kUInt8;
+  } else if constexpr (std::same_as<T, int16_t>) {
+    return DType::kInt16;
+  } else if constexpr (std::same_as<T, uint16_t>) {
+    return DType::kUInt16;
+  } else if constexpr (std::same_as<T, int32_t>) {
+    return DType::kInt32;
+  } else if constexpr (std::same_as<T, uint32_t>) {
+    return DType::kUInt32;
+  } else if constexpr (std::same_as<T, int64_t>) {
+    return DType::kInt64;
+  } else if constexpr (std::same_as<T, uint64_t>) {
+    return DType::kUInt64;
+  } else if constexpr (std::same_as<T, float>) {
+    return DType::kFloat32;
+  } else {
+    return DType::kFloat64;
+  }
+}
+
+}  // namespace detail
+
+/// @brief DType of the element type @p T.
+template <DatasetElement T>
+inline constexpr DType kDTypeOf = detail::DTypeOf<T>();
+
+/// @brief Most dimensions a dataset can have.
+inline constexpr int kDatasetMaxDims = 4;
+
+/// @brief Offset of the payload in a dataset file: one page, so the payload is aligned for any element type and
+///        vector loads, and the rows of a rank start at the same offset within a page as in the file.
+inline constexpr std::size_t kDatasetPayloadOffset = 4096;
+
+/// @brief Identifies dataset files.
+inline constexpr std::array<char, 8> kDatasetMagic = {'P', 'P', 'C', 'D', 'S', 'E', 'T', '1'};
+
+/// @brief Size of the tag field of a dataset header, including the terminating NUL.
+inline constexpr std::size_t kDatasetTagSize = 32;
+
+/// @brief Header at the start of a dataset file; the payload follows at kDatasetPayloadOffset.
+/// @details A dataset is a dense row-major array. Fields are stored in native byte order: datasets are written and
+///          read on the machines of one cluster, not exchanged between architectures.
+struct DatasetHeader {
+  std::array<char, 8> magic;
+  uint32_t dtype;
+  uint32_t dims;
+  std::array<uint64_t, kDatasetMaxDims> shape;
+  uint64_t payload_offset;
+  uint64_t payload_bytes;
+  /// DatasetChecksum() of the payload
+  uint64_t checksum;
+  /// Free-form producer of the values, e.g. generator and version; NUL-padded, empty in files without a tag
+  std::array<char, kDatasetTagSize> tag;
+};
+
+/// @brief Element type, shape, checksum and tag of a dataset.
+struct DatasetInfo {
+  DType dtype = DType::kUInt8;
+  std::vector<int64_t> shape;
+  uint64_t checksum = 0;
+  std::string tag;
+
+  /// @brief Returns the number of elements, the product of the shape.
+  [[nodiscard]] int64_t Elements() const;
+  /// @brief Returns the number of elements of a row, i.e. of one index of the first dimension.
+  [[nodiscard]] int64_t RowElements() const;
+  /// @brief Returns the size of the payload in bytes.
+  [[nodiscard]] std::size_t PayloadBytes() const {
+    return static_cast<std::size_t>(Elements()) * DTypeSize(dtype);
+  }
+};
+
+/// @brief Checksum of a dataset payload.
+/// @details The payload is hashed in 1 MiB chunks in parallel (64-bit FNV-1a over 8-byte words, seeded with the
+///          chunk index) and the chunk hashes are combined with XOR, so the result does not depend on the number of
+///          threads. It detects truncated or corrupted files, not deliberate tampering.
+uint64_t DatasetChecksum(std::span<const std::byte> payload);
+
+/// @brief Writes @p payload as a dataset of @p dtype elements with @p shape to @p path, creating missing directories.
+/// @details The file is written under a unique temporary name and renamed, so ranks that write the same dataset
+///          concurrently and readers never see a partial file. The temporary file is removed if writing fails.
+/// @param tag Stored in the header, see DatasetHeader::tag.
+/// @throws std::invalid_argument if the shape has no or more than kDatasetMaxDims dimensions, a negative extent or
+///         does not match the payload size, or if @p tag does not fit; std::runtime_error (or
+///         std::filesystem::filesystem_error) if the file cannot be written.
+void WriteDataset(const std::string &path, DType dtype, const std::vector<int64_t> &shape,
+                  std::span<const std::byte> payload, const std::string &tag = {});
+
+template <DatasetElement T>
+/// @brief Writes @p values as a dataset with @p shape, by default one-dimensional.
+void WriteDataset(const std::string &path, std::span<const T> values, std::vector<int64_t> shape = {},
+                  const std::string &tag = {}) {
+  if (shape.empty()) {
+    shape.push_back(static_cast<int64_t>(values.size()));
+  }
+  WriteDataset(path, kDTypeOf<T>, shape, std::as_bytes(values), tag);
+}
+
+/// @brief Reads the header of the dataset at @p path.
+/// @throws std::runtime_error if the file cannot be read or is not a valid dataset.
+DatasetInfo ReadDatasetInfo(const std::string &path);
+
+/// @brief Returns true if the payload of the dataset at @p path matches the checksum in its header.
+/// @details Reads the whole payload; Dataset does not verify on open, so that ranks mapping a part of a large
+///          dataset do not read all of it.
+bool VerifyDataset(const std::string &path);
+
+/// @brief Zero-copy read-only view of a dataset file, or of a band of its rows, through a MappedFile.
+/// @details Only the mapped rows are paged in, so every MPI rank can open its own BlockRange() of a dataset far
+///          larger than its memory with OpenBlock() and read it in place.
+class Dataset {
+ public:
+  Dataset() = default;
+
+  /// @brief Maps the whole dataset at @p path.
+  /// @throws std::runtime_error if the file cannot be mapped or is not a valid dataset.
+  static Dataset Open(const std::string &path);
+
+  /// @brief Maps rows [@p first_row, @p first_row + @p rows) of the first dimension (elements of a 1-D dataset).
+  /// @throws std::invalid_argument if the rows are out of range, std::runtime_error as Open().
+  static Dataset OpenRows(const std::string &path, int64_t first_row, int64_t rows);
+
+  /// @brief Maps the BlockRange() of the rows that @p part of @p parts owns, e.g. with the rank and size of a
+  ///        communicator.
+  static Dataset OpenBlock(const std::string &path, int parts, int part);
+
+  /// @brief Returns the element type, shape, checksum and tag of the whole dataset.
+  [[nodiscard]] const DatasetInfo &Info() const {
+    return info_;
+  }
+  /// @brief Returns the first mapped row.
+  [[nodiscard]] int64_t FirstRow() const {
+    return first_row_;
+  }
+  /// @brief Returns the number of mapped rows.
+  [[nodiscard]] int64_t Rows() const {
+    return rows_;
+  }
+  /// @brief Returns the payload bytes of the mapped rows.
+  [[nodiscard]] std::span<const std::byte> Bytes() const {
+    return mapping_.Bytes();
+  }
+
+  template <DatasetElement T>
+  /// @brief Returns the elements of the mapped rows in row-major order; valid as long as the dataset lives.
+  /// @throws std::invalid_argument if the dataset does not hold elements of type @p T.
+  [[nodiscard]] std::span<const T> Values() const {
+    if (info_.dtype != kDTypeOf<T>) {
+      throw std::invalid_argument("Dataset::Values: the dataset holds a different element type");
+    }
+    const auto bytes = mapping_.Bytes();
+    return {reinterpret_cast<const T *>(bytes.data()), bytes.size() / sizeof(T)};
+  }
+
+ private:
+  DatasetInfo info_;
+  int64_t first_row_ = 0;
+  int64_t rows_ = 0;
+  MappedFile mapping_;
+};
+
+}  // namespace ppc::util
@@ -13,6 +13,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "runners/include/watchdog.hpp"
 #include "task/include/task.hpp"
 #include "util/include/util.hpp"
 
@@ -100,6 +101,13 @@ class BaseRunFuncTests : public ::testing::TestWithParam<FuncTestParam<InType, O
   /// @brief Executes the full task pipeline with validation.
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
   void ExecuteTaskPipeline() {
+    const double max_time = ppc::util::GetTaskMaxTime();
+    ppc::runners::Watchdog watchdog(
+        max_time, max_time * ppc::runners::kWatchdogAbortFactor,
+        [task = task_]() { task->GetCancellationToken().RequestCancel(); },
+        [task = task_, name = test::MakeCurrentGTestToken("task")]() {
+      return name + " " + ppc::task::DescribeTask(*task);
+    });
     EXPECT_TRUE(task_->Validation());
     EXPECT_TRUE(task_->PreProcessing());
     EXPECT_TRUE(task_->Run());
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief Read-only memory mapping of a file or of a byte range of it.
+/// @details On POSIX systems the file is mapped with mmap(MAP_SHARED), so every process that maps the same file
+///          shares its pages through the page cache and nothing is copied. A range is mapped from the page that
+///          contains its first byte, so ranks mapping disjoint ranges of one file touch only their own pages.
+///          Elsewhere the bytes are read into memory.
+class MappedFile {
+ public:
+  MappedFile() = default;
+
+  /// @brief Maps the whole file at @p path.
+  /// @throws std::runtime_error if the file cannot be opened or mapped.
+  explicit MappedFile(const std::string &path);
+
+  /// @brief Maps @p length bytes of the file at @p path starting at byte @p offset.
+  /// @throws std::runtime_error if the file cannot be opened or mapped or is shorter than @p offset + @p length.
+  MappedFile(const std::string &path, std::size_t offset, std::size_t length);
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  /// @brief Returns the mapped bytes; valid as long as the mapping lives.
+  [[nodiscard]] std::span<const std::byte> Bytes() const noexcept {
+    return {data_, size_};
+  }
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return size_;
+  }
+
+ private:
+  void Map(const std::string &path, std::size_t offset, std::size_t length, bool whole_file);
+  void Unmap() noexcept;
+
+  const std::byte *data_ = nullptr;
+  std::size_t size_ = 0;
+  /// Start and length of the mapping, which begins at a page boundary before data_
+  void *map_base_ = nullptr;
+  std::size_t map_size_ = 0;
+  /// Bytes of the file where they are read instead of mapped
+  std::vector<std::byte> buffer_;
+};
+
+}  // namespace ppc::util
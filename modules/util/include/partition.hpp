@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief Half-open index range [begin, end) assigned to one part (thread or MPI rank).
+struct IndexRange {
+  int64_t begin = 0;
+  int64_t end = 0;
+
+  /// @brief Returns the number of indices in the range.
+  [[nodiscard]] int64_t Size() const {
+    return end - begin;
+  }
+  /// @brief Checks whether the range contains no indices.
+  [[nodiscard]] bool Empty() const {
+    return end <= begin;
+  }
+  bool operator==(const IndexRange &) const = default;
+};
+
+namespace detail {
+
+inline void CheckParts(int64_t n, int parts, int part) {
+  if (n < 0 || parts <= 0 || part < 0 || part >= parts) {
+    throw std::invalid_argument("Invalid partition: need n >= 0 and 0 <= part < parts");
+  }
+}
+
+inline void CheckBlockCyclic(int parts, int64_t block_size) {
+  if (parts <= 0 || block_size <= 0) {
+    throw std::invalid_argument("Invalid block-cyclic distribution: need parts > 0 and block_size > 0");
+  }
+}
+
+}  // namespace detail
+
+// ---------------------------------------------------------------------------------------------------------------
+// Block: one contiguous range per part
+// ---------------------------------------------------------------------------------------------------------------
+
+/// @brief Returns the contiguous block of @p part when [0, @p n) is split into @p parts blocks.
+/// @details The remainder n % parts is spread over the first parts, so block sizes differ by at most one
+///          (unlike n / parts with everything left over going to the last part).
+inline IndexRange BlockRange(int64_t n, int parts, int part) {
+  detail::CheckParts(n, parts, part);
+  const int64_t base = n / parts;
+  const int64_t rest = n % parts;
+  const int64_t begin = (part * base) + std::min<int64_t>(part, rest);
+  return {.begin = begin, .end = begin + base + (part < rest ? 1 : 0)};
+}
+
+/// @brief Returns the part whose BlockRange() contains @p index.
+/// @throws std::invalid_argument If @p index is outside [0, @p n).
+inline int BlockOwner(int64_t n, int parts, int64_t index) {
+  detail::CheckParts(n, parts, 0);
+  if (index < 0 || index >= n) {
+    throw std::invalid_argument("BlockOwner index is out of range");
+  }
+  const int64_t base = n / parts;
+  const int64_t rest = n % parts;
+  const int64_t big = rest * (base + 1);
+  if (index < big) {
+    return static_cast<int>(index / (base + 1));
+  }
+  return static_cast<int>(rest + ((index - big) / base));
+}
+
+/// @brief Returns the BlockRange() sizes of all parts multiplied by @p unit, e.g. as MPI_Scatterv counts.
+/// @param unit Number of elements per index, e.g. the row length when rows are distributed.
+inline std::vector<int> BlockCounts(int64_t n, int parts, int64_t unit = 1) {
+  std::vector<int> counts(static_cast<std::size_t>(parts));
+  for (int part = 0; part < parts; part++) {
+    counts[static_cast<std::size_t>(part)] = static_cast<int>(BlockRange(n, parts, part).Size() * unit);
+  }
+  return counts;
+}
+
+/// @brief Returns the BlockRange() begins of all parts multiplied by @p unit, e.g. as MPI_Scatterv displacements.
+inline std::vector<int> BlockDisplacements(int64_t n, int parts, int64_t unit = 1) {
+  std::vector<int> displs(static_cast<std::size_t>(parts));
+  for (int part = 0; part < parts; part++) {
+    displs[static_cast<std::size_t>(part)] = static_cast<int>(BlockRange(n, parts, part).begin * unit);
+  }
+  return displs;
+}
+
+/// @brief Splits [0, @p n) over @p outer_parts (e.g. ranks) and the block of @p outer_part over @p inner_parts
+///        (e.g. threads of that rank).
+/// @details The inner ranges of one outer part tile its outer range exactly, so a rank-level decomposition can be
+///          refined into a thread-level one without gaps or overlaps.
+inline IndexRange NestedBlockRange(int64_t n, int outer_parts, int outer_part, int inner_parts, int inner_part) {
+  const IndexRange outer = BlockRange(n, outer_parts, outer_part);
+  const IndexRange inner = BlockRange(outer.Size(), inner_parts, inner_part);
+  return {.begin = outer.begin + inner.begin, .end = outer.begin + inner.end};
+}
+
+/// @brief Returns the flat worker id of thread @p thread on rank @p rank when every rank runs @p threads threads.
+inline int FlatWorkerId(int rank, int threads, int thread) {
+  return (rank * threads) + thread;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Cyclic and block-cyclic: indices dealt out round-robin
+// ---------------------------------------------------------------------------------------------------------------
+
+/// @brief Returns the part owning @p index when blocks of @p block_size indices are dealt round-robin.
+/// @details block_size == 1 is the plain cyclic distribution.
+inline int BlockCyclicOwner(int parts, int64_t block_size, int64_t index) {
+  detail::CheckBlockCyclic(parts, block_size);
+  return static_cast<int>((index / block_size) % parts);
+}
+
+/// @brief Returns the ranges owned by @p part under the block-cyclic distribution of [0, @p n).
+inline std::vector<IndexRange> BlockCyclicRanges(int64_t n, int parts, int part, int64_t block_size) {
+  detail::CheckParts(n, parts, part);
+  detail::CheckBlockCyclic(parts, block_size);
+  std::vector<IndexRange> ranges;
+  for (int64_t begin = part * block_size; begin < n; begin += parts * block_size) {
+    ranges.push_back({.begin = begin, .end = std::min(n, begin + block_size)});
+  }
+  return ranges;
+}
+
+/// @brief Returns the number of indices owned by @p part under the block-cyclic distribution of [0, @p n).
+inline int64_t BlockCyclicCount(int64_t n, int parts, int part, int64_t block_size) {
+  detail::CheckParts(n, parts, part);
+  detail::CheckBlockCyclic(parts, block_size);
+  const int64_t round = parts * block_size;
+  const int64_t full_rounds = n / round;
+  const int64_t tail = n % round;
+  return (full_rounds * block_size) + std::clamp<int64_t>(tail - (part * block_size), 0, block_size);
+}
+
+/// @brief Converts an index local to its owner into the global index (block-cyclic distribution).
+inline int64_t BlockCyclicGlobalIndex(int parts, int part, int64_t block_size, int64_t local_index) {
+  detail::CheckBlockCyclic(parts, block_size);
+  const int64_t block = local_index / block_size;
+  return (((block * parts) + part) * block_size) + (local_index % block_size);
+}
+
+/// @brief Converts a global index into the index local to its owner (block-cyclic distribution).
+inline int64_t BlockCyclicLocalIndex(int parts, int64_t block_size, int64_t index) {
+  detail::CheckBlockCyclic(parts, block_size);
+  return ((index / (block_size * parts)) * block_size) + (index % block_size);
+}
+
+/// @brief Cyclic distribution: index i belongs to part i % parts.
+inline int CyclicOwner(int parts, int64_t index) {
+  return BlockCyclicOwner(parts, 1, index);
+}
+
+/// @brief Returns the number of indices owned by @p part under the cyclic distribution of [0, @p n).
+inline int64_t CyclicCount(int64_t n, int parts, int part) {
+  return BlockCyclicCount(n, parts, part, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Cost-weighted: contiguous ranges of roughly equal total cost
+// ---------------------------------------------------------------------------------------------------------------
+
+/// @brief Splits [0, costs.size()) into @p parts contiguous ranges of roughly equal total cost.
+/// @details Boundary k is placed where the prefix cost reaches k / parts of the total, so each part's cost differs
+///          from the ideal share by about the cost of one index at most. Use it when work per index is known to be
+///          uneven (e.g. rows of a sparse or triangular matrix).
+/// @param costs Non-negative cost of every index.
+inline std::vector<IndexRange> WeightedRanges(std::span<const double> costs, int parts) {
+  detail::CheckParts(static_cast<int64_t>(costs.size()), parts, 0);
+  double total = 0.0;
+  for (double cost : costs) {
+    total += cost;
+  }
+  std::vector<IndexRange> ranges(static_cast<std::size_t>(parts));
+  const auto n = static_cast<int64_t>(costs.size());
+  int64_t index = 0;
+  double prefix = 0.0;
+  for (int part = 0; part < parts; part++) {
+    const int64_t begin = index;
+    const double target = total * static_cast<double>(part + 1) / static_cast<double>(parts);
+    if (part == parts - 1) {
+      index = n;
+    } else {
+      while (index < n && prefix + (costs[static_cast<std::size_t>(index)] / 2.0) < target) {
+        prefix += costs[static_cast<std::size_t>(index)];
+        index++;
+      }
+    }
+    ranges[static_cast<std::size_t>(part)] = {.begin = begin, .end = index};
+  }
+  return ranges;
+}
+
+/// @brief WeightedRanges() for costs given as running sums, e.g. the row pointers of a CSR matrix: index i costs
+///        @p prefix[i + 1] - @p prefix[i].
+/// @details Returns the same ranges as WeightedRanges() on the individual costs, but finds every boundary by binary
+///          search, so splitting takes O(parts * log n) instead of O(n).
+/// @param prefix Non-decreasing running sums, one more than the number of indices.
+inline std::vector<IndexRange> PrefixRanges(std::span<const int64_t> prefix, int parts) {
+  if (prefix.empty()) {
+    throw std::invalid_argument("PrefixRanges needs at least one running sum");
+  }
+  const auto n = static_cast<int64_t>(prefix.size()) - 1;
+  detail::CheckParts(n, parts, 0);
+  const auto total = static_cast<double>(prefix.back() - prefix.front());
+  std::vector<IndexRange> ranges(static_cast<std::size_t>(parts));
+  int64_t index = 0;
+  for (int part = 0; part < parts; part++) {
+    const int64_t begin = index;
+    if (part == parts - 1) {
+      index = n;
+    } else {
+      // First index whose midpoint reaches the target, as in WeightedRanges()
+      const double target =
+          (2.0 * static_cast<double>(prefix.front())) + (2.0 * total * static_cast<double>(part + 1) / parts);
+      int64_t low = index;
+      int64_t high = n;
+      while (low < high) {
+        const int64_t mid = low + ((high - low) / 2);
+        const auto i = static_cast<std::size_t>(mid);
+        if (static_cast<double>(prefix[i] + prefix[i + 1]) < target) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+      index = low;
+    }
+    ranges[static_cast<std::size_t>(part)] = {.begin = begin, .end = index};
+  }
+  return ranges;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Guided: shrinking chunks handed out at run time
+// ---------------------------------------------------------------------------------------------------------------
+
+/// @brief Thread-safe dispenser of guided chunks over [begin, end), like OpenMP schedule(guided).
+/// @details Every call to Next() takes remaining / parts indices (at least @p min_chunk), so early chunks are
+///          large and late chunks small enough to even out stragglers. Any number of threads may call Next().
+class GuidedScheduler {
+ public:
+  GuidedScheduler(int64_t begin, int64_t end, int parts, int64_t min_chunk = 1)
+      : end_(end), parts_(std::max(1, parts)), min_chunk_(std::max<int64_t>(1, min_chunk)), next_(begin) {}
+
+  /// @brief Takes the next chunk.
+  /// @param range Receives the chunk.
+  /// @return False when the whole range has been handed out.
+  bool Next(IndexRange &range) {
+    int64_t begin = next_.load(std::memory_order_relaxed);
+    while (begin < end_) {
+      const int64_t chunk = std::max(min_chunk_, (end_ - begin) / parts_);
+      const int64_t end = std::min(end_, begin + chunk);
+      if (next_.compare_exchange_weak(begin, end, std::memory_order_relaxed)) {
+        range = {.begin = begin, .end = end};
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  int64_t end_;
+  int64_t parts_;
+  int64_t min_chunk_;
+  std::atomic<int64_t> next_;
+};
+
+/// @brief Returns the chunk sequence a GuidedScheduler produces when drained by a single caller.
+/// @details Useful to pre-compute a guided decomposition for static assignment, e.g. dealing the chunks to MPI
+///          ranks round-robin.
+inline std::vector<IndexRange> GuidedRanges(int64_t n, int parts, int64_t min_chunk = 1) {
+  GuidedScheduler scheduler(0, n, parts, min_chunk);
+  std::vector<IndexRange> ranges;
+  IndexRange range;
+  while (scheduler.Next(range)) {
+    ranges.push_back(range);
+  }
+  return ranges;
+}
+
+}  // namespace ppc::util
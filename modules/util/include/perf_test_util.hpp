@@ -15,6 +15,7 @@
 #include <utility>
 
 #include "performance/include/performance.hpp"
+#include "runners/include/watchdog.hpp"
 #include "task/include/task.hpp"
 #include "util/include/util.hpp"
 
@@ -57,7 +58,7 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
                task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kSTL ||
                task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kTBB) {
       const auto t0 = std::chrono::high_resolution_clock::now();
-      perf_attrs.current_timer = [&] {
+      perf_attrs.current_timer = [t0] {
         auto now = std::chrono::high_resolution_clock::now();
         auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now - t0).count();
         return static_cast<double>(ns) * 1e-9;
@@ -84,6 +85,13 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
     ppc::performance::PerfAttr perf_attr;
     SetPerfAttributes(perf_attr);
 
+    // Every measured run plus the two warm-up pipelines of TaskRun may take up to the perf time limit
+    const double deadline = ppc::util::GetPerfMaxTime() * static_cast<double>(perf_attr.num_running + 2);
+    ppc::runners::Watchdog watchdog(
+        deadline, deadline * ppc::runners::kWatchdogAbortFactor,
+        [task = task_]() { task->GetCancellationToken().RequestCancel(); },
+        [task = task_, test_name]() { return test_name + " " + ppc::task::DescribeTask(*task); });
+
     if (mode == ppc::performance::PerfResults::TypeOfRunning::kPipeline) {
       perf.PipelineRun(perf_attr);
     } else if (mode == ppc::performance::PerfResults::TypeOfRunning::kTaskRun) {
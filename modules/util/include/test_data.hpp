@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/include/dataset.hpp"
+
+namespace ppc::util {
+
+/// @brief Channels in which the task tests load their images and in which assets are converted (RGB).
+inline constexpr int kDefaultImageChannels = 3;
+
+/// @brief Decoded 8-bit image with interleaved channels, held either in memory or in a raw file mapping.
+/// @details A raw image is a uint8 dataset (see dataset.hpp) of shape {height, width, channels}.
+class ImageData {
+ public:
+  /// @brief Takes the interleaved @p pixels of a @p width x @p height image with @p channels channels.
+  /// @throws std::invalid_argument if the size of @p pixels does not match the dimensions.
+  ImageData(int width, int height, int channels, std::vector<uint8_t> pixels);
+
+  /// @brief Maps the raw image file at @p path without copying the pixels.
+  /// @throws std::runtime_error if the file cannot be mapped or is not a valid raw image.
+  static ImageData MapRaw(const std::string &path);
+
+  ImageData(const ImageData &) = delete;
+  ImageData &operator=(const ImageData &) = delete;
+  /// @brief Moves the pixels; Pixels() of the new image refers to its own storage, the source is left empty.
+  ImageData(ImageData &&other) noexcept;
+  ImageData &operator=(ImageData &&other) noexcept;
+  ~ImageData() = default;
+
+  [[nodiscard]] int Width() const noexcept {
+    return width_;
+  }
+  [[nodiscard]] int Height() const noexcept {
+    return height_;
+  }
+  [[nodiscard]] int Channels() const noexcept {
+    return channels_;
+  }
+  /// @brief Returns the width x height x channels interleaved pixels; valid as long as the image lives.
+  [[nodiscard]] std::span<const uint8_t> Pixels() const noexcept {
+    return pixels_;
+  }
+  /// @brief Returns true if the pixels live in a file mapping rather than in memory of this process.
+  [[nodiscard]] bool IsMapped() const noexcept {
+    return !raw_.Info().shape.empty();
+  }
+
+ private:
+  ImageData() = default;
+
+  void RebindPixels() noexcept;
+
+  int width_ = 0;
+  int height_ = 0;
+  int channels_ = 0;
+  std::span<const uint8_t> pixels_;
+  std::vector<uint8_t> decoded_;
+  Dataset raw_;
+};
+
+/// @brief Writes @p image to @p path as a raw image, creating missing directories.
+/// @throws std::runtime_error if the file cannot be written.
+void WriteRawImage(const std::string &path, const ImageData &image);
+
+/// @brief Decodes the image file at @p path with stb_image, once per process.
+/// @details Decoded images are kept for the lifetime of the process, keyed by path and channel count, so the
+///          SetUp() of every test instance, every repeat and every task of a suite gets the same pixels without
+///          decoding again; only a file that changed since is decoded anew. The returned image must not be modified.
+/// @param channels Channels of the result; the file is converted (e.g. 3 for RGB, 1 for gray).
+/// @throws std::runtime_error if the file cannot be decoded, std::invalid_argument if @p channels is not in [1, 4].
+std::shared_ptr<const ImageData> LoadImageData(const std::string &path, int channels = kDefaultImageChannels);
+
+/// @brief Loads the image tasks/<@p id_path>/data/<@p relative_path>, once per process and if possible once per node.
+/// @details If the build converted the asset (see ConvertTaskImages()) and the raw file is up to date and has
+///          @p channels channels, it is mapped instead of decoded: all ranks of a node share its pages through the
+///          page cache and startup costs no decode at all. Otherwise the asset is decoded with LoadImageData().
+std::shared_ptr<const ImageData> LoadTaskImage(const std::string &id_path, const std::string &relative_path,
+                                               int channels = kDefaultImageChannels);
+
+/// @brief Returns the raw file of tasks/<@p id_path>/data/<@p relative_path> in @p cache_dir.
+std::string GetRawImagePath(const std::string &cache_dir, const std::string &id_path,
+                            const std::string &relative_path);
+
+/// @brief Returns the directory the build writes raw images to, or an empty string if the data cache is disabled.
+std::string GetDataCacheDir();
+
+/// @brief Converts the images in @p tasks_dir/<task>/data into raw images in @p cache_dir.
+/// @details Files stb_image can decode are converted with @p channels channels; raw files newer than their asset
+///          are kept. Run at build time by the ppc_convert_data tool.
+/// @return Number of raw files written.
+int ConvertTaskImages(const std::string &tasks_dir, const std::string &cache_dir,
+                      int channels = kDefaultImageChannels);
+
+/// @brief Returns the place of dataset @p relative_path of task @p id_path in the data cache (which may not exist
+///        yet), or an empty string if the data cache is disabled.
+std::string GetTaskDatasetPath(const std::string &id_path, const std::string &relative_path);
+
+/// @brief Returns the stored 1-D dataset @p relative_path of task @p id_path with element type @p dtype and tag
+///        @p tag, or an empty string if there is none.
+/// @details tasks/<@p id_path>/data/<@p relative_path> takes precedence over GetTaskDatasetPath(). A file with
+///          another element type, shape or tag, or with a damaged header, is not used.
+std::string FindTaskDataset(const std::string &id_path, const std::string &relative_path, DType dtype,
+                            const std::string &tag);
+
+template <DatasetElement T>
+/// @brief Values of a task dataset, held either in a file mapping or, without a data cache, in memory.
+class TaskDataset {
+ public:
+  explicit TaskDataset(Dataset mapped) : mapped_(std::move(mapped)) {}
+  explicit TaskDataset(std::vector<T> values) : values_(std::move(values)) {}
+
+  /// @brief Returns the values; valid as long as the dataset lives.
+  [[nodiscard]] std::span<const T> Values() const {
+    return IsMapped() ? mapped_.template Values<T>() : std::span<const T>(values_);
+  }
+  /// @brief Returns true if the values live in a file mapping rather than in memory of this process.
+  [[nodiscard]] bool IsMapped() const noexcept {
+    return !mapped_.Info().shape.empty();
+  }
+
+ private:
+  Dataset mapped_;
+  std::vector<T> values_;
+};
+
+template <DatasetElement T, typename Make>
+/// @brief Returns the values of the 1-D dataset @p relative_path of task @p id_path, making them with @p make and
+///        storing them in the data cache if there is no such dataset with tag @p tag yet.
+/// @details Lets perf tests read gigabyte inputs from a file instead of generating them in every SetUp(): the first
+///          run writes the dataset, later test instances and runs map it without copying, so all ranks of a node
+///          share its pages. @p tag names how the values are made, e.g. generator and version, and must change
+///          whenever @p make does; a stored dataset with another tag is made and written anew.
+/// @param make Callable returning std::vector<T>.
+/// @throws std::invalid_argument if @p tag does not fit into DatasetHeader::tag.
+TaskDataset<T> LoadTaskDataset(const std::string &id_path, const std::string &relative_path, const std::string &tag,
+                               const Make &make) {
+  const std::string stored = FindTaskDataset(id_path, relative_path, kDTypeOf<T>, tag);
+  if (!stored.empty()) {
+    return TaskDataset<T>(Dataset::Open(stored));
+  }
+  std::vector<T> values = make();
+  const std::string path = GetTaskDatasetPath(id_path, relative_path);
+  if (path.empty()) {
+    return TaskDataset<T>(std::move(values));
+  }
+  WriteDataset<T>(path, values, {}, tag);
+  return TaskDataset<T>(Dataset::Open(path));
+}
+
+/// @brief Drops the decoded images kept by LoadImageData() and LoadTaskImage(); images still in use stay valid.
+void ClearDataCache();
+
+}  // namespace ppc::util
@@ -91,6 +91,8 @@ std::string GetNamespace() {
   }
   name.erase(0, name.find_first_not_of(' '));
 #endif
+  // Template arguments may contain qualified names of their own
+  name = name.substr(0, name.find('<'));
   auto pos = name.rfind("::");
   return (pos != std::string::npos) ? name.substr(0, pos) : std::string{};
 }
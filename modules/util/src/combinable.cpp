@@ -0,0 +1,59 @@
+#include "util/include/combinable.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace ppc::util {
+
+namespace {
+
+class ThreadIndexRegistry {
+ public:
+  std::size_t Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) {
+      return next_++;
+    }
+    const std::size_t index = free_.back();
+    free_.pop_back();
+    return index;
+  }
+
+  void Release(std::size_t index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(index);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::size_t> free_;
+  std::size_t next_ = 0;
+};
+
+ThreadIndexRegistry &Registry() {
+  // Intentionally leaked: threads may release their index after static destruction has started
+  static auto *registry = new ThreadIndexRegistry();
+  return *registry;
+}
+
+struct ThreadIndexHolder {
+  std::size_t index = Registry().Acquire();
+
+  ThreadIndexHolder() = default;
+  ThreadIndexHolder(const ThreadIndexHolder &) = delete;
+  ThreadIndexHolder &operator=(const ThreadIndexHolder &) = delete;
+
+  ~ThreadIndexHolder() {
+    Registry().Release(index);
+  }
+};
+
+}  // namespace
+
+std::size_t GetThreadIndex() {
+  thread_local ThreadIndexHolder holder;
+  return holder.index;
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,209 @@
+#include "util/include/dataset.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "util/include/mapped_file.hpp"
+#include "util/include/partition.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::util {
+
+namespace {
+
+constexpr std::size_t kChecksumChunk = std::size_t{1} << 20U;
+constexpr uint64_t kFnvOffset = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t ChunkHash(std::span<const std::byte> chunk, uint64_t index) {
+  uint64_t hash = kFnvOffset ^ (index * 0x9E3779B97F4A7C15ULL);
+  std::size_t i = 0;
+  for (; i + sizeof(uint64_t) <= chunk.size(); i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, chunk.data() + i, sizeof(word));
+    hash = (hash ^ word) * kFnvPrime;
+  }
+  for (; i < chunk.size(); i++) {
+    hash = (hash ^ static_cast<uint64_t>(chunk[i])) * kFnvPrime;
+  }
+  // Final avalanche, so that the XOR of the chunk hashes mixes all bits
+  hash ^= hash >> 33U;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33U;
+  return hash;
+}
+
+/// Rejects headers that do not describe a dataset the reader understands.
+DatasetInfo ParseHeader(const DatasetHeader &header, std::size_t file_size, const std::string &path) {
+  if (header.magic != kDatasetMagic || header.dtype > static_cast<uint32_t>(DType::kFloat64) || header.dims < 1 ||
+      header.dims > kDatasetMaxDims || header.payload_offset != kDatasetPayloadOffset) {
+    throw std::runtime_error("Dataset: " + path + " is not a valid dataset");
+  }
+  const auto tag_end = std::ranges::find(header.tag, '\0');
+  DatasetInfo info{.dtype = static_cast<DType>(header.dtype),
+                   .shape = {},
+                   .checksum = header.checksum,
+                   .tag = std::string(header.tag.begin(), tag_end)};
+  for (uint32_t dim = 0; dim < header.dims; dim++) {
+    info.shape.push_back(static_cast<int64_t>(header.shape[dim]));
+  }
+  if (info.PayloadBytes() != header.payload_bytes || file_size != kDatasetPayloadOffset + header.payload_bytes) {
+    throw std::runtime_error("Dataset: " + path + " is truncated or its header is corrupt");
+  }
+  return info;
+}
+
+}  // namespace
+
+std::size_t DTypeSize(DType dtype) {
+  switch (dtype) {
+    case DType::kInt8:
+    case DType::kUInt8:
+      return 1;
+    case DType::kInt16:
+    case DType::kUInt16:
+      return 2;
+    case DType::kInt32:
+    case DType::kUInt32:
+    case DType::kFloat32:
+      return 4;
+    case DType::kInt64:
+    case DType::kUInt64:
+    case DType::kFloat64:
+      return 8;
+  }
+  throw std::invalid_argument("DTypeSize: unknown element type");
+}
+
+int64_t DatasetInfo::Elements() const {
+  int64_t elements = 1;
+  for (const int64_t extent : shape) {
+    elements *= extent;
+  }
+  return elements;
+}
+
+int64_t DatasetInfo::RowElements() const {
+  int64_t elements = 1;
+  for (std::size_t dim = 1; dim < shape.size(); dim++) {
+    elements *= shape[dim];
+  }
+  return elements;
+}
+
+uint64_t DatasetChecksum(std::span<const std::byte> payload) {
+  const auto chunks = static_cast<int64_t>((payload.size() + kChecksumChunk - 1) / kChecksumChunk);
+  uint64_t checksum = 0;
+#pragma omp parallel for schedule(static) reduction(^ : checksum) num_threads(GetNumThreads()) default(none) \
+    shared(payload, chunks)
+  for (int64_t chunk = 0; chunk < chunks; chunk++) {
+    const std::size_t begin = static_cast<std::size_t>(chunk) * kChecksumChunk;
+    const std::size_t size = std::min(payload.size() - begin, std::size_t{kChecksumChunk});
+    checksum ^= ChunkHash(payload.subspan(begin, size), static_cast<uint64_t>(chunk));
+  }
+  return checksum;
+}
+
+void WriteDataset(const std::string &path, DType dtype, const std::vector<int64_t> &shape,
+                  std::span<const std::byte> payload, const std::string &tag) {
+  if (shape.empty() || std::cmp_greater(shape.size(), kDatasetMaxDims) ||
+      std::ranges::any_of(shape, [](int64_t extent) { return extent < 0; })) {
+    throw std::invalid_argument("WriteDataset: the shape must have 1 to kDatasetMaxDims non-negative extents");
+  }
+  if (tag.size() >= kDatasetTagSize || tag.find('\0') != std::string::npos) {
+    throw std::invalid_argument("WriteDataset: the tag must be shorter than kDatasetTagSize and contain no NUL");
+  }
+  const DatasetInfo info{.dtype = dtype, .shape = shape, .checksum = DatasetChecksum(payload), .tag = tag};
+  if (info.PayloadBytes() != payload.size()) {
+    throw std::invalid_argument("WriteDataset: the payload size does not match the shape");
+  }
+  DatasetHeader header{.magic = kDatasetMagic,
+                       .dtype = static_cast<uint32_t>(dtype),
+                       .dims = static_cast<uint32_t>(shape.size()),
+                       .shape = {},
+                       .payload_offset = kDatasetPayloadOffset,
+                       .payload_bytes = payload.size(),
+                       .checksum = info.checksum,
+                       .tag = {}};
+  std::ranges::copy(shape, header.shape.begin());
+  std::ranges::copy(tag, header.tag.begin());
+  std::vector<char> prefix(kDatasetPayloadOffset, 0);
+  std::memcpy(prefix.data(), &header, sizeof(header));
+
+  const std::filesystem::path target(path);
+  if (target.has_parent_path()) {
+    std::filesystem::create_directories(target.parent_path());
+  }
+  // Unique per writer, so that ranks writing the same dataset do not share a temporary file
+  std::filesystem::path temporary = target;
+  temporary += ".tmp" + std::to_string(std::random_device{}());
+  try {
+    {
+      std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+      file.write(prefix.data(), static_cast<std::streamsize>(prefix.size()));
+      file.write(reinterpret_cast<const char *>(payload.data()), static_cast<std::streamsize>(payload.size()));
+      if (!file) {
+        throw std::runtime_error("WriteDataset: cannot write " + temporary.string());
+      }
+    }
+    std::filesystem::rename(temporary, target);
+  } catch (...) {
+    // A full disk or a failed rename must not leave a temporary file of the size of the payload behind
+    std::error_code ignored;
+    std::filesystem::remove(temporary, ignored);
+    throw;
+  }
+}
+
+DatasetInfo ReadDatasetInfo(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  DatasetHeader header{};
+  if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+    throw std::runtime_error("Dataset: cannot read the header of " + path);
+  }
+  return ParseHeader(header, static_cast<std::size_t>(std::filesystem::file_size(path)), path);
+}
+
+bool VerifyDataset(const std::string &path) {
+  const Dataset dataset = Dataset::Open(path);
+  return DatasetChecksum(dataset.Bytes()) == dataset.Info().checksum;
+}
+
+Dataset Dataset::Open(const std::string &path) {
+  return OpenRows(path, 0, ReadDatasetInfo(path).shape.front());
+}
+
+Dataset Dataset::OpenRows(const std::string &path, int64_t first_row, int64_t rows) {
+  Dataset dataset;
+  dataset.info_ = ReadDatasetInfo(path);
+  if (first_row < 0 || rows < 0 || first_row + rows > dataset.info_.shape.front()) {
+    throw std::invalid_argument("Dataset::OpenRows: rows are out of range");
+  }
+  const std::size_t row_bytes = static_cast<std::size_t>(dataset.info_.RowElements()) * DTypeSize(dataset.info_.dtype);
+  dataset.first_row_ = first_row;
+  dataset.rows_ = rows;
+  dataset.mapping_ = MappedFile(path, kDatasetPayloadOffset + (static_cast<std::size_t>(first_row) * row_bytes),
+                                static_cast<std::size_t>(rows) * row_bytes);
+  return dataset;
+}
+
+Dataset Dataset::OpenBlock(const std::string &path, int parts, int part) {
+  const IndexRange range = BlockRange(ReadDatasetInfo(path).shape.front(), parts, part);
+  return OpenRows(path, range.begin, range.Size());
+}
+
+}  // namespace ppc::util
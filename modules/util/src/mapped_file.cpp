@@ -0,0 +1,140 @@
+#include "util/include/mapped_file.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#else
+#  include <filesystem>
+#  include <fstream>
+#  include <ios>
+#endif
+
+namespace ppc::util {
+
+MappedFile::MappedFile(const std::string &path) {
+  Map(path, 0, 0, true);
+}
+
+MappedFile::MappedFile(const std::string &path, std::size_t offset, std::size_t length) {
+  Map(path, offset, length, false);
+}
+
+#if !defined(_WIN32)
+
+void MappedFile::Map(const std::string &path, std::size_t offset, std::size_t length, bool whole_file) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("MappedFile: cannot open " + path);
+  }
+  struct stat info {};
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    throw std::runtime_error("MappedFile: cannot stat " + path);
+  }
+  const auto file_size = static_cast<std::size_t>(info.st_size);
+  if (whole_file) {
+    length = file_size;
+  }
+  if (offset > file_size || length > file_size - offset) {
+    ::close(fd);
+    throw std::runtime_error("MappedFile: range is past the end of " + path);
+  }
+  if (length > 0) {
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const std::size_t map_offset = offset - (offset % page);
+    map_size_ = length + (offset - map_offset);
+    map_base_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(map_offset));
+    if (map_base_ == MAP_FAILED) {
+      map_base_ = nullptr;
+      map_size_ = 0;
+      ::close(fd);
+      throw std::runtime_error("MappedFile: cannot map " + path);
+    }
+    data_ = static_cast<const std::byte *>(map_base_) + (offset - map_offset);
+    size_ = length;
+  }
+  // The mapping keeps the file referenced
+  ::close(fd);
+}
+
+void MappedFile::Unmap() noexcept {
+  if (map_base_ != nullptr) {
+    ::munmap(map_base_, map_size_);
+  }
+  map_base_ = nullptr;
+  map_size_ = 0;
+  data_ = nullptr;
+  size_ = 0;
+  buffer_.clear();
+}
+
+#else
+
+void MappedFile::Map(const std::string &path, std::size_t offset, std::size_t length, bool whole_file) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("MappedFile: cannot open " + path);
+  }
+  const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(path));
+  if (whole_file) {
+    length = file_size;
+  }
+  if (offset > file_size || length > file_size - offset) {
+    throw std::runtime_error("MappedFile: range is past the end of " + path);
+  }
+  buffer_.resize(length);
+  file.seekg(static_cast<std::streamoff>(offset));
+  file.read(reinterpret_cast<char *>(buffer_.data()), static_cast<std::streamsize>(length));
+  if (!file) {
+    throw std::runtime_error("MappedFile: cannot read " + path);
+  }
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+}
+
+void MappedFile::Unmap() noexcept {
+  data_ = nullptr;
+  size_ = 0;
+  buffer_.clear();
+}
+
+#endif
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      map_base_(std::exchange(other.map_base_, nullptr)),
+      map_size_(std::exchange(other.map_size_, 0)),
+      buffer_(std::move(other.buffer_)) {
+  if (!buffer_.empty()) {
+    data_ = buffer_.data();
+  }
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    Unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    map_base_ = std::exchange(other.map_base_, nullptr);
+    map_size_ = std::exchange(other.map_size_, 0);
+    buffer_ = std::move(other.buffer_);
+    if (!buffer_.empty()) {
+      data_ = buffer_.data();
+    }
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() {
+  Unmap();
+}
+
+}  // namespace ppc::util
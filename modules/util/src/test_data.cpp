@@ -0,0 +1,248 @@
+#include "util/include/test_data.hpp"
+
+#include <stb/stb_image.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "util/include/dataset.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::util {
+
+namespace {
+
+class ImageCache {
+ public:
+  /// Returns the image cached under @p key, loading it again if @p file changed since it was loaded.
+  std::shared_ptr<const ImageData> Get(const std::string &key, const std::filesystem::path &file, const auto &load) {
+    std::error_code error;
+    const auto write_time = std::filesystem::last_write_time(file, error);
+    // Loading under the lock keeps concurrent first requests of an asset from decoding it twice
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &entry = entries_[key];
+    if (entry.image == nullptr || error || entry.write_time != write_time) {
+      entry.image = std::make_shared<const ImageData>(load());
+      entry.write_time = write_time;
+    }
+    return entry.image;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+ private:
+  struct Entry {
+    std::filesystem::file_time_type write_time;
+    std::shared_ptr<const ImageData> image;
+  };
+
+  std::mutex mutex_;
+  std::map<std::string, Entry> entries_;
+};
+
+ImageCache &GetImageCache() {
+  static ImageCache cache;
+  return cache;
+}
+
+std::size_t PixelBytes(int width, int height, int channels) {
+  return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * static_cast<std::size_t>(channels);
+}
+
+ImageData Decode(const std::string &path, int channels) {
+  int width = 0;
+  int height = 0;
+  int file_channels = 0;
+  const std::unique_ptr<uint8_t, decltype(&stbi_image_free)> data(
+      stbi_load(path.c_str(), &width, &height, &file_channels, channels), &stbi_image_free);
+  if (data == nullptr) {
+    throw std::runtime_error("Failed to load image " + path + ": " + std::string(stbi_failure_reason()));
+  }
+  const std::size_t size = PixelBytes(width, height, channels);
+  return {width, height, channels, std::vector<uint8_t>(data.get(), data.get() + size)};
+}
+
+/// Raw files older than their asset are stale.
+bool IsUpToDate(const std::filesystem::path &raw, const std::filesystem::path &asset) {
+  std::error_code error;
+  const auto raw_time = std::filesystem::last_write_time(raw, error);
+  if (error) {
+    return false;
+  }
+  const auto asset_time = std::filesystem::last_write_time(asset, error);
+  return !error && raw_time >= asset_time;
+}
+
+void CheckChannels(int channels) {
+  if (channels < 1 || channels > 4) {
+    throw std::invalid_argument("LoadImageData: channels must be in [1, 4]");
+  }
+}
+
+}  // namespace
+
+ImageData::ImageData(int width, int height, int channels, std::vector<uint8_t> pixels)
+    : width_(width), height_(height), channels_(channels), decoded_(std::move(pixels)) {
+  if (width < 0 || height < 0 || channels < 1 || decoded_.size() != PixelBytes(width, height, channels)) {
+    throw std::invalid_argument("ImageData: size does not match the dimensions");
+  }
+  pixels_ = decoded_;
+}
+
+ImageData::ImageData(ImageData &&other) noexcept
+    : width_(std::exchange(other.width_, 0)),
+      height_(std::exchange(other.height_, 0)),
+      channels_(std::exchange(other.channels_, 0)),
+      pixels_(std::exchange(other.pixels_, {})),
+      decoded_(std::move(other.decoded_)),
+      raw_(std::move(other.raw_)) {
+  RebindPixels();
+}
+
+ImageData &ImageData::operator=(ImageData &&other) noexcept {
+  if (this != &other) {
+    width_ = std::exchange(other.width_, 0);
+    height_ = std::exchange(other.height_, 0);
+    channels_ = std::exchange(other.channels_, 0);
+    pixels_ = std::exchange(other.pixels_, {});
+    decoded_ = std::move(other.decoded_);
+    raw_ = std::move(other.raw_);
+    RebindPixels();
+  }
+  return *this;
+}
+
+void ImageData::RebindPixels() noexcept {
+  // A mapping keeps its address when moved, decoded pixels are only guaranteed to live in decoded_
+  if (!IsMapped()) {
+    pixels_ = decoded_;
+  }
+}
+
+ImageData ImageData::MapRaw(const std::string &path) {
+  ImageData image;
+  image.raw_ = Dataset::Open(path);
+  const auto &shape = image.raw_.Info().shape;
+  if (image.raw_.Info().dtype != DType::kUInt8 || shape.size() != 3 || shape[2] < 1 || shape[2] > 4) {
+    throw std::runtime_error("ImageData::MapRaw: " + path + " is not a raw image");
+  }
+  image.height_ = static_cast<int>(shape[0]);
+  image.width_ = static_cast<int>(shape[1]);
+  image.channels_ = static_cast<int>(shape[2]);
+  image.pixels_ = image.raw_.Values<uint8_t>();
+  return image;
+}
+
+void WriteRawImage(const std::string &path, const ImageData &image) {
+  WriteDataset<uint8_t>(path, image.Pixels(), {image.Height(), image.Width(), image.Channels()});
+}
+
+std::shared_ptr<const ImageData> LoadImageData(const std::string &path, int channels) {
+  CheckChannels(channels);
+  return GetImageCache().Get(path + "#" + std::to_string(channels), path, [&] { return Decode(path, channels); });
+}
+
+std::shared_ptr<const ImageData> LoadTaskImage(const std::string &id_path, const std::string &relative_path,
+                                               int channels) {
+  CheckChannels(channels);
+  const std::string asset = GetAbsoluteTaskPath(id_path, relative_path);
+  const std::string cache_dir = GetDataCacheDir();
+  if (!cache_dir.empty()) {
+    const std::string raw = GetRawImagePath(cache_dir, id_path, relative_path);
+    if (IsUpToDate(raw, asset)) {
+      auto image = GetImageCache().Get(raw, raw, [&] { return ImageData::MapRaw(raw); });
+      if (image->Channels() == channels) {
+        return image;
+      }
+    }
+  }
+  return LoadImageData(asset, channels);
+}
+
+std::string GetRawImagePath(const std::string &cache_dir, const std::string &id_path,
+                            const std::string &relative_path) {
+  std::filesystem::path raw = std::filesystem::path(cache_dir) / id_path / relative_path;
+  raw += ".raw";
+  return raw.string();
+}
+
+std::string GetTaskDatasetPath(const std::string &id_path, const std::string &relative_path) {
+  const std::string cache_dir = GetDataCacheDir();
+  if (cache_dir.empty()) {
+    return {};
+  }
+  return (std::filesystem::path(cache_dir) / id_path / relative_path).string();
+}
+
+std::string FindTaskDataset(const std::string &id_path, const std::string &relative_path, DType dtype,
+                            const std::string &tag) {
+  for (const std::string &path :
+       {GetAbsoluteTaskPath(id_path, relative_path), GetTaskDatasetPath(id_path, relative_path)}) {
+    if (path.empty() || !std::filesystem::exists(path)) {
+      continue;
+    }
+    try {
+      const DatasetInfo info = ReadDatasetInfo(path);
+      if (info.dtype == dtype && info.shape.size() == 1 && info.tag == tag) {
+        return path;
+      }
+    } catch (const std::runtime_error &) {
+      // A damaged or foreign file is replaced like a stale one
+    }
+  }
+  return {};
+}
+
+std::string GetDataCacheDir() {
+#ifdef PPC_PATH_TO_DATA_CACHE
+  return PPC_PATH_TO_DATA_CACHE;
+#else
+  return {};
+#endif
+}
+
+int ConvertTaskImages(const std::string &tasks_dir, const std::string &cache_dir, int channels) {
+  CheckChannels(channels);
+  int written = 0;
+  for (const auto &task : std::filesystem::directory_iterator(tasks_dir)) {
+    const std::filesystem::path data_dir = task.path() / "data";
+    if (!std::filesystem::is_directory(data_dir)) {
+      continue;
+    }
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(data_dir)) {
+      const std::string asset = entry.path().string();
+      int width = 0;
+      int height = 0;
+      int file_channels = 0;
+      if (!entry.is_regular_file() || stbi_info(asset.c_str(), &width, &height, &file_channels) == 0) {
+        continue;
+      }
+      const std::string relative_path = std::filesystem::relative(entry.path(), data_dir).generic_string();
+      const std::string raw = GetRawImagePath(cache_dir, task.path().filename().string(), relative_path);
+      if (IsUpToDate(raw, entry.path())) {
+        continue;
+      }
+      WriteRawImage(raw, Decode(asset, channels));
+      written++;
+    }
+  }
+  return written;
+}
+
+void ClearDataCache() {
+  GetImageCache().Clear();
+}
+
+}  // namespace ppc::util
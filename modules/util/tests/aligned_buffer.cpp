@@ -0,0 +1,93 @@
+#include "util/include/aligned_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+
+#include "util/include/cache_line.hpp"
+#include "util/include/util.hpp"
+
+using ppc::util::AlignedBuffer;
+using ppc::util::FirstTouch;
+
+TEST(AlignedBufferTests, SmallBufferIsCacheLineAligned) {
+  AlignedBuffer<int> buf(100, 7);
+  EXPECT_EQ(buf.Size(), 100U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.Data()) % ppc::util::kCacheLineSize, 0U);
+  for (int v : buf) {
+    EXPECT_EQ(v, 7);
+  }
+}
+
+TEST(AlignedBufferTests, LargeBufferIsHugePageAligned) {
+  const std::size_t count = ppc::util::kHugePageSize / sizeof(double) + 3;
+  AlignedBuffer<double> buf(count, 1.0, FirstTouch::kTBB);
+  EXPECT_EQ(buf.Alignment(), ppc::util::kHugePageSize);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.Data()) % ppc::util::kHugePageSize, 0U);
+  EXPECT_DOUBLE_EQ(std::accumulate(buf.begin(), buf.end(), 0.0), static_cast<double>(count));
+}
+
+TEST(AlignedBufferTests, AllFirstTouchPoliciesInitializeEveryElement) {
+  for (auto policy : {FirstTouch::kSequential, FirstTouch::kOMP, FirstTouch::kTBB, FirstTouch::kSTL}) {
+    AlignedBuffer<int64_t> buf(1001, 2, policy);
+    EXPECT_EQ(std::accumulate(buf.begin(), buf.end(), int64_t{0}), 2002);
+    EXPECT_EQ(buf.GetFirstTouch(), policy);
+  }
+}
+
+TEST(AlignedBufferTests, ParallelFirstTouchUsesOneBlockPerThread) {
+  for (auto policy : {FirstTouch::kOMP, FirstTouch::kTBB, FirstTouch::kSTL}) {
+    std::atomic<int> blocks{0};
+    std::atomic<std::size_t> elements{0};
+    AlignedBuffer<int>::ParallelBlocks(1000, policy, [&](std::size_t begin, std::size_t end) {
+      blocks++;
+      elements += end - begin;
+    });
+    EXPECT_EQ(blocks.load(), ppc::util::GetNumThreads());
+    EXPECT_EQ(elements.load(), 1000U);
+  }
+}
+
+TEST(AlignedBufferTests, CopyAssignmentKeepsCapacity) {
+  AlignedBuffer<int> big(64, 1);
+  const int *old_data = big.Data();
+  AlignedBuffer<int> small(16, 5);
+  big = small;
+  EXPECT_EQ(big.Data(), old_data);
+  EXPECT_EQ(big.Size(), 16U);
+  EXPECT_EQ(big.Capacity(), 64U);
+  EXPECT_EQ(big, small);
+}
+
+TEST(AlignedBufferTests, MoveLeavesSourceEmpty) {
+  AlignedBuffer<float> src(10, 3.0F);
+  const float *data = src.Data();
+  AlignedBuffer<float> dst(std::move(src));
+  EXPECT_EQ(dst.Data(), data);
+  EXPECT_EQ(dst.Size(), 10U);
+  EXPECT_TRUE(src.Empty());  // NOLINT(bugprone-use-after-move)
+}
+
+TEST(AlignedBufferTests, ResizePreservesPrefixAndZeroesTail) {
+  AlignedBuffer<int> buf(4, 9);
+  buf.Resize(10);
+  EXPECT_EQ(buf.Size(), 10U);
+  for (std::size_t i = 0; i < buf.Size(); i++) {
+    EXPECT_EQ(buf[i], i < 4 ? 9 : 0);
+  }
+  buf.Resize(2);
+  EXPECT_EQ(buf.Size(), 2U);
+  EXPECT_GE(buf.Capacity(), 10U);
+}
+
+TEST(AlignedBufferTests, ConvertsToSpan) {
+  AlignedBuffer<int> buf(5, 1);
+  std::span<const int> view = std::as_const(buf);
+  EXPECT_EQ(view.size(), 5U);
+  EXPECT_EQ(view.data(), buf.Data());
+}
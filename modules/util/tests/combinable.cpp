@@ -0,0 +1,116 @@
+#include "util/include/combinable.hpp"
+
+#include <gtest/gtest.h>
+#include <omp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "oneapi/tbb/parallel_for.h"
+#include "util/include/cache_line.hpp"
+
+TEST(CombinableTest, EmptyCombineReturnsIdentity) {
+  ppc::util::Combinable<int> counter(7);
+  EXPECT_EQ(counter.Combine(std::plus<>()), 7);
+}
+
+TEST(CombinableTest, SumsFromStdThreads) {
+  ppc::util::Combinable<int64_t> sum;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&sum]() {
+      for (int i = 0; i < 1000; i++) {
+        sum.Local()++;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(sum.Combine(std::plus<>()), 8000);
+}
+
+TEST(CombinableTest, SumsFromOpenMPWithThreadNumber) {
+  ppc::util::Combinable<int> counter;
+#pragma omp parallel num_threads(4) default(none) shared(counter)
+  counter.Local(static_cast<std::size_t>(omp_get_thread_num()))++;
+  EXPECT_EQ(counter.Combine(std::plus<>()), 4);
+  std::size_t used = 0;
+  counter.CombineEach([&used](int value) {
+    EXPECT_EQ(value, 1);
+    used++;
+  });
+  EXPECT_EQ(used, 4U);
+}
+
+TEST(CombinableTest, SumsFromTBB) {
+  ppc::util::Combinable<int> counter;
+  tbb::parallel_for(0, 10000, [&](int /*i*/) { counter.Local()++; });
+  EXPECT_EQ(counter.Combine(std::plus<>()), 10000);
+}
+
+TEST(CombinableTest, LocalIsStablePerThread) {
+  ppc::util::Combinable<int> value;
+  int &first = value.Local();
+  first = 5;
+  EXPECT_EQ(&first, &value.Local());
+  EXPECT_EQ(value.Local(), 5);
+}
+
+TEST(CombinableTest, LargeIndicesGrowTable) {
+  ppc::util::Combinable<int> value;
+  for (std::size_t i = 0; i < 300; i += 7) {
+    value.Local(i) = 1;
+  }
+  int &probe = value.Local(0);
+  value.Local(100000) = 1;
+  EXPECT_EQ(&probe, &value.Local(0));
+  EXPECT_EQ(value.Combine(std::plus<>()), 44);
+}
+
+TEST(CombinableTest, SlotsDoNotShareCacheLines) {
+  ppc::util::Combinable<char> value;
+  const auto a = reinterpret_cast<std::uintptr_t>(&value.Local(1));
+  const auto b = reinterpret_cast<std::uintptr_t>(&value.Local(2));
+  EXPECT_GE(b > a ? b - a : a - b, ppc::util::kCacheLineSize);
+  EXPECT_EQ(a % ppc::util::kCacheLineSize, 0U);
+}
+
+TEST(CombinableTest, ClearRestartsFromIdentity) {
+  ppc::util::Combinable<int> value(1);
+  value.Local() += 10;
+  value.Clear();
+  EXPECT_EQ(value.Combine(std::plus<>()), 1);
+  value.Local() += 2;
+  EXPECT_EQ(value.Combine(std::plus<>()), 3);
+}
+
+TEST(CombinableTest, CombineFoldsOnlyUsedSlots) {
+  ppc::util::Combinable<int> value(1);
+  value.Local(0) += 1;
+  value.Local(5) += 2;
+  value.Local(9) += 3;
+  int calls = 0;
+  const int product = value.Combine([&calls](int a, int b) {
+    calls++;
+    return a * b;
+  });
+  EXPECT_EQ(product, 2 * 3 * 4);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(CombinableTest, ThreadIndicesAreUniqueAndReused) {
+  std::set<std::size_t> seen;
+  for (int round = 0; round < 20; round++) {
+    std::size_t index = 0;
+    std::thread([&index]() { index = ppc::util::GetThreadIndex(); }).join();
+    seen.insert(index);
+  }
+  // Sequential short-lived threads keep getting recycled indices
+  EXPECT_LE(seen.size(), 2U);
+  EXPECT_EQ(ppc::util::GetThreadIndex(), ppc::util::GetThreadIndex());
+}
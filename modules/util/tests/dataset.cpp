@@ -0,0 +1,149 @@
+#include "util/include/dataset.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "util/include/mapped_file.hpp"
+
+namespace {
+
+std::string TempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}  // namespace
+
+TEST(DatasetTest, DTypeMatchesElementType) {
+  EXPECT_EQ(ppc::util::kDTypeOf<int8_t>, ppc::util::DType::kInt8);
+  EXPECT_EQ(ppc::util::kDTypeOf<uint16_t>, ppc::util::DType::kUInt16);
+  EXPECT_EQ(ppc::util::kDTypeOf<int64_t>, ppc::util::DType::kInt64);
+  EXPECT_EQ(ppc::util::kDTypeOf<float>, ppc::util::DType::kFloat32);
+  EXPECT_EQ(ppc::util::kDTypeOf<double>, ppc::util::DType::kFloat64);
+  EXPECT_EQ(ppc::util::DTypeSize(ppc::util::DType::kUInt32), 4U);
+  EXPECT_EQ(ppc::util::DTypeSize(ppc::util::DType::kFloat64), 8U);
+}
+
+TEST(DatasetTest, RoundTripsValuesAndShape) {
+  const auto path = TempPath("ppc_dataset_round_trip.ppcd");
+  std::vector<float> values(3 * 5);
+  std::iota(values.begin(), values.end(), 0.5F);
+  ppc::util::WriteDataset<float>(path, values, {3, 5});
+
+  const auto info = ppc::util::ReadDatasetInfo(path);
+  EXPECT_EQ(info.dtype, ppc::util::DType::kFloat32);
+  EXPECT_EQ(info.shape, std::vector<int64_t>({3, 5}));
+  EXPECT_EQ(info.RowElements(), 5);
+  EXPECT_EQ(info.checksum, ppc::util::DatasetChecksum(std::as_bytes(std::span<const float>(values))));
+  EXPECT_EQ(std::filesystem::file_size(path), ppc::util::kDatasetPayloadOffset + (values.size() * sizeof(float)));
+
+  const auto dataset = ppc::util::Dataset::Open(path);
+  const auto mapped = dataset.Values<float>();
+  EXPECT_EQ(std::vector<float>(mapped.begin(), mapped.end()), values);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) % 64, 0U);
+  EXPECT_THROW((void)dataset.Values<double>(), std::invalid_argument);
+  EXPECT_TRUE(ppc::util::VerifyDataset(path));
+  std::filesystem::remove(path);
+}
+
+TEST(DatasetTest, BlocksCoverAllRows) {
+  const auto path = TempPath("ppc_dataset_blocks.ppcd");
+  constexpr int64_t kRows = 1000;
+  constexpr int64_t kCols = 3;
+  std::vector<int64_t> values(kRows * kCols);
+  std::iota(values.begin(), values.end(), 0);
+  ppc::util::WriteDataset<int64_t>(path, values, {kRows, kCols});
+
+  for (int parts = 1; parts <= 7; parts++) {
+    std::vector<int64_t> joined;
+    for (int part = 0; part < parts; part++) {
+      const auto block = ppc::util::Dataset::OpenBlock(path, parts, part);
+      EXPECT_EQ(block.FirstRow() * kCols, static_cast<int64_t>(joined.size()));
+      const auto rows = block.Values<int64_t>();
+      EXPECT_EQ(static_cast<int64_t>(rows.size()), block.Rows() * kCols);
+      joined.insert(joined.end(), rows.begin(), rows.end());
+    }
+    EXPECT_EQ(joined, values);
+  }
+  EXPECT_THROW((void)ppc::util::Dataset::OpenRows(path, 990, 11), std::invalid_argument);
+  EXPECT_TRUE(ppc::util::Dataset::OpenRows(path, kRows, 0).Values<int64_t>().empty());
+  std::filesystem::remove(path);
+}
+
+TEST(DatasetTest, DetectsCorruption) {
+  const auto path = TempPath("ppc_dataset_corrupt.ppcd");
+  const std::vector<uint8_t> values(3000, 7);
+  ppc::util::WriteDataset<uint8_t>(path, values);
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(ppc::util::kDatasetPayloadOffset + 1234));
+    file.put(8);
+  }
+  EXPECT_FALSE(ppc::util::VerifyDataset(path));
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  EXPECT_THROW((void)ppc::util::Dataset::Open(path), std::runtime_error);
+  std::filesystem::remove(path);
+  EXPECT_THROW((void)ppc::util::ReadDatasetInfo(path), std::runtime_error);
+}
+
+TEST(DatasetTest, RejectsInvalidShapes) {
+  const auto path = TempPath("ppc_dataset_invalid.ppcd");
+  const std::vector<int32_t> values(6);
+  EXPECT_THROW(ppc::util::WriteDataset<int32_t>(path, values, {4, 2}), std::invalid_argument);
+  EXPECT_THROW(ppc::util::WriteDataset<int32_t>(path, values, {1, 1, 1, 2, 3}), std::invalid_argument);
+  EXPECT_THROW(ppc::util::WriteDataset<int32_t>(path, values, {-6}), std::invalid_argument);
+  EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(DatasetTest, RoundTripsTag) {
+  const auto path = TempPath("ppc_dataset_tag.ppcd");
+  const std::vector<int32_t> values(6);
+  ppc::util::WriteDataset<int32_t>(path, values);
+  EXPECT_TRUE(ppc::util::ReadDatasetInfo(path).tag.empty());
+  ppc::util::WriteDataset<int32_t>(path, values, {}, "generator.v2");
+  EXPECT_EQ(ppc::util::ReadDatasetInfo(path).tag, "generator.v2");
+  EXPECT_EQ(ppc::util::Dataset::Open(path).Info().tag, "generator.v2");
+  const std::string too_long(ppc::util::kDatasetTagSize, 'x');
+  EXPECT_THROW(ppc::util::WriteDataset<int32_t>(path, values, {}, too_long), std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
+TEST(DatasetTest, FailedWriteLeavesNoTemporaryFile) {
+  const auto dir = std::filesystem::temp_directory_path() / "ppc_dataset_failed_write";
+  std::filesystem::remove_all(dir);
+  // The target is a non-empty directory, so renaming the written file onto it fails
+  std::filesystem::create_directories(dir / "target.ppcd" / "occupied");
+  const std::vector<int32_t> values(6);
+  EXPECT_ANY_THROW(ppc::util::WriteDataset<int32_t>((dir / "target.ppcd").string(), values));
+  int files = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+    files += entry.is_regular_file() ? 1 : 0;
+  }
+  EXPECT_EQ(files, 0);
+  std::filesystem::remove_all(dir);
+}
+
+TEST(DatasetTest, MappedFileMapsRangesAcrossPages) {
+  const auto path = TempPath("ppc_mapped_file_range.bin");
+  std::vector<uint8_t> bytes(20000);
+  std::iota(bytes.begin(), bytes.end(), uint8_t{0});
+  {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  }
+  const ppc::util::MappedFile range(path, 5000, 9000);
+  ASSERT_EQ(range.Size(), 9000U);
+  EXPECT_EQ(static_cast<uint8_t>(range.Bytes()[0]), bytes[5000]);
+  EXPECT_EQ(static_cast<uint8_t>(range.Bytes()[8999]), bytes[13999]);
+  EXPECT_THROW(ppc::util::MappedFile(path, 19000, 2000), std::runtime_error);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,200 @@
+#include "util/include/partition.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Checks that the given ranges tile [0, n) in order without gaps or overlaps
+void ExpectTiles(const std::vector<ppc::util::IndexRange> &ranges, int64_t n) {
+  int64_t expected_begin = 0;
+  for (const auto &range : ranges) {
+    EXPECT_EQ(range.begin, expected_begin);
+    EXPECT_GE(range.end, range.begin);
+    expected_begin = range.end;
+  }
+  EXPECT_EQ(expected_begin, n);
+}
+
+}  // namespace
+
+TEST(PartitionTest, BlockRangeSpreadsRemainder) {
+  std::vector<ppc::util::IndexRange> ranges;
+  for (int part = 0; part < 4; part++) {
+    ranges.push_back(ppc::util::BlockRange(10, 4, part));
+  }
+  ExpectTiles(ranges, 10);
+  EXPECT_EQ(ranges[0].Size(), 3);
+  EXPECT_EQ(ranges[1].Size(), 3);
+  EXPECT_EQ(ranges[2].Size(), 2);
+  EXPECT_EQ(ranges[3].Size(), 2);
+}
+
+TEST(PartitionTest, BlockRangeWithMorePartsThanIndices) {
+  EXPECT_EQ(ppc::util::BlockRange(2, 5, 1).Size(), 1);
+  EXPECT_TRUE(ppc::util::BlockRange(2, 5, 4).Empty());
+}
+
+TEST(PartitionTest, BlockRangeRejectsInvalidArguments) {
+  EXPECT_THROW((void)ppc::util::BlockRange(10, 0, 0), std::invalid_argument);
+  EXPECT_THROW((void)ppc::util::BlockRange(10, 4, 4), std::invalid_argument);
+  EXPECT_THROW((void)ppc::util::BlockRange(-1, 4, 0), std::invalid_argument);
+}
+
+TEST(PartitionTest, BlockOwnerMatchesBlockRange) {
+  for (int64_t n : {0, 1, 7, 64, 101}) {
+    for (int parts : {1, 3, 8, 13}) {
+      for (int part = 0; part < parts; part++) {
+        const auto range = ppc::util::BlockRange(n, parts, part);
+        for (int64_t i = range.begin; i < range.end; i++) {
+          EXPECT_EQ(ppc::util::BlockOwner(n, parts, i), part);
+        }
+      }
+    }
+  }
+}
+
+TEST(PartitionTest, BlockOwnerRejectsIndexOutsideRange) {
+  EXPECT_THROW((void)ppc::util::BlockOwner(2, 5, 2), std::invalid_argument);
+  EXPECT_THROW((void)ppc::util::BlockOwner(0, 3, 0), std::invalid_argument);
+  EXPECT_THROW((void)ppc::util::BlockOwner(10, 3, -1), std::invalid_argument);
+  EXPECT_EQ(ppc::util::BlockOwner(2, 5, 1), 1);
+}
+
+TEST(PartitionTest, CountsAndDisplacementsForScatterv) {
+  EXPECT_EQ(ppc::util::BlockCounts(7, 3, 4), (std::vector<int>{12, 8, 8}));
+  EXPECT_EQ(ppc::util::BlockDisplacements(7, 3, 4), (std::vector<int>{0, 12, 20}));
+}
+
+TEST(PartitionTest, NestedBlockRangeTilesOuterRange) {
+  const int64_t n = 1003;
+  std::vector<ppc::util::IndexRange> ranges;
+  for (int rank = 0; rank < 3; rank++) {
+    const auto outer = ppc::util::BlockRange(n, 3, rank);
+    int64_t covered = 0;
+    for (int thread = 0; thread < 4; thread++) {
+      ranges.push_back(ppc::util::NestedBlockRange(n, 3, rank, 4, thread));
+      covered += ranges.back().Size();
+    }
+    EXPECT_EQ(covered, outer.Size());
+  }
+  ExpectTiles(ranges, n);
+  EXPECT_EQ(ppc::util::FlatWorkerId(2, 4, 1), 9);
+}
+
+TEST(PartitionTest, BlockCyclicRangesAndCounts) {
+  const int64_t n = 23;
+  const int parts = 3;
+  const int64_t block = 2;
+  std::vector<int> owner(n, -1);
+  for (int part = 0; part < parts; part++) {
+    int64_t count = 0;
+    int64_t local = 0;
+    for (const auto &range : ppc::util::BlockCyclicRanges(n, parts, part, block)) {
+      for (int64_t i = range.begin; i < range.end; i++) {
+        EXPECT_EQ(owner[i], -1);
+        owner[i] = part;
+        EXPECT_EQ(ppc::util::BlockCyclicOwner(parts, block, i), part);
+        EXPECT_EQ(ppc::util::BlockCyclicLocalIndex(parts, block, i), local);
+        EXPECT_EQ(ppc::util::BlockCyclicGlobalIndex(parts, part, block, local), i);
+        local++;
+        count++;
+      }
+    }
+    EXPECT_EQ(ppc::util::BlockCyclicCount(n, parts, part, block), count);
+  }
+  EXPECT_TRUE(std::ranges::none_of(owner, [](int o) { return o < 0; }));
+}
+
+TEST(PartitionTest, BlockCyclicRejectsNonPositiveBlockSize) {
+  for (int64_t block : {0, -2}) {
+    EXPECT_THROW((void)ppc::util::BlockCyclicOwner(3, block, 5), std::invalid_argument);
+    EXPECT_THROW((void)ppc::util::BlockCyclicRanges(10, 3, 0, block), std::invalid_argument);
+    EXPECT_THROW((void)ppc::util::BlockCyclicCount(10, 3, 0, block), std::invalid_argument);
+    EXPECT_THROW((void)ppc::util::BlockCyclicGlobalIndex(3, 0, block, 5), std::invalid_argument);
+    EXPECT_THROW((void)ppc::util::BlockCyclicLocalIndex(3, block, 5), std::invalid_argument);
+  }
+  EXPECT_THROW((void)ppc::util::BlockCyclicOwner(0, 2, 5), std::invalid_argument);
+}
+
+TEST(PartitionTest, CyclicDistribution) {
+  EXPECT_EQ(ppc::util::CyclicOwner(4, 10), 2);
+  EXPECT_EQ(ppc::util::CyclicCount(10, 4, 0), 3);
+  EXPECT_EQ(ppc::util::CyclicCount(10, 4, 1), 3);
+  EXPECT_EQ(ppc::util::CyclicCount(10, 4, 2), 2);
+  EXPECT_EQ(ppc::util::CyclicCount(10, 4, 3), 2);
+}
+
+TEST(PartitionTest, WeightedRangesBalanceCost) {
+  // Triangular cost: row i costs i + 1
+  std::vector<double> costs(1000);
+  std::iota(costs.begin(), costs.end(), 1.0);
+  const auto ranges = ppc::util::WeightedRanges(costs, 4);
+  ExpectTiles(ranges, 1000);
+  const double ideal = std::accumulate(costs.begin(), costs.end(), 0.0) / 4.0;
+  for (const auto &range : ranges) {
+    const double cost = std::accumulate(costs.begin() + range.begin, costs.begin() + range.end, 0.0);
+    EXPECT_NEAR(cost, ideal, 1000.0);
+  }
+  // Later rows are heavier, so later ranges are shorter
+  EXPECT_GT(ranges[0].Size(), ranges[3].Size());
+}
+
+TEST(PartitionTest, WeightedRangesWithZeroCostsStillTile) {
+  const std::vector<double> costs(10, 0.0);
+  ExpectTiles(ppc::util::WeightedRanges(costs, 3), 10);
+}
+
+TEST(PartitionTest, PrefixRangesMatchWeightedRanges) {
+  // Irregular costs with empty and very heavy indices, like the rows of a sparse matrix
+  std::vector<double> costs(997);
+  std::vector<int64_t> prefix = {5};
+  for (std::size_t i = 0; i < costs.size(); i++) {
+    costs[i] = static_cast<double>((i * 37) % 11 == 0 ? 200 : (i * 13) % 7);
+    prefix.push_back(prefix.back() + static_cast<int64_t>(costs[i]));
+  }
+  for (int parts : {1, 2, 3, 8, 1000}) {
+    const auto ranges = ppc::util::PrefixRanges(prefix, parts);
+    ExpectTiles(ranges, 997);
+    EXPECT_EQ(ranges, ppc::util::WeightedRanges(costs, parts)) << parts << " parts";
+  }
+  EXPECT_THROW((void)ppc::util::PrefixRanges(std::vector<int64_t>{}, 2), std::invalid_argument);
+}
+
+TEST(PartitionTest, GuidedRangesShrinkAndTile) {
+  const auto ranges = ppc::util::GuidedRanges(1000, 4, 8);
+  ExpectTiles(ranges, 1000);
+  EXPECT_EQ(ranges.front().Size(), 250);
+  for (std::size_t i = 1; i < ranges.size(); i++) {
+    EXPECT_LE(ranges[i].Size(), ranges[i - 1].Size());
+  }
+  EXPECT_LE(ranges.back().Size(), 8);
+}
+
+TEST(PartitionTest, GuidedSchedulerIsThreadSafe) {
+  const int64_t n = 100000;
+  ppc::util::GuidedScheduler scheduler(0, n, 4);
+  std::vector<int> visits(n, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&]() {
+      ppc::util::IndexRange range;
+      while (scheduler.Next(range)) {
+        for (int64_t i = range.begin; i < range.end; i++) {
+          visits[i]++;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(std::ranges::all_of(visits, [](int v) { return v == 1; }));
+}
@@ -0,0 +1,196 @@
+#include "util/include/test_data.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util/include/dataset.hpp"
+#include "util/include/mapped_file.hpp"
+
+namespace {
+
+std::filesystem::path MakeTempDir(const std::string &name) {
+  const auto dir = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+void WritePpm(const std::filesystem::path &path, const std::vector<uint8_t> &rgb, int width, int height) {
+  std::ofstream file(path, std::ios::binary);
+  file << "P6\n" << width << ' ' << height << "\n255\n";
+  file.write(reinterpret_cast<const char *>(rgb.data()), static_cast<std::streamsize>(rgb.size()));
+}
+
+std::vector<uint8_t> ToVector(const ppc::util::ImageData &image) {
+  return {image.Pixels().begin(), image.Pixels().end()};
+}
+
+}  // namespace
+
+TEST(TestDataTest, MappedFileSeesFileContents) {
+  const auto dir = MakeTempDir("ppc_mapped_file_test");
+  {
+    std::ofstream file(dir / "bytes.bin", std::ios::binary);
+    file << "mapped";
+  }
+  const ppc::util::MappedFile mapped((dir / "bytes.bin").string());
+  ASSERT_EQ(mapped.Size(), 6U);
+  EXPECT_EQ(static_cast<char>(mapped.Bytes()[0]), 'm');
+  EXPECT_EQ(static_cast<char>(mapped.Bytes()[5]), 'd');
+  EXPECT_THROW(ppc::util::MappedFile((dir / "missing.bin").string()), std::runtime_error);
+  std::filesystem::remove_all(dir);
+}
+
+TEST(TestDataTest, RawImageRoundTripsThroughMapping) {
+  const auto dir = MakeTempDir("ppc_raw_image_test");
+  const std::vector<uint8_t> pixels = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  const ppc::util::ImageData image(2, 2, 3, pixels);
+  EXPECT_FALSE(image.IsMapped());
+  const auto raw = (dir / "nested" / "image.raw").string();
+  ppc::util::WriteRawImage(raw, image);
+  EXPECT_EQ(ppc::util::ReadDatasetInfo(raw).shape, std::vector<int64_t>({2, 2, 3}));
+
+  const auto mapped = ppc::util::ImageData::MapRaw(raw);
+  EXPECT_TRUE(mapped.IsMapped());
+  EXPECT_EQ(mapped.Width(), 2);
+  EXPECT_EQ(mapped.Height(), 2);
+  EXPECT_EQ(mapped.Channels(), 3);
+  EXPECT_EQ(ToVector(mapped), pixels);
+
+  {
+    std::ofstream file(dir / "not_raw.raw", std::ios::binary);
+    file << std::string(100, 'x');
+  }
+  EXPECT_THROW((void)ppc::util::ImageData::MapRaw((dir / "not_raw.raw").string()), std::runtime_error);
+  const std::vector<int32_t> values = {1, 2, 3};
+  ppc::util::WriteDataset<int32_t>((dir / "not_image.raw").string(), values);
+  EXPECT_THROW((void)ppc::util::ImageData::MapRaw((dir / "not_image.raw").string()), std::runtime_error);
+  EXPECT_THROW(ppc::util::ImageData(2, 2, 3, std::vector<uint8_t>(11)), std::invalid_argument);
+  std::filesystem::remove_all(dir);
+}
+
+TEST(TestDataTest, MovedImageKeepsItsPixels) {
+  static_assert(!std::is_copy_constructible_v<ppc::util::ImageData>);
+  const auto dir = MakeTempDir("ppc_moved_image_test");
+  const std::vector<uint8_t> pixels = {1, 2, 3, 4, 5, 6};
+  auto decoded = std::make_unique<ppc::util::ImageData>(2, 1, 3, pixels);
+  const auto raw = (dir / "image.raw").string();
+  ppc::util::WriteRawImage(raw, *decoded);
+
+  ppc::util::ImageData moved(std::move(*decoded));
+  decoded.reset();
+  EXPECT_EQ(ToVector(moved), pixels);
+
+  auto mapped = ppc::util::ImageData::MapRaw(raw);
+  moved = std::move(mapped);
+  EXPECT_TRUE(moved.IsMapped());
+  EXPECT_EQ(ToVector(moved), pixels);
+  EXPECT_TRUE(mapped.Pixels().empty());  // NOLINT(bugprone-use-after-move)
+  std::filesystem::remove_all(dir);
+}
+
+TEST(TestDataTest, LoadImageDataDecodesOncePerProcess) {
+  const auto dir = MakeTempDir("ppc_load_image_test");
+  const auto path = (dir / "image.ppm").string();
+  WritePpm(path, {10, 20, 30, 40, 50, 60}, 2, 1);
+
+  const auto first = ppc::util::LoadImageData(path);
+  const auto second = ppc::util::LoadImageData(path);
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(ToVector(*first), std::vector<uint8_t>({10, 20, 30, 40, 50, 60}));
+  EXPECT_NE(ppc::util::LoadImageData(path, 1).get(), first.get());
+
+  ppc::util::ClearDataCache();
+  const auto reloaded = ppc::util::LoadImageData(path);
+  EXPECT_NE(reloaded.get(), first.get());
+  EXPECT_EQ(ToVector(*reloaded), ToVector(*first));
+
+  std::filesystem::remove_all(dir);
+  EXPECT_THROW((void)ppc::util::LoadImageData(path), std::runtime_error);
+  EXPECT_THROW((void)ppc::util::LoadImageData(path, 5), std::invalid_argument);
+}
+
+TEST(TestDataTest, ConvertTaskImagesWritesRawFilesOnce) {
+  const auto dir = MakeTempDir("ppc_convert_data_test");
+  const auto tasks = dir / "tasks";
+  std::filesystem::create_directories(tasks / "task_a" / "data");
+  std::filesystem::create_directories(tasks / "task_b");
+  const std::vector<uint8_t> rgb = {0, 50, 100, 150, 200, 250};
+  WritePpm(tasks / "task_a" / "data" / "pic.ppm", rgb, 1, 2);
+  {
+    std::ofstream file(tasks / "task_a" / "data" / "notes.txt");
+    file << "not an image";
+  }
+
+  const auto cache = (dir / "cache").string();
+  EXPECT_EQ(ppc::util::ConvertTaskImages(tasks.string(), cache), 1);
+  EXPECT_EQ(ppc::util::ConvertTaskImages(tasks.string(), cache), 0);
+
+  const auto raw = ppc::util::GetRawImagePath(cache, "task_a", "pic.ppm");
+  ASSERT_TRUE(std::filesystem::exists(raw));
+  const auto mapped = ppc::util::ImageData::MapRaw(raw);
+  EXPECT_EQ(mapped.Width(), 1);
+  EXPECT_EQ(mapped.Height(), 2);
+  EXPECT_EQ(ToVector(mapped), rgb);
+  std::filesystem::remove_all(dir);
+}
+
+TEST(TestDataTest, LoadTaskDatasetMakesValuesOnce) {
+  const std::string name = "ppc_load_task_dataset_test.ppcd";
+  const std::string path = ppc::util::GetTaskDatasetPath("example_sort", name);
+  if (path.empty()) {
+    GTEST_SKIP() << "The data cache is disabled";
+  }
+  std::filesystem::remove(path);
+  int calls = 0;
+  auto make = [&] {
+    calls++;
+    return std::vector<double>({0.5, 1.5, 2.5});
+  };
+  const auto made = ppc::util::LoadTaskDataset<double>("example_sort", name, "test.v1", make);
+  const auto loaded = ppc::util::LoadTaskDataset<double>("example_sort", name, "test.v1", make);
+  EXPECT_EQ(calls, 1);
+  EXPECT_TRUE(loaded.IsMapped());
+  EXPECT_EQ(std::vector<double>(made.Values().begin(), made.Values().end()),
+            std::vector<double>(loaded.Values().begin(), loaded.Values().end()));
+  EXPECT_TRUE(ppc::util::VerifyDataset(path));
+  std::filesystem::remove(path);
+}
+
+TEST(TestDataTest, LoadTaskDatasetRemakesValuesOfAnotherTag) {
+  const std::string name = "ppc_load_task_dataset_tag_test.ppcd";
+  const std::string path = ppc::util::GetTaskDatasetPath("example_sort", name);
+  if (path.empty()) {
+    GTEST_SKIP() << "The data cache is disabled";
+  }
+  // A dataset of an older generator, written without a tag
+  ppc::util::WriteDataset<double>(path, std::vector<double>({1.0, 2.0}));
+  int calls = 0;
+  auto make = [&] {
+    calls++;
+    return std::vector<double>({3.0, 4.0, 5.0});
+  };
+  const auto remade = ppc::util::LoadTaskDataset<double>("example_sort", name, "test.v2", make);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(std::vector<double>(remade.Values().begin(), remade.Values().end()), std::vector<double>({3.0, 4.0, 5.0}));
+  EXPECT_EQ(ppc::util::ReadDatasetInfo(path).tag, "test.v2");
+  const auto reused = ppc::util::LoadTaskDataset<double>("example_sort", name, "test.v2", make);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(reused.Values().size(), 3U);
+  // Another element type does not match either
+  const auto as_float = ppc::util::LoadTaskDataset<float>("example_sort", name, "test.v2", [] {
+    return std::vector<float>({6.0F});
+  });
+  EXPECT_EQ(as_float.Values().size(), 1U);
+  std::filesystem::remove(path);
+}
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "omp.h"
+#include "task/include/task.hpp"
 
 namespace my::nested {
 struct Type {};
@@ -48,6 +49,16 @@ namespace test_ns {
 struct Nested {};
 }  // namespace test_ns
 
+namespace test_ns {
+template <ppc::task::TypeOfTask kType>
+struct TemplatedTask {};
+}  // namespace test_ns
+
+TEST(GetNamespaceTest, IgnoresQualifiedTemplateArguments) {
+  std::string k_ns = ppc::util::GetNamespace<test_ns::TemplatedTask<ppc::task::TypeOfTask::kOMP>>();
+  EXPECT_EQ(k_ns, "test_ns");
+}
+
 TEST(GetNamespaceTest, ReturnsNamespaceCorrectly) {
   std::string k_ns = ppc::util::GetNamespace<test_ns::Nested>();
   EXPECT_EQ(k_ns, "test_ns");
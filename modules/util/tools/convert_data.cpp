@@ -0,0 +1,26 @@
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "util/include/test_data.hpp"
+
+// Converts the images in <tasks_dir>/<task>/data into raw images in <cache_dir>, which the tests map through
+// ppc::util::LoadTaskImage() instead of decoding them. Run by the build (ppc_data_cache target).
+//   usage: ppc_convert_data <tasks_dir> <cache_dir> [channels]
+
+int main(int argc, char **argv) {
+  if (argc < 3 || argc > 4) {
+    std::cerr << "usage: " << argv[0] << " <tasks_dir> <cache_dir> [channels]\n";
+    return EXIT_FAILURE;
+  }
+  try {
+    const int channels = argc == 4 ? std::stoi(argv[3]) : ppc::util::kDefaultImageChannels;
+    const int written = ppc::util::ConvertTaskImages(argv[1], argv[2], channels);
+    std::cout << "Converted " << written << " task data asset(s) into " << argv[2] << '\n';
+  } catch (const std::exception &error) {
+    std::cerr << error.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
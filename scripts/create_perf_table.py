@@ -22,6 +22,9 @@ NEW_PATTERN = re.compile(
 SIMPLE_PATTERN = re.compile(
     r"(.+?)_(omp|seq|tbb|stl|all|mpi)_enabled:(task_run|pipeline):(-*\d*\.\d*)"
 )
+# Microbenchmarks (modules/*/bench), kept out of the task tables:
+#   fork_join/omp/parallel_region/4:bench:0.000001234567
+BENCH_PATTERN = re.compile(r"^([\w.-]+)/([\w.-]+)/([\w.-]+)/(\d+):bench:(-*\d*\.\d*)$")
 
 
 def _ensure_task_tables(result_tables: dict, perf_type: str, task_name: str) -> None:
@@ -112,6 +115,14 @@ def _write_excel_sheet(
         row += 1
 
 
+def _write_bench_csv(path: str, bench_results: list[tuple]):
+    with open(path, "w", newline="") as csvfile:
+        writer = csv.writer(csvfile)
+        writer.writerow(["Suite", "Backend", "Operation", "Threads", "Seconds"])
+        for suite, backend, operation, threads, seconds in bench_results:
+            writer.writerow([suite, backend, operation, int(threads), float(seconds)])
+
+
 def _write_csv(path: str, header: list[str], tasks_list: list[str], table: dict):
     with open(path, "w", newline="") as csvfile:
         writer = csv.writer(csvfile)
@@ -149,6 +160,14 @@ tasks_by_category = {"threads": set(), "processes": set()}
 
 with open(logs_path, "r") as logs_file:
     logs_lines = logs_file.readlines()
+
+bench_results = [
+    match.groups()
+    for match in (BENCH_PATTERN.match(line.strip()) for line in logs_lines)
+    if match
+]
+if bench_results:
+    _write_bench_csv(os.path.join(xlsx_path, "bench_results.csv"), bench_results)
 for line in logs_lines:
     # Handle both old format: tasks/task_type/task_name:perf_type:time
     # and new format: namespace_task_type_enabled:perf_type:time
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <optional>
+
+#include "distributed/include/distributed_matrix.hpp"
+#include "example_gemm/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+/// @brief SUMMA on a 2D process grid with an OpenMP ppc::linalg::Gemm() on every rank.
+/// @details A, B and C are distributed in 2D blocks over the same process grid. For every panel of the inner
+///          dimension, the grid column owning those columns of A broadcasts them along its grid row and the grid
+///          row owning those rows of B broadcasts them along its grid column; every rank then adds the product of
+///          the two panels to its block of C. The broadcasts of the next panel are started before the current
+///          panels are multiplied.
+class NesterovATestTaskALL : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kALL;
+  }
+  explicit NesterovATestTaskALL(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  std::optional<ppc::distributed::DistributedMatrix<double>> a_;
+  std::optional<ppc::distributed::DistributedMatrix<double>> b_;
+  std::optional<ppc::distributed::DistributedMatrix<double>> c_;
+  /// Ranks of the same grid row, ordered by grid column
+  MPI_Comm row_comm_ = MPI_COMM_NULL;
+  /// Ranks of the same grid column, ordered by grid row
+  MPI_Comm col_comm_ = MPI_COMM_NULL;
+};
+
+}  // namespace nesterov_a_test_task_gemm
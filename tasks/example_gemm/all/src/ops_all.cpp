@@ -0,0 +1,170 @@
+#include "example_gemm/all/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "distributed/include/distributed_matrix.hpp"
+#include "example_gemm/common/include/common.hpp"
+#include "linalg/include/dense_matrix.hpp"
+#include "linalg/include/gemm.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/aligned_buffer.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+namespace {
+
+using ppc::distributed::DistributedMatrix;
+using ppc::distributed::MatrixDistribution;
+using ppc::distributed::MatrixLayout;
+using ppc::linalg::MatrixView;
+
+/// Widest panel of the inner dimension broadcast in one step
+constexpr int64_t kPanelWidth = 256;
+
+/// Columns [begin, end) of A and the same rows of B
+struct Panel {
+  int64_t begin = 0;
+  int64_t end = 0;
+  /// Grid column holding the columns of A
+  int a_owner = 0;
+  /// Grid row holding the rows of B
+  int b_owner = 0;
+};
+
+/// Splits the inner dimension so that no panel crosses a block boundary of A or of B; with a non-square grid the
+/// inner dimension is split differently over the grid columns (A) and the grid rows (B).
+std::vector<Panel> MakePanels(const MatrixDistribution &a, const MatrixDistribution &b) {
+  std::vector<Panel> panels;
+  for (int64_t begin = 0; begin < a.GetCols();) {
+    const int a_owner = a.Owner(0, begin) % a.GetGridCols();
+    const int b_owner = b.Owner(begin, 0) / b.GetGridCols();
+    const int64_t end =
+        std::min({begin + kPanelWidth, a.ColRange(a_owner).end, b.RowRange(b_owner * b.GetGridCols()).end});
+    panels.push_back({.begin = begin, .end = end, .a_owner = a_owner, .b_owner = b_owner});
+    begin = end;
+  }
+  return panels;
+}
+
+MatrixView<double> LocalView(DistributedMatrix<double> &matrix) {
+  return {.data = matrix.Storage().data(),
+          .rows = matrix.GetLocalRows(),
+          .cols = matrix.GetLocalCols(),
+          .stride = matrix.GetStride()};
+}
+
+/// Copies the rows x cols block at (@p row, @p col) of @p source densely into @p target.
+void CopyBlock(const MatrixView<double> &source, int64_t row, int64_t col, int64_t rows, int64_t cols,
+               double *target) {
+  for (int64_t i = 0; i < rows; i++) {
+    std::copy_n(&source(row + i, col), cols, target + (i * cols));
+  }
+}
+
+}  // namespace
+
+NesterovATestTaskALL::NesterovATestTaskALL(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = {};
+}
+
+bool NesterovATestTaskALL::ValidationImpl() {
+  return IsValid(GetInput());
+}
+
+bool NesterovATestTaskALL::PreProcessingImpl() {
+  const auto &input = GetInput();
+  a_.emplace(MPI_COMM_WORLD, input.m, input.k, MatrixLayout::kBlocks);
+  b_.emplace(MPI_COMM_WORLD, input.k, input.n, MatrixLayout::kBlocks);
+  c_.emplace(MPI_COMM_WORLD, input.m, input.n, MatrixLayout::kBlocks);
+  a_->Scatter(input.a);
+  b_->Scatter(input.b);
+
+  // All three matrices share the process grid chosen by MPI_Dims_create
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  const int grid_cols = c_->GetDistribution().GetGridCols();
+  MPI_Comm_split(MPI_COMM_WORLD, rank / grid_cols, rank % grid_cols, &row_comm_);
+  MPI_Comm_split(MPI_COMM_WORLD, rank % grid_cols, rank / grid_cols, &col_comm_);
+  return true;
+}
+
+bool NesterovATestTaskALL::RunImpl() {
+  int row_rank = 0;
+  int col_rank = 0;
+  MPI_Comm_rank(row_comm_, &row_rank);
+  MPI_Comm_rank(col_comm_, &col_rank);
+  const auto a = LocalView(*a_);
+  const auto b = LocalView(*b_);
+  const auto c = LocalView(*c_);
+  const int64_t a_first = a_->GetColRange().begin;
+  const int64_t b_first = b_->GetRowRange().begin;
+  const auto panels = MakePanels(a_->GetDistribution(), b_->GetDistribution());
+
+  const auto a_size = static_cast<std::size_t>(c.rows * kPanelWidth);
+  const auto b_size = static_cast<std::size_t>(kPanelWidth * c.cols);
+  std::array<ppc::util::AlignedBuffer<double>, 2> a_panels{ppc::util::AlignedBuffer<double>(a_size),
+                                                           ppc::util::AlignedBuffer<double>(a_size)};
+  std::array<ppc::util::AlignedBuffer<double>, 2> b_panels{ppc::util::AlignedBuffer<double>(b_size),
+                                                           ppc::util::AlignedBuffer<double>(b_size)};
+  std::array<std::array<MPI_Request, 2>, 2> requests{};
+
+  // Panel i uses buffers i % 2; the owners copy their part of it before the broadcasts start
+  auto start = [&](std::size_t index) {
+    const Panel &panel = panels[index];
+    const int64_t width = panel.end - panel.begin;
+    auto &a_panel = a_panels[index % 2];
+    auto &b_panel = b_panels[index % 2];
+    if (row_rank == panel.a_owner) {
+      CopyBlock(a, 0, panel.begin - a_first, c.rows, width, a_panel.Data());
+    }
+    if (col_rank == panel.b_owner) {
+      CopyBlock(b, panel.begin - b_first, 0, width, c.cols, b_panel.Data());
+    }
+    MPI_Ibcast(a_panel.Data(), static_cast<int>(c.rows * width), MPI_DOUBLE, panel.a_owner, row_comm_,
+               requests[index % 2].data());
+    MPI_Ibcast(b_panel.Data(), static_cast<int>(width * c.cols), MPI_DOUBLE, panel.b_owner, col_comm_,
+               &requests[index % 2][1]);
+  };
+
+  for (int64_t row = 0; row < c.rows; row++) {
+    std::fill_n(&c(row, 0), c.cols, 0.0);
+  }
+  start(0);
+  for (std::size_t index = 0; index < panels.size(); index++) {
+    MPI_Waitall(2, requests[index % 2].data(), MPI_STATUSES_IGNORE);
+    if (index + 1 < panels.size()) {
+      start(index + 1);
+    }
+    const int64_t width = panels[index].end - panels[index].begin;
+    const MatrixView<const double> a_panel{.data = a_panels[index % 2].Data(), .rows = c.rows, .cols = width,
+                                           .stride = width};
+    const MatrixView<const double> b_panel{.data = b_panels[index % 2].Data(), .rows = width, .cols = c.cols,
+                                           .stride = c.cols};
+    ppc::linalg::Gemm(ppc::parallel::kOmp, 1.0, a_panel, b_panel, 1.0, c);
+  }
+  return true;
+}
+
+bool NesterovATestTaskALL::PostProcessingImpl() {
+  auto &output = GetOutput();
+  output = c_->Gather(0);
+  output.resize(static_cast<std::size_t>(GetInput().m * GetInput().n));
+  MPI_Bcast(output.data(), static_cast<int>(output.size()), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+  MPI_Comm_free(&row_comm_);
+  MPI_Comm_free(&col_comm_);
+  a_.reset();
+  b_.reset();
+  c_.reset();
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_gemm
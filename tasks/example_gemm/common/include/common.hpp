@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+/// @brief Product C = A * B of an m x k matrix A and a k x n matrix B, both dense and row-major.
+struct GemmInput {
+  int64_t m = 0;
+  int64_t n = 0;
+  int64_t k = 0;
+  std::vector<double> a;
+  std::vector<double> b;
+};
+
+using InType = GemmInput;
+/// C, dense and row-major
+using OutType = std::vector<double>;
+using TestType = std::tuple<int, int, int, std::string>;
+using BaseTask = ppc::task::Task<InType, OutType>;
+
+/// @brief Returns an input of the given shape with reproducible entries in [-1, 1].
+inline GemmInput MakeInput(int64_t m, int64_t n, int64_t k) {
+  GemmInput input{.m = m,
+                  .n = n,
+                  .k = k,
+                  .a = std::vector<double>(static_cast<std::size_t>(m * k)),
+                  .b = std::vector<double>(static_cast<std::size_t>(k * n))};
+  for (std::size_t i = 0; i < input.a.size(); i++) {
+    input.a[i] = static_cast<double>(static_cast<int64_t>((i * 7919) % 2001) - 1000) / 1000.0;
+  }
+  for (std::size_t i = 0; i < input.b.size(); i++) {
+    input.b[i] = static_cast<double>(static_cast<int64_t>((i * 104729) % 2001) - 1000) / 1000.0;
+  }
+  return input;
+}
+
+/// @brief Checks that the dimensions are positive and match the sizes of A and B.
+inline bool IsValid(const GemmInput &input) {
+  return input.m > 0 && input.n > 0 && input.k > 0 && std::cmp_equal(input.a.size(), input.m * input.k) &&
+         std::cmp_equal(input.b.size(), input.k * input.n);
+}
+
+}  // namespace nesterov_a_test_task_gemm
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "example_gemm/common/include/common.hpp"
+#include "linalg/include/dense_matrix.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+/// @brief Cache-blocked ppc::linalg::Gemm() on aligned DenseMatrix copies of the input, once per threading backend.
+/// @details CMake compiles generic/src once per backend and instantiates the template for seq, omp, tbb and stl. The
+///          matrices are first touched with the partitioning of the backend that multiplies them.
+template <ppc::task::TypeOfTask kBackend>
+class NesterovATestTaskGeneric : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+  explicit NesterovATestTaskGeneric(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  ppc::linalg::DenseMatrix<double> a_;
+  ppc::linalg::DenseMatrix<double> b_;
+  ppc::linalg::DenseMatrix<double> c_;
+};
+
+using NesterovATestTaskGenericSEQ = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSEQ>;
+using NesterovATestTaskGenericOMP = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kOMP>;
+using NesterovATestTaskGenericTBB = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kTBB>;
+using NesterovATestTaskGenericSTL = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSTL>;
+
+}  // namespace nesterov_a_test_task_gemm
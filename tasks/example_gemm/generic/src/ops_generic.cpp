@@ -0,0 +1,68 @@
+#include "example_gemm/generic/include/ops_generic.hpp"
+
+#include "example_gemm/common/include/common.hpp"
+#include "linalg/include/dense_matrix.hpp"
+#include "linalg/include/gemm.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/aligned_buffer.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+namespace {
+
+template <ppc::task::TypeOfTask kBackend>
+constexpr ppc::util::FirstTouch FirstTouchOf() {
+  if constexpr (kBackend == ppc::task::TypeOfTask::kOMP) {
+    return ppc::util::FirstTouch::kOMP;
+  } else if constexpr (kBackend == ppc::task::TypeOfTask::kTBB) {
+    return ppc::util::FirstTouch::kTBB;
+  } else if constexpr (kBackend == ppc::task::TypeOfTask::kSTL) {
+    return ppc::util::FirstTouch::kSTL;
+  } else {
+    return ppc::util::FirstTouch::kSequential;
+  }
+}
+
+}  // namespace
+
+template <ppc::task::TypeOfTask kBackend>
+NesterovATestTaskGeneric<kBackend>::NesterovATestTaskGeneric(const InType &in) {
+  this->SetTypeOfTask(GetStaticTypeOfTask());
+  this->GetInput() = in;
+  this->GetOutput() = {};
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::ValidationImpl() {
+  return IsValid(this->GetInput());
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PreProcessingImpl() {
+  using ppc::linalg::DenseMatrix;
+  constexpr auto kFirstTouch = FirstTouchOf<kBackend>();
+  const auto &input = this->GetInput();
+  a_ = DenseMatrix<double>::FromRowMajor(input.a, input.m, input.k, kFirstTouch);
+  b_ = DenseMatrix<double>::FromRowMajor(input.b, input.k, input.n, kFirstTouch);
+  c_ = DenseMatrix<double>(input.m, input.n, 0.0, kFirstTouch);
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::RunImpl() {
+  ppc::linalg::Gemm(ppc::parallel::ExecutionPolicy<kBackend>{}, 1.0, a_.View(), b_.View(), 0.0, c_.View());
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PostProcessingImpl() {
+  this->GetOutput() = c_.ToRowMajor();
+  a_ = {};
+  b_ = {};
+  c_ = {};
+  return true;
+}
+
+template class NesterovATestTaskGeneric<ppc::parallel::kGenericBackend>;
+
+}  // namespace nesterov_a_test_task_gemm
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "example_gemm/all/include/ops_all.hpp"
+#include "example_gemm/common/include/common.hpp"
+#include "example_gemm/generic/include/ops_generic.hpp"
+#include "util/include/func_test_util.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+class NesterovARunFuncTestsGemm : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::to_string(std::get<0>(test_param)) + "x" + std::to_string(std::get<1>(test_param)) + "x" +
+           std::to_string(std::get<2>(test_param)) + "_" + std::get<3>(test_param);
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = MakeInput(std::get<0>(params), std::get<1>(params), std::get<2>(params));
+
+    // Straightforward triple loop as the reference
+    const auto m = static_cast<std::size_t>(input_data_.m);
+    const auto n = static_cast<std::size_t>(input_data_.n);
+    const auto k = static_cast<std::size_t>(input_data_.k);
+    expected_.assign(m * n, 0.0);
+    for (std::size_t row = 0; row < m; row++) {
+      for (std::size_t col = 0; col < n; col++) {
+        double sum = 0.0;
+        for (std::size_t p = 0; p < k; p++) {
+          sum += input_data_.a[(row * k) + p] * input_data_.b[(p * n) + col];
+        }
+        expected_[(row * n) + col] = sum;
+      }
+    }
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    if (output_data.size() != expected_.size()) {
+      return false;
+    }
+    // The blocked kernels add the products up in a different order
+    const double tolerance = 1e-13 * static_cast<double>(input_data_.k + 1);
+    for (std::size_t i = 0; i < expected_.size(); i++) {
+      if (std::abs(output_data[i] - expected_[i]) > tolerance) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  std::vector<double> expected_;
+};
+
+namespace {
+
+TEST_P(NesterovARunFuncTestsGemm, MatrixProduct) {
+  ExecuteTest(GetParam());
+}
+
+// Shapes smaller than the process grid leave ranks without blocks; "deep" needs several panels of the inner
+// dimension and "tall" several row blocks per thread
+const std::array<TestType, 6> kTestParam = {
+    std::make_tuple(1, 1, 1, "scalar"), std::make_tuple(3, 5, 2, "tiny"),    std::make_tuple(17, 33, 9, "odd"),
+    std::make_tuple(64, 64, 64, "square"), std::make_tuple(37, 21, 300, "deep"), std::make_tuple(400, 7, 20, "tall")};
+
+const auto kTestTasksList = std::tuple_cat(
+    ppc::util::AddFuncTask<NesterovATestTaskALL, InType>(kTestParam, PPC_SETTINGS_example_gemm),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericOMP, InType>(kTestParam, PPC_SETTINGS_example_gemm),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSEQ, InType>(kTestParam, PPC_SETTINGS_example_gemm),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSTL, InType>(kTestParam, PPC_SETTINGS_example_gemm),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericTBB, InType>(kTestParam, PPC_SETTINGS_example_gemm));
+
+const auto kGtestValues = ppc::util::ExpandToValues(kTestTasksList);
+
+const auto kPerfTestName = NesterovARunFuncTestsGemm::PrintFuncTestName<NesterovARunFuncTestsGemm>;
+
+INSTANTIATE_TEST_SUITE_P(GemmTests, NesterovARunFuncTestsGemm, kGtestValues, kPerfTestName);
+
+}  // namespace
+
+}  // namespace nesterov_a_test_task_gemm
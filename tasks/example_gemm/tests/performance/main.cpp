@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "example_gemm/all/include/ops_all.hpp"
+#include "example_gemm/common/include/common.hpp"
+#include "example_gemm/generic/include/ops_generic.hpp"
+#include "linalg/include/gemm.hpp"
+#include "performance/include/performance.hpp"
+#include "util/include/perf_test_util.hpp"
+
+namespace nesterov_a_test_task_gemm {
+
+class ExampleRunPerfTestGemm : public ppc::util::BaseRunPerfTests<InType, OutType> {
+  static constexpr int64_t kSize = 1024;
+  InType input_data_;
+
+  void SetUp() override {
+    input_data_ = MakeInput(kSize, kSize, kSize);
+  }
+
+  // Reported as task_run:gflops / pipeline:gflops next to the times
+  void SetPerfAttributes(ppc::performance::PerfAttr &perf_attrs) override {
+    BaseRunPerfTests::SetPerfAttributes(perf_attrs);
+    perf_attrs.items_per_run = ppc::linalg::GemmFlops(kSize, kSize, kSize);
+    perf_attrs.throughput_name = "gflops";
+    perf_attrs.throughput_scale = 1e-9;
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    if (output_data.size() != static_cast<std::size_t>(kSize * kSize)) {
+      return false;
+    }
+    // Spot check of the corners and the diagonal against dot products
+    const auto n = static_cast<std::size_t>(kSize);
+    for (std::size_t index : {std::size_t{0}, n - 1, n / 2, n * (n - 1), (n * n) - 1}) {
+      const std::size_t row = index / n;
+      const std::size_t col = index % n;
+      double expected = 0.0;
+      for (std::size_t p = 0; p < n; p++) {
+        expected += input_data_.a[(row * n) + p] * input_data_.b[(p * n) + col];
+      }
+      if (std::abs(output_data[index] - expected) > 1e-9) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+};
+
+TEST_P(ExampleRunPerfTestGemm, RunPerfModes) {
+  ExecuteTest(GetParam());
+}
+
+const auto kAllPerfTasks =
+    ppc::util::MakeAllPerfTasks<InType, NesterovATestTaskALL, NesterovATestTaskGenericOMP, NesterovATestTaskGenericSEQ,
+                                NesterovATestTaskGenericSTL, NesterovATestTaskGenericTBB>(PPC_SETTINGS_example_gemm);
+
+const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+
+const auto kPerfTestName = ExampleRunPerfTestGemm::CustomPerfTestName;
+
+INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestGemm, kGtestValues, kPerfTestName);
+
+}  // namespace nesterov_a_test_task_gemm
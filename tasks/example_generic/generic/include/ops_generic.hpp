@@ -0,0 +1,30 @@
+#pragma once
+
+#include "example_generic/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_generic {
+
+/// @brief Sum of squares written once for every threading backend.
+/// @details CMake compiles generic/src once per backend and instantiates the template for seq, omp, tbb and stl.
+template <ppc::task::TypeOfTask kBackend>
+class NesterovATestTaskGeneric : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+  explicit NesterovATestTaskGeneric(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+};
+
+using NesterovATestTaskGenericSEQ = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSEQ>;
+using NesterovATestTaskGenericOMP = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kOMP>;
+using NesterovATestTaskGenericTBB = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kTBB>;
+using NesterovATestTaskGenericSTL = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSTL>;
+
+}  // namespace nesterov_a_test_task_generic
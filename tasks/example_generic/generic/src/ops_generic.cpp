@@ -0,0 +1,45 @@
+#include "example_generic/generic/include/ops_generic.hpp"
+
+#include <cstdint>
+#include <functional>
+
+#include "example_generic/common/include/common.hpp"
+#include "parallel/include/algorithms.hpp"
+#include "parallel/include/execution_policy.hpp"
+
+namespace nesterov_a_test_task_generic {
+
+template <ppc::task::TypeOfTask kBackend>
+NesterovATestTaskGeneric<kBackend>::NesterovATestTaskGeneric(const InType &in) {
+  this->SetTypeOfTask(GetStaticTypeOfTask());
+  this->GetInput() = in;
+  this->GetOutput() = 0;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::ValidationImpl() {
+  return !this->GetInput().empty() && (this->GetOutput() == 0);
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PreProcessingImpl() {
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::RunImpl() {
+  const auto &input = this->GetInput();
+  this->GetOutput() = ppc::parallel::TransformReduce(
+      ppc::parallel::ExecutionPolicy<kBackend>{}, 0, static_cast<int64_t>(input.size()), int64_t{0}, std::plus<>(),
+      [&input](int64_t i) { return input[i] * input[i]; });
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PostProcessingImpl() {
+  return this->GetOutput() >= 0;
+}
+
+template class NesterovATestTaskGeneric<ppc::parallel::kGenericBackend>;
+
+}  // namespace nesterov_a_test_task_generic
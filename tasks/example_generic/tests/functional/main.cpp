@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include "example_generic/common/include/common.hpp"
+#include "example_generic/generic/include/ops_generic.hpp"
+#include "util/include/func_test_util.hpp"
+
+namespace nesterov_a_test_task_generic {
+
+class NesterovARunFuncTestsGeneric : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::to_string(std::get<0>(test_param)) + "_" + std::get<1>(test_param);
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    const int size = std::get<0>(params);
+    input_data_.resize(static_cast<std::size_t>(size));
+    expected_ = 0;
+    for (int i = 0; i < size; i++) {
+      input_data_[static_cast<std::size_t>(i)] = (i % 7) - 3;
+      expected_ += input_data_[static_cast<std::size_t>(i)] * input_data_[static_cast<std::size_t>(i)];
+    }
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return expected_ == output_data;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  OutType expected_ = 0;
+};
+
+namespace {
+
+TEST_P(NesterovARunFuncTestsGeneric, SumOfSquares) {
+  ExecuteTest(GetParam());
+}
+
+const std::array<TestType, 4> kTestParam = {std::make_tuple(1, "single"), std::make_tuple(10, "small"),
+                                            std::make_tuple(1000, "medium"), std::make_tuple(100003, "large")};
+
+const auto kTestTasksList = std::tuple_cat(
+    ppc::util::AddFuncTask<NesterovATestTaskGenericOMP, InType>(kTestParam, PPC_SETTINGS_example_generic),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSEQ, InType>(kTestParam, PPC_SETTINGS_example_generic),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSTL, InType>(kTestParam, PPC_SETTINGS_example_generic),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericTBB, InType>(kTestParam, PPC_SETTINGS_example_generic));
+
+const auto kGtestValues = ppc::util::ExpandToValues(kTestTasksList);
+
+const auto kPerfTestName = NesterovARunFuncTestsGeneric::PrintFuncTestName<NesterovARunFuncTestsGeneric>;
+
+INSTANTIATE_TEST_SUITE_P(SumOfSquaresTests, NesterovARunFuncTestsGeneric, kGtestValues, kPerfTestName);
+
+}  // namespace
+
+}  // namespace nesterov_a_test_task_generic
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "example_generic/common/include/common.hpp"
+#include "example_generic/generic/include/ops_generic.hpp"
+#include "util/include/perf_test_util.hpp"
+
+namespace nesterov_a_test_task_generic {
+
+class ExampleRunPerfTestGeneric : public ppc::util::BaseRunPerfTests<InType, OutType> {
+  const std::size_t kCount_ = 5'000'000;
+  InType input_data_;
+
+  void SetUp() override {
+    input_data_.assign(kCount_, 2);
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return output_data == static_cast<OutType>(4 * kCount_);
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+};
+
+TEST_P(ExampleRunPerfTestGeneric, RunPerfModes) {
+  ExecuteTest(GetParam());
+}
+
+const auto kAllPerfTasks =
+    ppc::util::MakeAllPerfTasks<InType, NesterovATestTaskGenericOMP, NesterovATestTaskGenericSEQ,
+                                NesterovATestTaskGenericSTL, NesterovATestTaskGenericTBB>(PPC_SETTINGS_example_generic);
+
+const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+
+const auto kPerfTestName = ExampleRunPerfTestGeneric::CustomPerfTestName;
+
+INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestGeneric, kGtestValues, kPerfTestName);
+
+}  // namespace nesterov_a_test_task_generic
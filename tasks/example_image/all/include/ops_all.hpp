@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "distributed/include/distributed_matrix.hpp"
+#include "example_image/common/include/common.hpp"
+#include "image/include/image.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_image {
+
+/// @brief Edge detection on row strips over MPI with OpenMP ppc::image filters on every rank.
+/// @details The interleaved image is scattered in strips of rows (DistributedMatrix with GaussianRadius() halo
+///          rows). Every rank blurs its rows after one halo exchange, converts them to luma and exchanges one halo
+///          row of luma before Sobel. The histograms are summed with MPI_Allreduce and PostProcessing gathers the
+///          edges on every rank. Non-empty strips are at least as high as the halo, so small images use fewer
+///          ranks.
+class NesterovATestTaskALL : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kALL;
+  }
+  explicit NesterovATestTaskALL(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  /// Halo rows of image_: GaussianRadius(), at most the image height
+  int64_t halo_ = 0;
+  /// Input rows, interleaved, with halo_ halo rows
+  std::optional<ppc::distributed::DistributedMatrix<uint8_t>> image_;
+  /// Luma of the blurred rows with one halo row
+  std::optional<ppc::distributed::DistributedMatrix<uint8_t>> gray_;
+  ppc::image::Image<uint8_t> blurred_;
+  ppc::image::Image<uint8_t> edges_;
+};
+
+}  // namespace nesterov_a_test_task_image
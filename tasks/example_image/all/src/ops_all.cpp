@@ -0,0 +1,136 @@
+#include "example_image/all/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "distributed/include/distributed_matrix.hpp"
+#include "example_image/common/include/common.hpp"
+#include "image/include/filters.hpp"
+#include "image/include/image.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/partition.hpp"
+
+namespace nesterov_a_test_task_image {
+
+namespace {
+
+using ppc::distributed::DistributedMatrix;
+using ppc::distributed::Side;
+
+/// Rows in strips of at least @p halo rows over as many of the @p size ranks as possible; the other ranks get none.
+std::vector<ppc::util::IndexRange> StripRanges(int64_t rows, int64_t halo, int size) {
+  const int64_t strips = std::clamp<int64_t>(rows / std::max<int64_t>(halo, 1), 1, size);
+  std::vector<ppc::util::IndexRange> ranges;
+  for (int rank = 0; rank < size; rank++) {
+    ranges.push_back(rank < strips ? ppc::util::BlockRange(rows, strips, rank) : ppc::util::IndexRange{rows, rows});
+  }
+  return ranges;
+}
+
+/// Number of halo rows above the owned rows of @p matrix that hold data: @p halo if there is a neighbour above.
+int64_t RowsAbove(const DistributedMatrix<uint8_t> &matrix, int64_t halo) {
+  return matrix.Neighbor(Side::kTop) == MPI_PROC_NULL ? 0 : halo;
+}
+
+/// Owned rows of @p matrix together with the halo rows that hold data as an interleaved image.
+ppc::image::ImageView<uint8_t> StripView(DistributedMatrix<uint8_t> &matrix, int64_t width, int64_t channels,
+                                         int64_t halo) {
+  const int64_t above = RowsAbove(matrix, halo);
+  const int64_t below = matrix.Neighbor(Side::kBottom) == MPI_PROC_NULL ? 0 : halo;
+  return {.data = &matrix(-above, 0),
+          .width = width,
+          .height = above + matrix.GetLocalRows() + below,
+          .channels = channels,
+          .layout = ppc::image::ImageLayout::kInterleaved,
+          .row_stride = matrix.GetStride(),
+          .plane_stride = 0};
+}
+
+}  // namespace
+
+NesterovATestTaskALL::NesterovATestTaskALL(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = {};
+}
+
+bool NesterovATestTaskALL::ValidationImpl() {
+  return IsValid(GetInput());
+}
+
+bool NesterovATestTaskALL::PreProcessingImpl() {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  const auto &image = GetInput().image;
+  // A single strip has no neighbours and needs no more halo rows than it has rows
+  halo_ = std::min(ppc::image::GaussianRadius(GetInput().sigma), image.Height());
+  const auto ranges = StripRanges(image.Height(), halo_, size);
+  using ppc::distributed::MatrixDistribution;
+  using ppc::distributed::MatrixLayout;
+  const int64_t cols = image.Width() * image.Channels();
+  image_.emplace(MPI_COMM_WORLD, MatrixDistribution(MatrixLayout::kRows, ranges, {{.begin = 0, .end = cols}}),
+                 static_cast<int>(halo_));
+  gray_.emplace(MPI_COMM_WORLD, MatrixDistribution(MatrixLayout::kRows, ranges, {{.begin = 0, .end = image.Width()}}),
+                1);
+  // Every rank holds the input, but it is scattered from rank 0 as if only that one had read it
+  image_->Scatter(rank == 0 ? image.ToInterleaved() : std::vector<uint8_t>{});
+  const int64_t rows = image_->GetLocalRows();
+  blurred_ = ppc::image::Image<uint8_t>(image.Width(), rows, image.Channels());
+  edges_ = ppc::image::Image<uint8_t>(image.Width(), rows, 1);
+  return true;
+}
+
+bool NesterovATestTaskALL::RunImpl() {
+  const auto &image = GetInput().image;
+  const int64_t width = image.Width();
+  const int64_t rows = image_->GetLocalRows();
+
+  image_->ExchangeHalo();
+  if (rows > 0) {
+    const auto strip = StripView(*image_, width, image.Channels(), halo_);
+    ppc::image::GaussianBlur(ppc::parallel::kOmp, strip, blurred_.View(), GetInput().sigma, RowsAbove(*image_, halo_));
+    const auto gray = StripView(*gray_, width, 1, 1).Rows(RowsAbove(*gray_, 1), rows);
+    ppc::image::ToGray(ppc::parallel::kOmp, blurred_.View(), gray);
+  }
+  gray_->ExchangeHalo();
+  std::vector<int64_t> histogram(static_cast<std::size_t>(ppc::image::kHistogramBins), 0);
+  if (rows > 0) {
+    ppc::image::Sobel(ppc::parallel::kOmp, StripView(*gray_, width, 1, 1), edges_.View(), RowsAbove(*gray_, 1));
+    histogram = ppc::image::Histogram(ppc::parallel::kOmp, edges_.View());
+  }
+  auto &output = GetOutput().histogram;
+  output.resize(histogram.size());
+  MPI_Allreduce(histogram.data(), output.data(), static_cast<int>(histogram.size()), MPI_INT64_T, MPI_SUM,
+                MPI_COMM_WORLD);
+  return true;
+}
+
+bool NesterovATestTaskALL::PostProcessingImpl() {
+  const auto &image = GetInput().image;
+  std::vector<int> counts;
+  std::vector<int> displs;
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  for (int rank = 0; rank < size; rank++) {
+    const auto range = gray_->GetDistribution().RowRange(rank);
+    counts.push_back(static_cast<int>(range.Size() * image.Width()));
+    displs.push_back(static_cast<int>(range.begin * image.Width()));
+  }
+  auto &edges = GetOutput().edges;
+  edges = ppc::image::Image<uint8_t>(image.Width(), image.Height(), 1);
+  MPI_Allgatherv(edges_.Data(), static_cast<int>(edges_.Pixels()), MPI_UINT8_T, edges.Data(), counts.data(),
+                 displs.data(), MPI_UINT8_T, MPI_COMM_WORLD);
+  image_.reset();
+  gray_.reset();
+  blurred_ = {};
+  edges_ = {};
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_image
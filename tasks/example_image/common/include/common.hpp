@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "image/include/filters.hpp"
+#include "image/include/image.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+#include "util/include/test_data.hpp"
+
+namespace nesterov_a_test_task_image {
+
+/// @brief Colour image and the standard deviation of the Gaussian blur applied before edge detection.
+struct ImageInput {
+  ppc::image::Image<uint8_t> image;
+  double sigma = 1.0;
+};
+
+/// @brief Result of the pipeline blur -> luma -> Sobel -> histogram.
+struct ImageOutput {
+  /// Sobel gradient magnitude of the luma of the blurred image, one channel
+  ppc::image::Image<uint8_t> edges;
+  /// ppc::image::kHistogramBins counts of the values of edges
+  std::vector<int64_t> histogram;
+};
+
+using InType = ImageInput;
+using OutType = ImageOutput;
+/// Width, height, sigma and name
+using TestType = std::tuple<int, int, double, std::string>;
+using BaseTask = ppc::task::Task<InType, OutType>;
+
+/// @brief Returns the bundled data/pic.jpg resized to @p width x @p height as RGB.
+inline ImageInput MakeInput(int64_t width, int64_t height, double sigma) {
+  const auto data = ppc::util::LoadTaskImage(PPC_ID_example_image, "pic.jpg");
+  const auto picture = ppc::image::Image<uint8_t>::FromInterleaved(data->Pixels(), data->Width(), data->Height(),
+                                                                   data->Channels());
+  return {.image = ppc::image::ResizeBilinear(ppc::parallel::kOmp, picture.View(), width, height), .sigma = sigma};
+}
+
+/// @brief Checks that the image is not empty, has 1, 3 or 4 channels and that sigma is positive.
+inline bool IsValid(const ImageInput &input) {
+  const auto channels = input.image.Channels();
+  return input.image.Pixels() > 0 && (channels == 1 || channels == 3 || channels == 4) && input.sigma > 0.0;
+}
+
+}  // namespace nesterov_a_test_task_image
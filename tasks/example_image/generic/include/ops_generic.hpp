@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+#include "example_image/common/include/common.hpp"
+#include "image/include/image.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_image {
+
+/// @brief Edge detection with the ppc::image filters on a planar copy of the input, once per threading backend.
+/// @details The planar layout gives every filter unit-stride rows of one channel. Blur, luma, Sobel and histogram
+///          each run as one parallel loop of the backend over rows.
+template <ppc::task::TypeOfTask kBackend>
+class NesterovATestTaskGeneric : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+  explicit NesterovATestTaskGeneric(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  ppc::image::Image<uint8_t> planar_;
+  ppc::image::Image<uint8_t> blurred_;
+  ppc::image::Image<uint8_t> gray_;
+};
+
+using NesterovATestTaskGenericSEQ = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSEQ>;
+using NesterovATestTaskGenericOMP = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kOMP>;
+using NesterovATestTaskGenericTBB = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kTBB>;
+using NesterovATestTaskGenericSTL = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSTL>;
+
+}  // namespace nesterov_a_test_task_image
@@ -0,0 +1,54 @@
+#include "example_image/generic/include/ops_generic.hpp"
+
+#include "example_image/common/include/common.hpp"
+#include "image/include/filters.hpp"
+#include "image/include/image.hpp"
+#include "parallel/include/execution_policy.hpp"
+
+namespace nesterov_a_test_task_image {
+
+template <ppc::task::TypeOfTask kBackend>
+NesterovATestTaskGeneric<kBackend>::NesterovATestTaskGeneric(const InType &in) {
+  this->SetTypeOfTask(GetStaticTypeOfTask());
+  this->GetInput() = in;
+  this->GetOutput() = {};
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::ValidationImpl() {
+  return IsValid(this->GetInput());
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PreProcessingImpl() {
+  const auto &image = this->GetInput().image;
+  planar_ = image.ToLayout(ppc::image::ImageLayout::kPlanar);
+  blurred_ = ppc::image::Image<uint8_t>(image.Width(), image.Height(), image.Channels(),
+                                        ppc::image::ImageLayout::kPlanar);
+  gray_ = ppc::image::Image<uint8_t>(image.Width(), image.Height(), 1);
+  this->GetOutput().edges = ppc::image::Image<uint8_t>(image.Width(), image.Height(), 1);
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::RunImpl() {
+  const ppc::parallel::ExecutionPolicy<kBackend> policy{};
+  auto &output = this->GetOutput();
+  ppc::image::GaussianBlur(policy, planar_.View(), blurred_.View(), this->GetInput().sigma);
+  ppc::image::ToGray(policy, blurred_.View(), gray_.View());
+  ppc::image::Sobel(policy, gray_.View(), output.edges.View());
+  output.histogram = ppc::image::Histogram(policy, output.edges.View());
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PostProcessingImpl() {
+  planar_ = {};
+  blurred_ = {};
+  gray_ = {};
+  return true;
+}
+
+template class NesterovATestTaskGeneric<ppc::parallel::kGenericBackend>;
+
+}  // namespace nesterov_a_test_task_image
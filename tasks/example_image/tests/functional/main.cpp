@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include "example_image/all/include/ops_all.hpp"
+#include "example_image/common/include/common.hpp"
+#include "example_image/generic/include/ops_generic.hpp"
+#include "image/include/filters.hpp"
+#include "image/include/image.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/func_test_util.hpp"
+
+namespace nesterov_a_test_task_image {
+
+class NesterovARunFuncTestsImage : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::get<3>(test_param) + "_" + std::to_string(std::get<0>(test_param)) + "x" +
+           std::to_string(std::get<1>(test_param));
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = MakeInput(std::get<0>(params), std::get<1>(params), std::get<2>(params));
+
+    // The same filters sequentially on the interleaved image as the reference
+    const auto &image = input_data_.image;
+    ppc::image::Image<uint8_t> blurred(image.Width(), image.Height(), image.Channels());
+    ppc::image::Image<uint8_t> gray(image.Width(), image.Height(), 1);
+    expected_.edges = ppc::image::Image<uint8_t>(image.Width(), image.Height(), 1);
+    ppc::image::GaussianBlur(ppc::parallel::kSeq, image.View(), blurred.View(), input_data_.sigma);
+    ppc::image::ToGray(ppc::parallel::kSeq, blurred.View(), gray.View());
+    ppc::image::Sobel(ppc::parallel::kSeq, gray.View(), expected_.edges.View());
+    expected_.histogram = ppc::image::Histogram(ppc::parallel::kSeq, expected_.edges.View());
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return output_data.edges == expected_.edges && output_data.histogram == expected_.histogram;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  OutType expected_;
+};
+
+namespace {
+
+TEST_P(NesterovARunFuncTestsImage, DetectEdges) {
+  ExecuteTest(GetParam());
+}
+
+// The bundled image as is and upscaled; images lower than the blur radius or than the ranks times the radius
+// leave ranks without rows
+const std::array<TestType, 6> kTestParam = {
+    std::make_tuple(2, 2, 1.0, "original"), std::make_tuple(3, 17, 0.8, "narrow"),
+    std::make_tuple(64, 48, 1.0, "small"),  std::make_tuple(257, 129, 2.0, "wide"),
+    std::make_tuple(100, 5, 3.0, "flat"),   std::make_tuple(31, 200, 1.5, "tall")};
+
+const auto kTestTasksList = std::tuple_cat(
+    ppc::util::AddFuncTask<NesterovATestTaskALL, InType>(kTestParam, PPC_SETTINGS_example_image),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericOMP, InType>(kTestParam, PPC_SETTINGS_example_image),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSEQ, InType>(kTestParam, PPC_SETTINGS_example_image),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSTL, InType>(kTestParam, PPC_SETTINGS_example_image),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericTBB, InType>(kTestParam, PPC_SETTINGS_example_image));
+
+const auto kGtestValues = ppc::util::ExpandToValues(kTestTasksList);
+
+const auto kPerfTestName = NesterovARunFuncTestsImage::PrintFuncTestName<NesterovARunFuncTestsImage>;
+
+INSTANTIATE_TEST_SUITE_P(ImageTests, NesterovARunFuncTestsImage, kGtestValues, kPerfTestName);
+
+}  // namespace
+
+}  // namespace nesterov_a_test_task_image
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+
+#include "example_image/all/include/ops_all.hpp"
+#include "example_image/common/include/common.hpp"
+#include "example_image/generic/include/ops_generic.hpp"
+#include "performance/include/performance.hpp"
+#include "util/include/perf_test_util.hpp"
+
+namespace nesterov_a_test_task_image {
+
+class ExampleRunPerfTestImage : public ppc::util::BaseRunPerfTests<InType, OutType> {
+  static constexpr int64_t kWidth = 2048;
+  static constexpr int64_t kHeight = 2048;
+  InType input_data_;
+
+  void SetUp() override {
+    input_data_ = MakeInput(kWidth, kHeight, 2.0);
+  }
+
+  // Reported as task_run:mpixels_per_sec / pipeline:mpixels_per_sec
+  void SetPerfAttributes(ppc::performance::PerfAttr &perf_attrs) override {
+    BaseRunPerfTests::SetPerfAttributes(perf_attrs);
+    perf_attrs.items_per_run = static_cast<uint64_t>(kWidth * kHeight);
+    perf_attrs.throughput_name = "mpixels_per_sec";
+    perf_attrs.throughput_scale = 1e-6;
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    const auto &histogram = output_data.histogram;
+    return output_data.edges.Width() == kWidth && output_data.edges.Height() == kHeight &&
+           std::accumulate(histogram.begin(), histogram.end(), int64_t{0}) == kWidth * kHeight;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+};
+
+TEST_P(ExampleRunPerfTestImage, RunPerfModes) {
+  ExecuteTest(GetParam());
+}
+
+const auto kAllPerfTasks =
+    ppc::util::MakeAllPerfTasks<InType, NesterovATestTaskALL, NesterovATestTaskGenericOMP, NesterovATestTaskGenericSEQ,
+                                NesterovATestTaskGenericSTL, NesterovATestTaskGenericTBB>(PPC_SETTINGS_example_image);
+
+const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+
+const auto kPerfTestName = ExampleRunPerfTestImage::CustomPerfTestName;
+
+INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestImage, kGtestValues, kPerfTestName);
+
+}  // namespace nesterov_a_test_task_image
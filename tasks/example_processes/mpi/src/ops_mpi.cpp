@@ -2,9 +2,11 @@
 
 #include <mpi.h>
 
+#include <cstdint>
 #include <numeric>
 #include <vector>
 
+#include "distributed/include/work_distributor.hpp"
 #include "example_processes/common/include/common.hpp"
 #include "util/include/util.hpp"
 
@@ -31,15 +33,22 @@ bool NesterovATestTaskMPI::RunImpl() {
     return false;
   }
 
-  for (InType i = 0; i < GetInput(); i++) {
-    for (InType j = 0; j < GetInput(); j++) {
-      for (InType k = 0; k < GetInput(); k++) {
-        std::vector<InType> tmp(i + j + k, 1);
-        GetOutput() += std::accumulate(tmp.begin(), tmp.end(), 0);
-        GetOutput() -= i + j + k;
+  // The cost of iteration i grows with i, so the outer loop is balanced dynamically over the processes
+  InType local = 0;
+  ppc::distributed::DynamicFor(MPI_COMM_WORLD, 0, input, [&](int64_t begin, int64_t end) {
+    for (auto i = static_cast<InType>(begin); i < end; i++) {
+      for (InType j = 0; j < GetInput(); j++) {
+        for (InType k = 0; k < GetInput(); k++) {
+          std::vector<InType> tmp(i + j + k, 1);
+          local += std::accumulate(tmp.begin(), tmp.end(), 0);
+          local -= i + j + k;
+        }
       }
     }
-  }
+  });
+  InType total = 0;
+  MPI_Allreduce(&local, &total, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  GetOutput() += total;
 
   const int num_threads = ppc::util::GetNumThreads();
   GetOutput() *= num_threads;
@@ -10,12 +10,12 @@
 #include <string>
 #include <tuple>
 #include <utility>
-#include <vector>
 
 #include "example_processes_3/common/include/common.hpp"
 #include "example_processes_3/mpi/include/ops_mpi.hpp"
 #include "example_processes_3/seq/include/ops_seq.hpp"
 #include "util/include/func_test_util.hpp"
+#include "util/include/test_data.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_processes_3 {
@@ -28,23 +28,15 @@ class NesterovARunFuncTestsProcesses3 : public ppc::util::BaseRunFuncTests<InTyp
 
  protected:
   void SetUp() override {
-    int width = -1;
-    int height = -1;
-    int channels = -1;
-    std::vector<uint8_t> img;
-    // Read image in RGB to ensure consistent channel count
-    {
-      std::string abs_path = ppc::util::GetAbsoluteTaskPath(PPC_ID_example_processes_3, "pic.jpg");
-      auto *data = stbi_load(abs_path.c_str(), &width, &height, &channels, STBI_rgb);
-      if (data == nullptr) {
-        throw std::runtime_error("Failed to load image: " + std::string(stbi_failure_reason()));
-      }
-      channels = STBI_rgb;
-      img = std::vector<uint8_t>(data, data + (static_cast<ptrdiff_t>(width * height * channels)));
-      stbi_image_free(data);
-      if (std::cmp_not_equal(width, height)) {
-        throw std::runtime_error("width != height: ");
-      }
+    // Read image in RGB to ensure consistent channel count. It is decoded once per process (or mapped from the
+    // build's data cache), not in every SetUp
+    const auto image = ppc::util::LoadTaskImage(PPC_ID_example_processes_3, "pic.jpg", STBI_rgb);
+    const int width = image->Width();
+    const int height = image->Height();
+    const int channels = image->Channels();
+    const auto img = image->Pixels();
+    if (std::cmp_not_equal(width, height)) {
+      throw std::runtime_error("width != height: ");
     }
 
     TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
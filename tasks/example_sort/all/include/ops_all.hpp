@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "example_sort/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+/// @brief Sample sort over MPI (ppc::distributed::SampleSort()) with an OpenMP radix sort on every rank.
+/// @details Every rank sorts its block of the input, the ranks agree on splitters from regular samples and
+///          exchange the pieces with one MPI_Alltoallv. PostProcessing gathers the sorted keys on every rank.
+class NesterovATestTaskALL : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kALL;
+  }
+  explicit NesterovATestTaskALL(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  /// Keys of this rank after sorting
+  std::vector<int32_t> sorted_;
+};
+
+}  // namespace nesterov_a_test_task_sort
@@ -0,0 +1,61 @@
+#include "example_sort/all/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "distributed/include/sample_sort.hpp"
+#include "example_sort/common/include/common.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/partition.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+NesterovATestTaskALL::NesterovATestTaskALL(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = {};
+}
+
+bool NesterovATestTaskALL::ValidationImpl() {
+  return true;
+}
+
+bool NesterovATestTaskALL::PreProcessingImpl() {
+  return true;
+}
+
+bool NesterovATestTaskALL::RunImpl() {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  // Every rank holds the whole input and starts from its block of it
+  const auto &input = GetInput();
+  const auto block = ppc::util::BlockRange(static_cast<int64_t>(input.size()), size, rank);
+  std::vector<int32_t> keys(input.begin() + block.begin, input.begin() + block.end);
+  sorted_ = ppc::distributed::SampleSort(ppc::parallel::kOmp, MPI_COMM_WORLD, std::move(keys));
+  return true;
+}
+
+bool NesterovATestTaskALL::PostProcessingImpl() {
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  auto count = static_cast<int>(sorted_.size());
+  std::vector<int> counts(static_cast<std::size_t>(size));
+  MPI_Allgather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  std::vector<int> displs(static_cast<std::size_t>(size), 0);
+  for (std::size_t rank = 1; rank < displs.size(); rank++) {
+    displs[rank] = displs[rank - 1] + counts[rank - 1];
+  }
+  GetOutput().resize(GetInput().size());
+  MPI_Allgatherv(sorted_.data(), count, MPI_INT32_T, GetOutput().data(), counts.data(), displs.data(), MPI_INT32_T,
+                 MPI_COMM_WORLD);
+  sorted_ = {};
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_sort
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "datagen/include/generators.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+/// @brief Order and value range of generated keys.
+enum class KeyOrder : uint8_t {
+  /// Uniform over the whole int32_t range
+  kRandom,
+  /// Uniform over 16 values, so most keys are repeated
+  kFewDistinct,
+  /// Already sorted
+  kSorted,
+  /// Sorted descending
+  kReversed,
+};
+
+using InType = std::vector<int32_t>;
+using OutType = std::vector<int32_t>;
+using TestType = std::tuple<KeyOrder, int, std::string>;
+using BaseTask = ppc::task::Task<InType, OutType>;
+
+/// @brief Identifies the keys MakeKeys() generates in stored datasets; change it whenever MakeKeys() or the datagen
+///        generators it uses change their output, so stale datasets are generated anew.
+inline constexpr std::string_view kKeysTag = "example_sort.MakeKeys.v2";
+
+/// @brief Returns @p n reproducible keys of the given order, generated in parallel.
+/// @details kSorted is i - n / 2 and kReversed is n / 2 - i, so every key is distinct.
+inline std::vector<int32_t> MakeKeys(KeyOrder order, int64_t n) {
+  using ppc::datagen::Distribution;
+  const auto seed = static_cast<uint64_t>(n);
+  const int64_t last = std::max<int64_t>(n, 1) - 1;
+  const auto low = static_cast<int32_t>(-(n / 2));
+  const auto high = static_cast<int32_t>(n / 2);
+  switch (order) {
+    case KeyOrder::kRandom:
+      return ppc::datagen::MakeArray<int32_t>(ppc::parallel::kOmp, n, {.seed = seed});
+    case KeyOrder::kFewDistinct:
+      return ppc::datagen::MakeArray<int32_t>(
+          ppc::parallel::kOmp, n, {.distribution = Distribution::kFewDistinct, .low = -8, .values = 16, .seed = seed});
+    case KeyOrder::kSorted:
+      return ppc::datagen::MakeArray<int32_t>(ppc::parallel::kOmp, n,
+                                              {.distribution = Distribution::kSorted, .low = low,
+                                               .high = static_cast<int32_t>(low + last)});
+    case KeyOrder::kReversed:
+      return ppc::datagen::MakeArray<int32_t>(ppc::parallel::kOmp, n,
+                                              {.distribution = Distribution::kReversed,
+                                               .low = static_cast<int32_t>(high - last), .high = high});
+  }
+  throw std::invalid_argument("MakeKeys: unknown key order");
+}
+
+}  // namespace nesterov_a_test_task_sort
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "example_sort/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+/// @brief Parallel merge sort (ppc::parallel::Sort()), once per threading backend.
+/// @details Blocks are sorted with std::sort concurrently and then merged pairwise; every merge is split by merge
+///          path, so the last rounds use all threads as well.
+template <ppc::task::TypeOfTask kBackend>
+class NesterovATestTaskGeneric : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+  explicit NesterovATestTaskGeneric(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+};
+
+using NesterovATestTaskGenericSEQ = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSEQ>;
+using NesterovATestTaskGenericOMP = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kOMP>;
+using NesterovATestTaskGenericTBB = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kTBB>;
+using NesterovATestTaskGenericSTL = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSTL>;
+
+}  // namespace nesterov_a_test_task_sort
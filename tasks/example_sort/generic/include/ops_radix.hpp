@@ -0,0 +1,36 @@
+#pragma once
+
+#include "example_sort/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_sort_radix {
+
+using nesterov_a_test_task_sort::BaseTask;
+using nesterov_a_test_task_sort::InType;
+using nesterov_a_test_task_sort::OutType;
+
+/// @brief LSD radix sort (ppc::parallel::RadixSort()), once per threading backend.
+/// @details Four passes of one byte each; every pass counts the digits of each block in parallel and scatters
+///          the blocks in parallel to their offsets. It lives in its own namespace so that it gets test names and
+///          perf results distinct from the merge sort.
+template <ppc::task::TypeOfTask kBackend>
+class NesterovATestTaskGeneric : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+  explicit NesterovATestTaskGeneric(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+};
+
+using NesterovATestTaskGenericSEQ = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSEQ>;
+using NesterovATestTaskGenericOMP = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kOMP>;
+using NesterovATestTaskGenericTBB = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kTBB>;
+using NesterovATestTaskGenericSTL = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSTL>;
+
+}  // namespace nesterov_a_test_task_sort_radix
@@ -0,0 +1,41 @@
+#include "example_sort/generic/include/ops_generic.hpp"
+
+#include "example_sort/common/include/common.hpp"
+#include "parallel/include/algorithms.hpp"
+#include "parallel/include/execution_policy.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+template <ppc::task::TypeOfTask kBackend>
+NesterovATestTaskGeneric<kBackend>::NesterovATestTaskGeneric(const InType &in) {
+  this->SetTypeOfTask(GetStaticTypeOfTask());
+  this->GetInput() = in;
+  this->GetOutput() = {};
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::ValidationImpl() {
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PreProcessingImpl() {
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::RunImpl() {
+  auto &keys = this->GetOutput();
+  keys = this->GetInput();
+  ppc::parallel::Sort(ppc::parallel::ExecutionPolicy<kBackend>{}, keys.begin(), keys.end());
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PostProcessingImpl() {
+  return true;
+}
+
+template class NesterovATestTaskGeneric<ppc::parallel::kGenericBackend>;
+
+}  // namespace nesterov_a_test_task_sort
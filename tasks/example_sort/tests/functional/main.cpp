@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <tuple>
+
+#include "example_sort/all/include/ops_all.hpp"
+#include "example_sort/common/include/common.hpp"
+#include "example_sort/generic/include/ops_generic.hpp"
+#include "example_sort/generic/include/ops_radix.hpp"
+#include "util/include/func_test_util.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+using RadixTaskOMP = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericOMP;
+using RadixTaskSEQ = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericSEQ;
+using RadixTaskSTL = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericSTL;
+using RadixTaskTBB = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericTBB;
+
+class NesterovARunFuncTestsSort : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::get<2>(test_param) + "_" + std::to_string(std::get<1>(test_param));
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = MakeKeys(std::get<0>(params), std::get<1>(params));
+    expected_ = input_data_;
+    std::ranges::sort(expected_);
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return output_data == expected_;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  OutType expected_;
+};
+
+namespace {
+
+TEST_P(NesterovARunFuncTestsSort, SortKeys) {
+  ExecuteTest(GetParam());
+}
+
+// Sizes below the number of ranks leave ranks without keys; few distinct keys put many keys equal to a splitter
+const std::array<TestType, 9> kTestParam = {
+    std::make_tuple(KeyOrder::kRandom, 1, "random"),         std::make_tuple(KeyOrder::kRandom, 2, "random"),
+    std::make_tuple(KeyOrder::kRandom, 1000, "random"),      std::make_tuple(KeyOrder::kRandom, 1000000, "random"),
+    std::make_tuple(KeyOrder::kFewDistinct, 3, "few"),       std::make_tuple(KeyOrder::kFewDistinct, 100000, "few"),
+    std::make_tuple(KeyOrder::kSorted, 100000, "sorted"),    std::make_tuple(KeyOrder::kReversed, 100000, "reversed"),
+    std::make_tuple(KeyOrder::kReversed, 1000000, "reversed")};
+
+const auto kTestTasksList = std::tuple_cat(
+    ppc::util::AddFuncTask<NesterovATestTaskALL, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericOMP, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSEQ, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSTL, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericTBB, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<RadixTaskOMP, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<RadixTaskSEQ, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<RadixTaskSTL, InType>(kTestParam, PPC_SETTINGS_example_sort),
+    ppc::util::AddFuncTask<RadixTaskTBB, InType>(kTestParam, PPC_SETTINGS_example_sort));
+
+const auto kGtestValues = ppc::util::ExpandToValues(kTestTasksList);
+
+const auto kPerfTestName = NesterovARunFuncTestsSort::PrintFuncTestName<NesterovARunFuncTestsSort>;
+
+INSTANTIATE_TEST_SUITE_P(SortTests, NesterovARunFuncTestsSort, kGtestValues, kPerfTestName);
+
+}  // namespace
+
+}  // namespace nesterov_a_test_task_sort
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "example_sort/all/include/ops_all.hpp"
+#include "example_sort/common/include/common.hpp"
+#include "example_sort/generic/include/ops_generic.hpp"
+#include "example_sort/generic/include/ops_radix.hpp"
+#include "performance/include/performance.hpp"
+#include "util/include/perf_test_util.hpp"
+#include "util/include/test_data.hpp"
+
+namespace nesterov_a_test_task_sort {
+
+using RadixTaskOMP = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericOMP;
+using RadixTaskSEQ = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericSEQ;
+using RadixTaskSTL = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericSTL;
+using RadixTaskTBB = nesterov_a_test_task_sort_radix::NesterovATestTaskGenericTBB;
+
+// nesterov_a_test_task_sort_radix_* against nesterov_a_test_task_sort_* is the gain of radix over comparison sorting
+
+class ExampleRunPerfTestSort : public ppc::util::BaseRunPerfTests<InType, OutType> {
+  static constexpr int64_t kSize = 10'000'000;
+  std::optional<ppc::util::TaskDataset<int32_t>> keys_;
+
+  void SetUp() override {
+    // Generated once, then mapped from the data cache by every later test instance and run
+    keys_.emplace(ppc::util::LoadTaskDataset<int32_t>(PPC_ID_example_sort,
+                                                      "keys_random_" + std::to_string(kSize) + ".ppcd",
+                                                      std::string(kKeysTag),
+                                                      [] { return MakeKeys(KeyOrder::kRandom, kSize); }));
+  }
+
+  // Reported as task_run:keys_per_sec / pipeline:keys_per_sec
+  void SetPerfAttributes(ppc::performance::PerfAttr &perf_attrs) override {
+    BaseRunPerfTests::SetPerfAttributes(perf_attrs);
+    perf_attrs.items_per_run = static_cast<uint64_t>(kSize);
+    perf_attrs.throughput_name = "keys_per_sec";
+    perf_attrs.throughput_scale = 1.0;
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return output_data.size() == static_cast<std::size_t>(kSize) && std::ranges::is_sorted(output_data);
+  }
+
+  InType GetTestInputData() final {
+    const auto keys = keys_->Values();
+    return {keys.begin(), keys.end()};
+  }
+};
+
+TEST_P(ExampleRunPerfTestSort, RunPerfModes) {
+  ExecuteTest(GetParam());
+}
+
+const auto kAllPerfTasks =
+    ppc::util::MakeAllPerfTasks<InType, NesterovATestTaskALL, NesterovATestTaskGenericOMP, NesterovATestTaskGenericSEQ,
+                                NesterovATestTaskGenericSTL, NesterovATestTaskGenericTBB,
+                                RadixTaskOMP, RadixTaskSEQ, RadixTaskSTL, RadixTaskTBB>(PPC_SETTINGS_example_sort);
+
+const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+
+const auto kPerfTestName = ExampleRunPerfTestSort::CustomPerfTestName;
+
+INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestSort, kGtestValues, kPerfTestName);
+
+}  // namespace nesterov_a_test_task_sort
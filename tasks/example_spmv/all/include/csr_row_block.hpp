@@ -0,0 +1,69 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "distributed/include/persistent_exchange.hpp"
+#include "linalg/include/sparse_matrix.hpp"
+#include "util/include/partition.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+/// @brief Rows of a square sparse matrix distributed over the ranks in contiguous blocks with about the same number
+///        of entries, together with the halo of x they need.
+/// @details x is distributed like the rows. The local rows are split into interior rows, which only read owned
+///          entries of x, and boundary rows, which also read ghost entries owned by other ranks. The ghost entries
+///          are requested once at construction; Multiply() then receives them through persistent requests while
+///          the interior rows are computed. Construction and destruction are collective.
+class CsrRowBlock {
+ public:
+  /// @brief Takes the rows of this rank from @p a, which every rank holds.
+  /// @throws std::invalid_argument If @p a is not square.
+  CsrRowBlock(MPI_Comm comm, const ppc::linalg::CsrMatrix<double> &a);
+
+  CsrRowBlock(const CsrRowBlock &) = delete;
+  CsrRowBlock &operator=(const CsrRowBlock &) = delete;
+
+  /// @brief Returns the rows (and entries of x) owned by every rank.
+  [[nodiscard]] const std::vector<ppc::util::IndexRange> &GetRowRanges() const {
+    return ranges_;
+  }
+  /// @brief Returns the rows (and entries of x) owned by this rank.
+  [[nodiscard]] ppc::util::IndexRange GetRowRange() const {
+    return ranges_[static_cast<std::size_t>(rank_)];
+  }
+  /// @brief Returns the number of entries of x owned by other ranks that this rank reads.
+  [[nodiscard]] int64_t GetGhosts() const {
+    return static_cast<int64_t>(x_.size()) - GetRowRange().Size();
+  }
+
+  /// @brief Computes the owned rows of y = A x from the owned entries of x; collective.
+  /// @param x Owned entries of x, GetRowRange().Size() elements.
+  /// @param y Owned entries of y, GetRowRange().Size() elements.
+  void Multiply(std::span<const double> x, std::span<double> y);
+
+ private:
+  int rank_ = 0;
+  std::vector<ppc::util::IndexRange> ranges_;
+  /// Interior rows with columns local to the owned entries of x
+  ppc::linalg::CsrMatrix<double> interior_;
+  /// Boundary rows with columns local to x_
+  ppc::linalg::CsrMatrix<double> boundary_;
+  /// Local row of every row of interior_ / boundary_
+  std::vector<int64_t> interior_rows_;
+  std::vector<int64_t> boundary_rows_;
+  std::vector<double> interior_y_;
+  std::vector<double> boundary_y_;
+  /// Owned entries of x followed by the ghost entries, grouped by owner
+  std::vector<double> x_;
+  /// Local indices of the owned entries of x other ranks read, grouped by reader
+  std::vector<int64_t> send_indices_;
+  std::vector<double> send_buffer_;
+  ppc::distributed::PersistentExchange exchange_;
+};
+
+}  // namespace nesterov_a_test_task_spmv
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "example_spmv/all/include/csr_row_block.hpp"
+#include "example_spmv/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+/// @brief Row-distributed SpMV with an OpenMP ppc::linalg::SpMV() on every rank.
+/// @details Every rank takes its block of rows (CsrRowBlock) from the input in PreProcessing and exchanges the
+///          ghost entries of x while it multiplies the interior rows. PostProcessing gathers y on every rank.
+class NesterovATestTaskALL : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kALL;
+  }
+  explicit NesterovATestTaskALL(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  std::optional<CsrRowBlock> block_;
+  /// Owned rows of y
+  std::vector<double> y_;
+};
+
+}  // namespace nesterov_a_test_task_spmv
@@ -0,0 +1,152 @@
+#include "example_spmv/all/include/csr_row_block.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "distributed/include/persistent_exchange.hpp"
+#include "linalg/include/sparse_matrix.hpp"
+#include "linalg/include/spmv.hpp"
+#include "parallel/include/execution_policy.hpp"
+#include "util/include/partition.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+namespace {
+
+using ppc::linalg::CsrMatrix;
+using ppc::util::IndexRange;
+
+constexpr int kHaloTag = 0;
+
+using Triplets = std::vector<std::tuple<int64_t, int, double>>;
+
+/// Returns the rank whose range contains @p index; ranks without rows have empty ranges and are skipped
+int OwnerOf(const std::vector<IndexRange> &ranges, int64_t index) {
+  const auto it = std::ranges::upper_bound(ranges, index, {}, &IndexRange::end);
+  return static_cast<int>(it - ranges.begin());
+}
+
+std::vector<int> Displacements(const std::vector<int> &counts) {
+  std::vector<int> displs(counts.size(), 0);
+  for (std::size_t i = 1; i < counts.size(); i++) {
+    displs[i] = displs[i - 1] + counts[i - 1];
+  }
+  return displs;
+}
+
+}  // namespace
+
+CsrRowBlock::CsrRowBlock(MPI_Comm comm, const CsrMatrix<double> &a) : exchange_(comm) {
+  // x is distributed like the rows, so its length must equal the number of rows
+  if (a.Rows() != a.Cols()) {
+    throw std::invalid_argument("CsrRowBlock needs a square matrix");
+  }
+  int size = 0;
+  MPI_Comm_rank(comm, &rank_);
+  MPI_Comm_size(comm, &size);
+  ranges_ = ppc::util::PrefixRanges(a.RowPtr(), size);
+  const IndexRange rows = GetRowRange();
+  const int64_t owned = rows.Size();
+  auto is_owned = [&](int64_t col) { return col >= rows.begin && col < rows.end; };
+
+  // Ghost columns sorted by global index, which also groups them by owner
+  std::vector<int> ghosts;
+  const auto first_entry = static_cast<std::size_t>(a.RowPtr()[static_cast<std::size_t>(rows.begin)]);
+  const auto last_entry = static_cast<std::size_t>(a.RowPtr()[static_cast<std::size_t>(rows.end)]);
+  for (int col : a.ColIdx().subspan(first_entry, last_entry - first_entry)) {
+    if (!is_owned(col)) {
+      ghosts.push_back(col);
+    }
+  }
+  std::ranges::sort(ghosts);
+  ghosts.erase(std::ranges::unique(ghosts).begin(), ghosts.end());
+  auto local_col = [&](int col) {
+    if (is_owned(col)) {
+      return static_cast<int>(col - rows.begin);
+    }
+    return static_cast<int>(owned + (std::ranges::lower_bound(ghosts, col) - ghosts.begin()));
+  };
+
+  Triplets interior;
+  Triplets boundary;
+  for (int64_t row = rows.begin; row < rows.end; row++) {
+    const auto begin = a.RowPtr()[static_cast<std::size_t>(row)];
+    const auto end = a.RowPtr()[static_cast<std::size_t>(row) + 1];
+    const auto cols = a.ColIdx().subspan(static_cast<std::size_t>(begin), static_cast<std::size_t>(end - begin));
+    const bool is_interior = std::ranges::all_of(cols, is_owned);
+    auto &rows_of_kind = is_interior ? interior_rows_ : boundary_rows_;
+    auto &triplets = is_interior ? interior : boundary;
+    for (auto entry = begin; entry < end; entry++) {
+      const auto index = static_cast<std::size_t>(entry);
+      triplets.emplace_back(static_cast<int64_t>(rows_of_kind.size()), local_col(a.ColIdx()[index]), a.Values()[index]);
+    }
+    rows_of_kind.push_back(row - rows.begin);
+  }
+  const auto interior_count = static_cast<int64_t>(interior_rows_.size());
+  const auto boundary_count = static_cast<int64_t>(boundary_rows_.size());
+  interior_ = CsrMatrix<double>::FromTriplets(interior_count, owned, std::move(interior));
+  boundary_ = CsrMatrix<double>::FromTriplets(boundary_count, owned + static_cast<int64_t>(ghosts.size()),
+                                              std::move(boundary));
+  interior_y_.resize(interior_rows_.size());
+  boundary_y_.resize(boundary_rows_.size());
+  x_.resize(static_cast<std::size_t>(owned) + ghosts.size());
+
+  // Tell every owner which of its entries this rank reads
+  std::vector<int> recv_counts(static_cast<std::size_t>(size), 0);
+  for (int col : ghosts) {
+    recv_counts[static_cast<std::size_t>(OwnerOf(ranges_, col))]++;
+  }
+  std::vector<int> send_counts(static_cast<std::size_t>(size), 0);
+  MPI_Alltoall(recv_counts.data(), 1, MPI_INT, send_counts.data(), 1, MPI_INT, comm);
+  const auto recv_displs = Displacements(recv_counts);
+  const auto send_displs = Displacements(send_counts);
+  std::vector<int> requested(static_cast<std::size_t>(send_displs.back() + send_counts.back()));
+  MPI_Alltoallv(ghosts.data(), recv_counts.data(), recv_displs.data(), MPI_INT, requested.data(), send_counts.data(),
+                send_displs.data(), MPI_INT, comm);
+  send_indices_.reserve(requested.size());
+  for (int col : requested) {
+    send_indices_.push_back(col - rows.begin);
+  }
+  send_buffer_.resize(requested.size());
+
+  for (int peer = 0; peer < size; peer++) {
+    const auto p = static_cast<std::size_t>(peer);
+    if (recv_counts[p] > 0) {
+      exchange_.AddRecv(x_.data() + owned + recv_displs[p], recv_counts[p], MPI_DOUBLE, peer, kHaloTag);
+    }
+    if (send_counts[p] > 0) {
+      exchange_.AddSend(send_buffer_.data() + send_displs[p], send_counts[p], MPI_DOUBLE, peer, kHaloTag);
+    }
+  }
+}
+
+void CsrRowBlock::Multiply(std::span<const double> x, std::span<double> y) {
+  const auto owned = static_cast<std::size_t>(GetRowRange().Size());
+  std::ranges::copy(x.first(owned), x_.begin());
+  for (std::size_t i = 0; i < send_indices_.size(); i++) {
+    send_buffer_[i] = x_[static_cast<std::size_t>(send_indices_[i])];
+  }
+  // The interior rows only read owned entries, so they are computed while the ghost entries are in flight
+  auto interior = [&] {
+    ppc::linalg::SpMV(ppc::parallel::kOmp, interior_, std::span<const double>(x_).first(owned), interior_y_);
+    for (std::size_t i = 0; i < interior_rows_.size(); i++) {
+      y[static_cast<std::size_t>(interior_rows_[i])] = interior_y_[i];
+    }
+  };
+  auto boundary = [&] {
+    ppc::linalg::SpMV(ppc::parallel::kOmp, boundary_, x_, boundary_y_);
+    for (std::size_t i = 0; i < boundary_rows_.size(); i++) {
+      y[static_cast<std::size_t>(boundary_rows_[i])] = boundary_y_[i];
+    }
+  };
+  ppc::distributed::OverlappedStep(exchange_, interior, boundary);
+}
+
+}  // namespace nesterov_a_test_task_spmv
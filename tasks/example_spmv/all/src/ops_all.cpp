@@ -0,0 +1,52 @@
+#include "example_spmv/all/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "example_spmv/all/include/csr_row_block.hpp"
+#include "example_spmv/common/include/common.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+NesterovATestTaskALL::NesterovATestTaskALL(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = {};
+}
+
+bool NesterovATestTaskALL::ValidationImpl() {
+  return IsValid(GetInput());
+}
+
+bool NesterovATestTaskALL::PreProcessingImpl() {
+  block_.emplace(MPI_COMM_WORLD, GetInput().a);
+  y_.assign(static_cast<std::size_t>(block_->GetRowRange().Size()), 0.0);
+  return true;
+}
+
+bool NesterovATestTaskALL::RunImpl() {
+  const auto rows = block_->GetRowRange();
+  const auto x = std::span<const double>(GetInput().x).subspan(static_cast<std::size_t>(rows.begin));
+  block_->Multiply(x.first(static_cast<std::size_t>(rows.Size())), y_);
+  return true;
+}
+
+bool NesterovATestTaskALL::PostProcessingImpl() {
+  std::vector<int> counts;
+  std::vector<int> displs;
+  for (const auto &range : block_->GetRowRanges()) {
+    counts.push_back(static_cast<int>(range.Size()));
+    displs.push_back(static_cast<int>(range.begin));
+  }
+  GetOutput().resize(static_cast<std::size_t>(GetInput().a.Rows()));
+  MPI_Allgatherv(y_.data(), static_cast<int>(y_.size()), MPI_DOUBLE, GetOutput().data(), counts.data(),
+                 displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+  block_.reset();
+  y_ = {};
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_spmv
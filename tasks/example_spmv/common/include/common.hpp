@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "linalg/include/sparse_generators.hpp"
+#include "linalg/include/sparse_matrix.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+/// @brief Product y = A x of a square sparse matrix A and a dense vector x.
+struct SpMVInput {
+  ppc::linalg::CsrMatrix<double> a;
+  std::vector<double> x;
+};
+
+/// @brief Sparsity pattern of a generated input.
+enum class MatrixKind : uint8_t {
+  /// Diagonals -2 .. +2, like a 1D discretization; halo exchanges only touch neighbouring ranks
+  kBanded,
+  /// About 16 entries per row at random columns; most rows need values of every other rank
+  kRandom,
+  /// Like kRandom, but with very uneven row lengths
+  kSkewed,
+};
+
+using InType = SpMVInput;
+/// y
+using OutType = std::vector<double>;
+using TestType = std::tuple<MatrixKind, int, std::string>;
+using BaseTask = ppc::task::Task<InType, OutType>;
+
+/// @brief Returns an @p n x @p n matrix of the given kind with reproducible entries.
+inline ppc::linalg::CsrMatrix<double> MakeMatrix(MatrixKind kind, int64_t n) {
+  switch (kind) {
+    case MatrixKind::kBanded:
+      return ppc::linalg::MakeBandedMatrix(n, 2, 2, 1);
+    case MatrixKind::kRandom:
+      return ppc::linalg::MakeRandomMatrix({.rows = n, .cols = n, .nnz_per_row = 16.0, .skew = 0.0, .seed = 2});
+    case MatrixKind::kSkewed:
+      return ppc::linalg::MakeRandomMatrix({.rows = n, .cols = n, .nnz_per_row = 16.0, .skew = 0.7, .seed = 3});
+  }
+  throw std::invalid_argument("Unknown matrix kind");
+}
+
+/// @brief Returns an @p n x @p n input of the given kind with reproducible entries in x.
+inline SpMVInput MakeInput(MatrixKind kind, int64_t n) {
+  SpMVInput input{.a = MakeMatrix(kind, n), .x = std::vector<double>(static_cast<std::size_t>(n))};
+  for (std::size_t i = 0; i < input.x.size(); i++) {
+    input.x[i] = static_cast<double>(static_cast<int64_t>((i * 7919) % 2001) - 1000) / 1000.0;
+  }
+  return input;
+}
+
+/// @brief Checks that A is square and not empty and that x matches its size.
+inline bool IsValid(const SpMVInput &input) {
+  return input.a.Rows() > 0 && input.a.Rows() == input.a.Cols() && std::cmp_equal(input.x.size(), input.a.Cols());
+}
+
+}  // namespace nesterov_a_test_task_spmv
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "example_spmv/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+/// @brief ppc::linalg::SpMV() on the input matrix, once per threading backend.
+/// @details CMake compiles generic/src once per backend and instantiates the template for seq, omp, tbb and stl.
+///          Rows are split into blocks of equal entry counts, so the skewed matrices are balanced too.
+template <ppc::task::TypeOfTask kBackend>
+class NesterovATestTaskGeneric : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return kBackend;
+  }
+  explicit NesterovATestTaskGeneric(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+};
+
+using NesterovATestTaskGenericSEQ = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSEQ>;
+using NesterovATestTaskGenericOMP = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kOMP>;
+using NesterovATestTaskGenericTBB = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kTBB>;
+using NesterovATestTaskGenericSTL = NesterovATestTaskGeneric<ppc::task::TypeOfTask::kSTL>;
+
+}  // namespace nesterov_a_test_task_spmv
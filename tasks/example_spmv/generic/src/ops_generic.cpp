@@ -0,0 +1,43 @@
+#include "example_spmv/generic/include/ops_generic.hpp"
+
+#include <cstddef>
+
+#include "example_spmv/common/include/common.hpp"
+#include "linalg/include/spmv.hpp"
+#include "parallel/include/execution_policy.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+template <ppc::task::TypeOfTask kBackend>
+NesterovATestTaskGeneric<kBackend>::NesterovATestTaskGeneric(const InType &in) {
+  this->SetTypeOfTask(GetStaticTypeOfTask());
+  this->GetInput() = in;
+  this->GetOutput() = {};
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::ValidationImpl() {
+  return IsValid(this->GetInput());
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PreProcessingImpl() {
+  this->GetOutput().assign(static_cast<std::size_t>(this->GetInput().a.Rows()), 0.0);
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::RunImpl() {
+  const auto &input = this->GetInput();
+  ppc::linalg::SpMV(ppc::parallel::ExecutionPolicy<kBackend>{}, input.a, input.x, this->GetOutput());
+  return true;
+}
+
+template <ppc::task::TypeOfTask kBackend>
+bool NesterovATestTaskGeneric<kBackend>::PostProcessingImpl() {
+  return true;
+}
+
+template class NesterovATestTaskGeneric<ppc::parallel::kGenericBackend>;
+
+}  // namespace nesterov_a_test_task_spmv
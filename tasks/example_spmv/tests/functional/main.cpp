@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "example_spmv/all/include/csr_row_block.hpp"
+#include "example_spmv/all/include/ops_all.hpp"
+#include "example_spmv/common/include/common.hpp"
+#include "example_spmv/generic/include/ops_generic.hpp"
+#include "linalg/include/sparse_generators.hpp"
+#include "util/include/func_test_util.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+class NesterovARunFuncTestsSpMV : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::get<2>(test_param) + "_" + std::to_string(std::get<1>(test_param));
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = MakeInput(std::get<0>(params), std::get<1>(params));
+
+    // Row by row in the stored order as the reference
+    const auto &a = input_data_.a;
+    expected_.assign(static_cast<std::size_t>(a.Rows()), 0.0);
+    for (std::size_t row = 0; row < expected_.size(); row++) {
+      const auto end = static_cast<std::size_t>(a.RowPtr()[row + 1]);
+      for (auto entry = static_cast<std::size_t>(a.RowPtr()[row]); entry < end; entry++) {
+        expected_[row] += a.Values()[entry] * input_data_.x[static_cast<std::size_t>(a.ColIdx()[entry])];
+      }
+    }
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    if (output_data.size() != expected_.size()) {
+      return false;
+    }
+    // The distributed version adds the ghost entries of a row after the owned ones
+    for (std::size_t i = 0; i < expected_.size(); i++) {
+      if (std::abs(output_data[i] - expected_[i]) > 1e-12 * (1.0 + std::abs(expected_[i]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  std::vector<double> expected_;
+};
+
+namespace {
+
+TEST_P(NesterovARunFuncTestsSpMV, MatrixVectorProduct) {
+  ExecuteTest(GetParam());
+}
+
+TEST(NesterovASpMVRowBlock, RejectsRectangularMatrix) {
+  const auto a = ppc::linalg::MakeRandomMatrix({.rows = 6, .cols = 9, .nnz_per_row = 3.0, .skew = 0.0, .seed = 4});
+  EXPECT_THROW(CsrRowBlock(MPI_COMM_WORLD, a), std::invalid_argument);
+}
+
+// Sizes below the number of ranks leave ranks without rows; the skewed matrices have rows longer than a rank's
+// share of the entries
+const std::array<TestType, 7> kTestParam = {
+    std::make_tuple(MatrixKind::kBanded, 1, "banded"),   std::make_tuple(MatrixKind::kBanded, 3, "banded"),
+    std::make_tuple(MatrixKind::kBanded, 1000, "banded"), std::make_tuple(MatrixKind::kRandom, 2, "random"),
+    std::make_tuple(MatrixKind::kRandom, 517, "random"), std::make_tuple(MatrixKind::kSkewed, 40, "skewed"),
+    std::make_tuple(MatrixKind::kSkewed, 2000, "skewed")};
+
+const auto kTestTasksList = std::tuple_cat(
+    ppc::util::AddFuncTask<NesterovATestTaskALL, InType>(kTestParam, PPC_SETTINGS_example_spmv),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericOMP, InType>(kTestParam, PPC_SETTINGS_example_spmv),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSEQ, InType>(kTestParam, PPC_SETTINGS_example_spmv),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericSTL, InType>(kTestParam, PPC_SETTINGS_example_spmv),
+    ppc::util::AddFuncTask<NesterovATestTaskGenericTBB, InType>(kTestParam, PPC_SETTINGS_example_spmv));
+
+const auto kGtestValues = ppc::util::ExpandToValues(kTestTasksList);
+
+const auto kPerfTestName = NesterovARunFuncTestsSpMV::PrintFuncTestName<NesterovARunFuncTestsSpMV>;
+
+INSTANTIATE_TEST_SUITE_P(SpMVTests, NesterovARunFuncTestsSpMV, kGtestValues, kPerfTestName);
+
+}  // namespace
+
+}  // namespace nesterov_a_test_task_spmv
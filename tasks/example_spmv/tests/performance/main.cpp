@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "example_spmv/all/include/ops_all.hpp"
+#include "example_spmv/common/include/common.hpp"
+#include "example_spmv/generic/include/ops_generic.hpp"
+#include "linalg/include/spmv.hpp"
+#include "performance/include/performance.hpp"
+#include "util/include/perf_test_util.hpp"
+
+namespace nesterov_a_test_task_spmv {
+
+class ExampleRunPerfTestSpMV : public ppc::util::BaseRunPerfTests<InType, OutType> {
+  static constexpr int64_t kSize = 1 << 19;
+  InType input_data_;
+
+  void SetUp() override {
+    input_data_ = MakeInput(MatrixKind::kSkewed, kSize);
+  }
+
+  // SpMV is bound by memory bandwidth, so it is reported as task_run:gbytes_per_sec / pipeline:gbytes_per_sec
+  void SetPerfAttributes(ppc::performance::PerfAttr &perf_attrs) override {
+    BaseRunPerfTests::SetPerfAttributes(perf_attrs);
+    perf_attrs.items_per_run = ppc::linalg::SpMVBytes(input_data_.a);
+    perf_attrs.throughput_name = "gbytes_per_sec";
+    perf_attrs.throughput_scale = 1e-9;
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    if (output_data.size() != static_cast<std::size_t>(kSize)) {
+      return false;
+    }
+    // Spot check of a few rows against dot products
+    const auto &a = input_data_.a;
+    for (std::size_t row : {std::size_t{0}, std::size_t{kSize / 3}, std::size_t{kSize - 1}}) {
+      double expected = 0.0;
+      const auto end = static_cast<std::size_t>(a.RowPtr()[row + 1]);
+      for (auto entry = static_cast<std::size_t>(a.RowPtr()[row]); entry < end; entry++) {
+        expected += a.Values()[entry] * input_data_.x[static_cast<std::size_t>(a.ColIdx()[entry])];
+      }
+      if (std::abs(output_data[row] - expected) > 1e-9) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+};
+
+TEST_P(ExampleRunPerfTestSpMV, RunPerfModes) {
+  ExecuteTest(GetParam());
+}
+
+const auto kAllPerfTasks =
+    ppc::util::MakeAllPerfTasks<InType, NesterovATestTaskALL, NesterovATestTaskGenericOMP, NesterovATestTaskGenericSEQ,
+                                NesterovATestTaskGenericSTL, NesterovATestTaskGenericTBB>(PPC_SETTINGS_example_spmv);
+
+const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+
+const auto kPerfTestName = ExampleRunPerfTestSpMV::CustomPerfTestName;
+
+INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestSpMV, kGtestValues, kPerfTestName);
+
+}  // namespace nesterov_a_test_task_spmv
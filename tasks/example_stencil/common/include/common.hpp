@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+/// @brief Jacobi relaxation of the Laplace equation on a size x size grid with fixed boundary values.
+struct StencilInput {
+  int size = 0;
+  int iterations = 0;
+};
+
+using InType = StencilInput;
+/// Sum of all grid values after the last iteration
+using OutType = double;
+using TestType = std::tuple<int, std::string>;
+using BaseTask = ppc::task::Task<InType, OutType>;
+
+/// @brief Returns the initial value of grid cell (@p row, @p col): 1 on the top edge, a ramp from 0 to 1 down the
+///        left edge and 0 everywhere else. The edge values stay fixed during the relaxation.
+inline double InitialValue(int size, int64_t row, int64_t col) {
+  if (row == 0) {
+    return 1.0;
+  }
+  if (col == 0) {
+    return static_cast<double>(row) / static_cast<double>(size - 1);
+  }
+  return 0.0;
+}
+
+/// @brief Computes one grid row of the next iteration from rows @p above, @p row and @p below of the current one;
+///        the first and the last column are edge cells and are copied.
+/// @details Shared by all implementations, so they produce bit-identical grids.
+inline void RelaxRow(const double *above, const double *row, const double *below, double *out, int size) {
+  out[0] = row[0];
+  for (int col = 1; col < size - 1; col++) {
+    out[col] = 0.25 * (above[col] + below[col] + row[col - 1] + row[col + 1]);
+  }
+  out[size - 1] = row[size - 1];
+}
+
+}  // namespace nesterov_a_test_task_stencil
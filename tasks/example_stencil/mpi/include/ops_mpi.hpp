@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+
+#include "distributed/include/persistent_exchange.hpp"
+#include "example_stencil/common/include/common.hpp"
+#include "example_stencil/mpi/include/row_strip.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+/// @brief Row-strip Jacobi that overlaps the ghost-row exchange with the interior rows.
+/// @details The ghost-row messages of both buffers are registered once in PreProcessingImpl() as persistent
+///          requests; every iteration starts them, relaxes the rows that need no ghost row, waits and relaxes the
+///          first and the last row. Only the iterations are timed by the perf tests, not the setup.
+class NesterovATestTaskMPI : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kMPI;
+  }
+  explicit NesterovATestTaskMPI(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  std::optional<RowStrip> strip_;
+  std::optional<ppc::distributed::DoubleBufferedExchange> exchange_;
+};
+
+}  // namespace nesterov_a_test_task_stencil
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+
+#include "example_stencil/common/include/common.hpp"
+#include "example_stencil/mpi/include/row_strip.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_stencil_blocking {
+
+using nesterov_a_test_task_stencil::BaseTask;
+using nesterov_a_test_task_stencil::InType;
+using nesterov_a_test_task_stencil::OutType;
+
+/// @brief Row-strip Jacobi with a blocking ghost-row exchange (MPI_Sendrecv) before every iteration.
+/// @details Reference for nesterov_a_test_task_stencil::NesterovATestTaskMPI. It lives in its own namespace so
+///          both MPI versions get distinct test names and perf results.
+class NesterovATestTaskMPI : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kMPI;
+  }
+  explicit NesterovATestTaskMPI(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  std::optional<nesterov_a_test_task_stencil::RowStrip> strip_;
+};
+
+}  // namespace nesterov_a_test_task_stencil_blocking
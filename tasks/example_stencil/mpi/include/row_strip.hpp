@@ -0,0 +1,62 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "distributed/include/distributed_matrix.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+/// @brief Grid distributed in rows with one ghost row above and below, stored twice (current and next
+///        iteration).
+/// @details Local rows 0 .. GetRows() - 1 are owned, rows -1 and GetRows() are the ghost rows. Surplus ranks own
+///          no rows.
+class RowStrip {
+ public:
+  RowStrip(MPI_Comm comm, int size);
+
+  /// @brief Returns the number of owned rows.
+  [[nodiscard]] int GetRows() const {
+    return static_cast<int>(buffers_[0].GetLocalRows());
+  }
+  /// @brief Returns the rank owning the rows above, or MPI_PROC_NULL.
+  [[nodiscard]] int GetUp() const {
+    return buffers_[0].Neighbor(ppc::distributed::Side::kTop);
+  }
+  /// @brief Returns the rank owning the rows below, or MPI_PROC_NULL.
+  [[nodiscard]] int GetDown() const {
+    return buffers_[0].Neighbor(ppc::distributed::Side::kBottom);
+  }
+  [[nodiscard]] int GetSize() const {
+    return static_cast<int>(buffers_[0].GetCols());
+  }
+
+  /// @brief Returns buffer @p parity.
+  ppc::distributed::DistributedMatrix<double> &Buffer(int parity) {
+    return buffers_.at(static_cast<std::size_t>(parity));
+  }
+  /// @brief Returns local row @p local_row of buffer @p parity.
+  double *Row(int parity, int local_row) {
+    return &Buffer(parity)(local_row, 0);
+  }
+
+  /// @brief Computes local rows [@p from, @p to) of buffer 1 - @p parity from buffer @p parity.
+  /// @details Rows on the edge of the global grid keep their value.
+  void Relax(int parity, int from, int to);
+
+  /// @brief Returns the sum of the owned rows of buffer @p parity.
+  [[nodiscard]] double Sum(int parity) const;
+
+ private:
+  std::array<ppc::distributed::DistributedMatrix<double>, 2> buffers_;
+};
+
+/// Tag of the messages carrying a rank's first row to the rank above
+inline constexpr int kToUpTag = 1;
+/// Tag of the messages carrying a rank's last row to the rank below
+inline constexpr int kToDownTag = 2;
+
+}  // namespace nesterov_a_test_task_stencil
@@ -0,0 +1,69 @@
+#include "example_stencil/mpi/include/ops_mpi.hpp"
+
+#include <mpi.h>
+
+#include <cstdint>
+
+#include "distributed/include/persistent_exchange.hpp"
+#include "example_stencil/common/include/common.hpp"
+#include "example_stencil/mpi/include/row_strip.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+NesterovATestTaskMPI::NesterovATestTaskMPI(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = 0.0;
+}
+
+bool NesterovATestTaskMPI::ValidationImpl() {
+  return (GetInput().size >= 3) && (GetInput().iterations >= 0);
+}
+
+bool NesterovATestTaskMPI::PreProcessingImpl() {
+  auto &strip = strip_.emplace(MPI_COMM_WORLD, GetInput().size);
+  const int size = strip.GetSize();
+  const int rows = strip.GetRows();
+
+  // Duplicates the communicator and registers the persistent requests once, outside of the timed iterations
+  auto &exchange = exchange_.emplace(MPI_COMM_WORLD);
+  for (int parity = 0; rows > 0 && parity < 2; parity++) {
+    auto &buffer = exchange.Buffer(parity);
+    buffer.AddRecv(strip.Row(parity, -1), size, MPI_DOUBLE, strip.GetUp(), kToDownTag);
+    buffer.AddRecv(strip.Row(parity, rows), size, MPI_DOUBLE, strip.GetDown(), kToUpTag);
+    buffer.AddSend(strip.Row(parity, 0), size, MPI_DOUBLE, strip.GetUp(), kToUpTag);
+    buffer.AddSend(strip.Row(parity, rows - 1), size, MPI_DOUBLE, strip.GetDown(), kToDownTag);
+  }
+  return true;
+}
+
+bool NesterovATestTaskMPI::RunImpl() {
+  auto &strip = *strip_;
+  auto &exchange = *exchange_;
+  const int rows = strip.GetRows();
+
+  for (int64_t iteration = 0; iteration < GetInput().iterations; iteration++) {
+    const int parity = static_cast<int>(iteration % 2);
+    // Rows 1 .. rows - 2 only read owned rows, so they are relaxed while the ghost rows are in flight
+    auto interior = [&] { strip.Relax(parity, 1, rows - 1); };
+    auto boundary = [&] {
+      strip.Relax(parity, 0, 1);
+      if (rows > 1) {
+        strip.Relax(parity, rows - 1, rows);
+      }
+    };
+    exchange.Step(iteration, interior, boundary);
+  }
+  return true;
+}
+
+bool NesterovATestTaskMPI::PostProcessingImpl() {
+  double local = strip_->Sum(GetInput().iterations % 2);
+  MPI_Allreduce(&local, &GetOutput(), 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  // The persistent requests point into the strip, so they are freed first
+  exchange_.reset();
+  strip_.reset();
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_stencil
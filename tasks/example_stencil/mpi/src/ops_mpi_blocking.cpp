@@ -0,0 +1,41 @@
+#include "example_stencil/mpi/include/ops_mpi_blocking.hpp"
+
+#include <mpi.h>
+
+#include "example_stencil/mpi/include/row_strip.hpp"
+
+namespace nesterov_a_test_task_stencil_blocking {
+
+NesterovATestTaskMPI::NesterovATestTaskMPI(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = 0.0;
+}
+
+bool NesterovATestTaskMPI::ValidationImpl() {
+  return (GetInput().size >= 3) && (GetInput().iterations >= 0);
+}
+
+bool NesterovATestTaskMPI::PreProcessingImpl() {
+  strip_.emplace(MPI_COMM_WORLD, GetInput().size);
+  return true;
+}
+
+bool NesterovATestTaskMPI::RunImpl() {
+  auto &strip = *strip_;
+  for (int iteration = 0; iteration < GetInput().iterations; iteration++) {
+    const int parity = iteration % 2;
+    strip.Buffer(parity).ExchangeHalo();
+    strip.Relax(parity, 0, strip.GetRows());
+  }
+  return true;
+}
+
+bool NesterovATestTaskMPI::PostProcessingImpl() {
+  double local = strip_->Sum(GetInput().iterations % 2);
+  MPI_Allreduce(&local, &GetOutput(), 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  strip_.reset();
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_stencil_blocking
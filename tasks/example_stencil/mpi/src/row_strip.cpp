@@ -0,0 +1,54 @@
+#include "example_stencil/mpi/include/row_strip.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "distributed/include/distributed_matrix.hpp"
+#include "example_stencil/common/include/common.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+using ppc::distributed::DistributedMatrix;
+using ppc::distributed::MatrixLayout;
+
+RowStrip::RowStrip(MPI_Comm comm, int size)
+    : buffers_{DistributedMatrix<double>(comm, size, size, MatrixLayout::kRows, 1),
+               DistributedMatrix<double>(comm, size, size, MatrixLayout::kRows, 1)} {
+  const int64_t first_row = buffers_[0].GetRowRange().begin;
+  // Edge cells are never written, so both buffers start with them
+  for (auto &buffer : buffers_) {
+    for (int64_t row = 0; row < buffer.GetLocalRows(); row++) {
+      for (int64_t col = 0; col < size; col++) {
+        buffer(row, col) = InitialValue(size, first_row + row, col);
+      }
+    }
+  }
+}
+
+void RowStrip::Relax(int parity, int from, int to) {
+  const int64_t first_row = buffers_[0].GetRowRange().begin;
+  const int size = GetSize();
+  for (int local_row = from; local_row < to; local_row++) {
+    const int64_t row = first_row + local_row;
+    if (row == 0 || row == size - 1) {
+      continue;
+    }
+    RelaxRow(Row(parity, local_row - 1), Row(parity, local_row), Row(parity, local_row + 1),
+             Row(1 - parity, local_row), size);
+  }
+}
+
+double RowStrip::Sum(int parity) const {
+  const auto &buffer = buffers_.at(static_cast<std::size_t>(parity));
+  double sum = 0.0;
+  for (int64_t row = 0; row < buffer.GetLocalRows(); row++) {
+    for (int64_t col = 0; col < buffer.GetCols(); col++) {
+      sum += buffer(row, col);
+    }
+  }
+  return sum;
+}
+
+}  // namespace nesterov_a_test_task_stencil
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "example_stencil/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+class NesterovATestTaskSEQ : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kSEQ;
+  }
+  explicit NesterovATestTaskSEQ(const InType &in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  std::vector<double> current_;
+  std::vector<double> next_;
+};
+
+}  // namespace nesterov_a_test_task_stencil
@@ -0,0 +1,53 @@
+#include "example_stencil/seq/include/ops_seq.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+
+#include "example_stencil/common/include/common.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+NesterovATestTaskSEQ::NesterovATestTaskSEQ(const InType &in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = in;
+  GetOutput() = 0.0;
+}
+
+bool NesterovATestTaskSEQ::ValidationImpl() {
+  return (GetInput().size >= 3) && (GetInput().iterations >= 0);
+}
+
+bool NesterovATestTaskSEQ::PreProcessingImpl() {
+  const int size = GetInput().size;
+  const auto cells = static_cast<std::size_t>(size) * static_cast<std::size_t>(size);
+  current_.resize(cells);
+  for (int row = 0; row < size; row++) {
+    for (int col = 0; col < size; col++) {
+      current_[(static_cast<std::size_t>(row) * size) + col] = InitialValue(size, row, col);
+    }
+  }
+  next_ = current_;
+  return true;
+}
+
+bool NesterovATestTaskSEQ::RunImpl() {
+  const int size = GetInput().size;
+  const auto stride = static_cast<std::size_t>(size);
+  for (int iteration = 0; iteration < GetInput().iterations; iteration++) {
+    // The first and the last row are edge cells and already hold their values in both grids
+    for (std::size_t row = 1; row + 1 < stride; row++) {
+      const double *cur = current_.data() + (row * stride);
+      RelaxRow(cur - stride, cur, cur + stride, next_.data() + (row * stride), size);
+    }
+    std::swap(current_, next_);
+  }
+  return true;
+}
+
+bool NesterovATestTaskSEQ::PostProcessingImpl() {
+  GetOutput() = std::accumulate(current_.begin(), current_.end(), 0.0);
+  return true;
+}
+
+}  // namespace nesterov_a_test_task_stencil
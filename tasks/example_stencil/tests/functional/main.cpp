@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "example_stencil/common/include/common.hpp"
+#include "example_stencil/mpi/include/ops_mpi.hpp"
+#include "example_stencil/mpi/include/ops_mpi_blocking.hpp"
+#include "example_stencil/seq/include/ops_seq.hpp"
+#include "util/include/func_test_util.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+using BlockingTaskMPI = nesterov_a_test_task_stencil_blocking::NesterovATestTaskMPI;
+
+class NesterovARunFuncTestsStencil : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::to_string(std::get<0>(test_param)) + "_" + std::get<1>(test_param);
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = {.size = std::get<0>(params), .iterations = kIterations};
+
+    // Straightforward Jacobi on the whole grid as the reference
+    const int size = input_data_.size;
+    const auto stride = static_cast<std::size_t>(size);
+    std::vector<double> current(stride * stride);
+    for (std::size_t row = 0; row < stride; row++) {
+      for (std::size_t col = 0; col < stride; col++) {
+        current[(row * stride) + col] = InitialValue(size, static_cast<int64_t>(row), static_cast<int64_t>(col));
+      }
+    }
+    std::vector<double> next = current;
+    for (int iteration = 0; iteration < kIterations; iteration++) {
+      for (std::size_t row = 1; row + 1 < stride; row++) {
+        for (std::size_t col = 1; col + 1 < stride; col++) {
+          const std::size_t cell = (row * stride) + col;
+          next[cell] =
+              0.25 * (current[cell - stride] + current[cell + stride] + current[cell - 1] + current[cell + 1]);
+        }
+      }
+      std::swap(current, next);
+    }
+    expected_ = 0.0;
+    for (double value : current) {
+      expected_ += value;
+    }
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    // The MPI versions add up the per-rank sums in a different order
+    return std::abs(output_data - expected_) <= 1e-9 * std::max(1.0, std::abs(expected_));
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  static constexpr int kIterations = 25;
+  InType input_data_;
+  double expected_ = 0.0;
+};
+
+namespace {
+
+TEST_P(NesterovARunFuncTestsStencil, JacobiRelaxation) {
+  ExecuteTest(GetParam());
+}
+
+// Grids smaller than the process count leave ranks without rows; one or two rows per rank have no interior
+const std::array<TestType, 5> kTestParam = {std::make_tuple(3, "tiny"), std::make_tuple(4, "narrow"),
+                                            std::make_tuple(7, "odd"), std::make_tuple(16, "square"),
+                                            std::make_tuple(101, "large")};
+
+const auto kTestTasksList = std::tuple_cat(
+    ppc::util::AddFuncTask<NesterovATestTaskMPI, InType>(kTestParam, PPC_SETTINGS_example_stencil),
+    ppc::util::AddFuncTask<BlockingTaskMPI, InType>(kTestParam, PPC_SETTINGS_example_stencil),
+    ppc::util::AddFuncTask<NesterovATestTaskSEQ, InType>(kTestParam, PPC_SETTINGS_example_stencil));
+
+const auto kGtestValues = ppc::util::ExpandToValues(kTestTasksList);
+
+const auto kPerfTestName = NesterovARunFuncTestsStencil::PrintFuncTestName<NesterovARunFuncTestsStencil>;
+
+INSTANTIATE_TEST_SUITE_P(JacobiTests, NesterovARunFuncTestsStencil, kGtestValues, kPerfTestName);
+
+}  // namespace
+
+}  // namespace nesterov_a_test_task_stencil
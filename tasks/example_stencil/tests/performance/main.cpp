@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "example_stencil/common/include/common.hpp"
+#include "example_stencil/mpi/include/ops_mpi.hpp"
+#include "example_stencil/mpi/include/ops_mpi_blocking.hpp"
+#include "example_stencil/seq/include/ops_seq.hpp"
+#include "util/include/perf_test_util.hpp"
+
+namespace nesterov_a_test_task_stencil {
+
+using BlockingTaskMPI = nesterov_a_test_task_stencil_blocking::NesterovATestTaskMPI;
+
+// nesterov_a_test_task_stencil_mpi_* against nesterov_a_test_task_stencil_blocking_mpi_* is the gain of
+// overlapping the ghost-row exchange with the interior rows
+class ExampleRunPerfTestStencil : public ppc::util::BaseRunPerfTests<InType, OutType> {
+  InType input_data_{.size = 1024, .iterations = 100};
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    // The top edge alone adds up to size; the relaxation only adds positive values
+    return std::isfinite(output_data) && output_data >= static_cast<double>(input_data_.size);
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+};
+
+TEST_P(ExampleRunPerfTestStencil, RunPerfModes) {
+  ExecuteTest(GetParam());
+}
+
+const auto kAllPerfTasks =
+    ppc::util::MakeAllPerfTasks<InType, NesterovATestTaskMPI, BlockingTaskMPI, NesterovATestTaskSEQ>(
+        PPC_SETTINGS_example_stencil);
+
+const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+
+const auto kPerfTestName = ExampleRunPerfTestStencil::CustomPerfTestName;
+
+INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestStencil, kGtestValues, kPerfTestName);
+
+}  // namespace nesterov_a_test_task_stencil
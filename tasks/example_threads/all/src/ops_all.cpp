@@ -1,14 +1,18 @@
 #include "example_threads/all/include/ops_all.hpp"
 
 #include <mpi.h>
+#include <omp.h>
 
-#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <numeric>
-#include <thread>
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
 #include "oneapi/tbb/parallel_for.h"
+#include "thread_pool/include/thread_pool.hpp"
+#include "util/include/combinable.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
@@ -46,32 +50,29 @@ bool NesterovATestTaskALL::RunImpl() {
     int rank = -1;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
     if (rank == 0) {
-      std::atomic<int> counter(0);
+      ppc::util::Combinable<int> counter;
 #pragma omp parallel default(none) shared(counter) num_threads(ppc::util::GetNumThreads())
-      counter++;
+      counter.Local(static_cast<std::size_t>(omp_get_thread_num()))++;
 
-      GetOutput() /= counter;
+      GetOutput() /= counter.Combine(std::plus<>());
     } else {
       GetOutput() /= num_threads;
     }
   }
 
   {
-    GetOutput() *= num_threads;
-    std::vector<std::thread> threads(num_threads);
-    std::atomic<int> counter(0);
-    for (int i = 0; i < num_threads; i++) {
-      threads[i] = std::thread([&]() { counter++; });
-      threads[i].join();
-    }
-    GetOutput() /= counter;
+    auto &pool = ppc::thread_pool::ThreadPool::Instance();
+    GetOutput() *= pool.GetNumThreads();
+    ppc::util::Combinable<int> counter;
+    pool.ParallelFor(0, pool.GetNumThreads(), [&](int64_t /*i*/) { counter.Local()++; }, 1);
+    GetOutput() /= counter.Combine(std::plus<>());
   }
 
   {
     GetOutput() *= num_threads;
-    std::atomic<int> counter(0);
-    tbb::parallel_for(0, ppc::util::GetNumThreads(), [&](int /*i*/) { counter++; });
-    GetOutput() /= counter;
+    ppc::util::Combinable<int> counter;
+    tbb::parallel_for(0, ppc::util::GetNumThreads(), [&](int /*i*/) { counter.Local()++; });
+    GetOutput() /= counter.Combine(std::plus<>());
   }
   MPI_Barrier(MPI_COMM_WORLD);
   return GetOutput() > 0;
@@ -1,10 +1,14 @@
 #include "example_threads/omp/include/ops_omp.hpp"
 
-#include <atomic>
+#include <omp.h>
+
+#include <cstddef>
+#include <functional>
 #include <numeric>
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
+#include "util/include/combinable.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
@@ -38,11 +42,11 @@ bool NesterovATestTaskOMP::RunImpl() {
   const int num_threads = ppc::util::GetNumThreads();
   GetOutput() *= num_threads;
 
-  std::atomic<int> counter(0);
+  ppc::util::Combinable<int> counter;
 #pragma omp parallel default(none) shared(counter) num_threads(ppc::util::GetNumThreads())
-  counter++;
+  counter.Local(static_cast<std::size_t>(omp_get_thread_num()))++;
 
-  GetOutput() /= counter;
+  GetOutput() /= counter.Combine(std::plus<>());
   return GetOutput() > 0;
 }
 
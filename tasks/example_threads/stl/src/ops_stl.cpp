@@ -1,12 +1,13 @@
 #include "example_threads/stl/include/ops_stl.hpp"
 
-#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <numeric>
-#include <thread>
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
-#include "util/include/util.hpp"
+#include "thread_pool/include/thread_pool.hpp"
+#include "util/include/combinable.hpp"
 
 namespace nesterov_a_test_task_threads {
 
@@ -36,17 +37,14 @@ bool NesterovATestTaskSTL::RunImpl() {
     }
   }
 
-  const int num_threads = ppc::util::GetNumThreads();
-  std::vector<std::thread> threads(num_threads);
+  auto &pool = ppc::thread_pool::ThreadPool::Instance();
+  const int num_threads = pool.GetNumThreads();
   GetOutput() *= num_threads;
 
-  std::atomic<int> counter(0);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread([&]() { counter++; });
-    threads[i].join();
-  }
+  ppc::util::Combinable<int> counter;
+  pool.ParallelFor(0, num_threads, [&](int64_t /*i*/) { counter.Local()++; }, 1);
 
-  GetOutput() /= counter;
+  GetOutput() /= counter.Combine(std::plus<>());
   return GetOutput() > 0;
 }
 
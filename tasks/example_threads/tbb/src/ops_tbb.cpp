@@ -2,13 +2,14 @@
 
 #include <tbb/tbb.h>
 
-#include <atomic>
+#include <functional>
 #include <numeric>
 #include <util/include/util.hpp>
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
 #include "oneapi/tbb/parallel_for.h"
+#include "util/include/combinable.hpp"
 
 namespace nesterov_a_test_task_threads {
 
@@ -41,10 +42,10 @@ bool NesterovATestTaskTBB::RunImpl() {
   const int num_threads = ppc::util::GetNumThreads();
   GetOutput() *= num_threads;
 
-  std::atomic<int> counter(0);
-  tbb::parallel_for(0, ppc::util::GetNumThreads(), [&](int /*i*/) { counter++; });
+  ppc::util::Combinable<int> counter;
+  tbb::parallel_for(0, ppc::util::GetNumThreads(), [&](int /*i*/) { counter.Local()++; });
 
-  GetOutput() /= counter;
+  GetOutput() /= counter.Combine(std::plus<>());
   return GetOutput() > 0;
 }
 
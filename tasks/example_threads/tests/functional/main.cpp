@@ -10,7 +10,6 @@
 #include <string>
 #include <tuple>
 #include <utility>
-#include <vector>
 
 #include "example_threads/all/include/ops_all.hpp"
 #include "example_threads/common/include/common.hpp"
@@ -19,6 +18,7 @@
 #include "example_threads/stl/include/ops_stl.hpp"
 #include "example_threads/tbb/include/ops_tbb.hpp"
 #include "util/include/func_test_util.hpp"
+#include "util/include/test_data.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
@@ -31,23 +31,15 @@ class NesterovARunFuncTestsThreads : public ppc::util::BaseRunFuncTests<InType,
 
  protected:
   void SetUp() override {
-    int width = -1;
-    int height = -1;
-    int channels = -1;
-    std::vector<uint8_t> img;
-    // Read image in RGB to ensure consistent channel count
-    {
-      std::string abs_path = ppc::util::GetAbsoluteTaskPath(std::string(PPC_ID_example_threads), "pic.jpg");
-      auto *data = stbi_load(abs_path.c_str(), &width, &height, &channels, STBI_rgb);
-      if (data == nullptr) {
-        throw std::runtime_error("Failed to load image: " + std::string(stbi_failure_reason()));
-      }
-      channels = STBI_rgb;
-      img = std::vector<uint8_t>(data, data + (static_cast<ptrdiff_t>(width * height * channels)));
-      stbi_image_free(data);
-      if (std::cmp_not_equal(width, height)) {
-        throw std::runtime_error("width != height: ");
-      }
+    // Read image in RGB to ensure consistent channel count. It is decoded once per process (or mapped from the
+    // build's data cache), not in every SetUp
+    const auto image = ppc::util::LoadTaskImage(PPC_ID_example_threads, "pic.jpg", STBI_rgb);
+    const int width = image->Width();
+    const int height = image->Height();
+    const int channels = image->Channels();
+    const auto img = image->Pixels();
+    if (std::cmp_not_equal(width, height)) {
+      throw std::runtime_error("width != height: ");
     }
 
     TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());